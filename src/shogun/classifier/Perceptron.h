@@ -43,6 +43,9 @@ class Perceptron : public IterativeMachine<LinearMachine>
 		 */
 		EMachineType get_classifier_type() override { return CT_PERCEPTRON; }
 
+		/** every iteration is a pass over the training vectors */
+		bool train_prefers_contiguous_features() const override { return true; }
+
 		/// set learn rate of gradient descent training algorithm
 		inline void set_learn_rate(float64_t r)
 		{
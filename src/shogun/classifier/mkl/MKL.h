@@ -395,6 +395,17 @@ class MKL : public SVM
 		/** initialize solver such as glpk or cplex */
 		void init_solver();
 
+		/** compute alpha'*K_j*alpha over the support vectors of machine for
+		 * each subkernel j. Subkernel values are cached by the CombinedKernel
+		 * between MKL iterations, as far as its subkernel_cache_size allows,
+		 * so that only kernel values of new support vectors have to be
+		 * evaluated.
+		 *
+		 * @param machine SVM whose support vectors and alphas are used
+		 * @return quadratic form of each subkernel
+		 */
+		SGVector<float64_t> compute_subkernel_quadratic_forms(SVM* machine);
+
 	private:
 		void register_params();
 
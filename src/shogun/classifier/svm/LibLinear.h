@@ -109,6 +109,12 @@ namespace shogun
 			return CT_LIBLINEAR;
 		}
 
+		/** solvers make many passes over the training vectors */
+		bool train_prefers_contiguous_features() const override
+		{
+			return true;
+		}
+
 		/** set C
 		 *
 		 * @param c_neg C1
@@ -8,6 +8,7 @@
 #include <shogun/converter/EmbeddingConverter.h>
 #include <shogun/kernel/LinearKernel.h>
 #include <shogun/distance/EuclideanDistance.h>
+#include <shogun/lib/tapkee/tapkee_shogun.hpp>
 
 #include <utility>
 
@@ -22,7 +23,9 @@ EmbeddingConverter::EmbeddingConverter()
 	m_distance = std::make_shared<EuclideanDistance>();
 	
 	m_kernel = std::make_shared<LinearKernel>();
-	
+	m_neighbors_method = NEIGHBORS_EXACT;
+	m_nndescent_max_iteration = 10;
+	m_nndescent_sample_rate = 0.5;
 
 	init();
 }
@@ -70,6 +73,46 @@ std::shared_ptr<Kernel> EmbeddingConverter::get_kernel() const
 	return m_kernel;
 }
 
+void EmbeddingConverter::set_neighbors_method(ENeighborsMethod method)
+{
+	m_neighbors_method = method;
+}
+
+ENeighborsMethod EmbeddingConverter::get_neighbors_method() const
+{
+	return m_neighbors_method;
+}
+
+void EmbeddingConverter::set_nndescent_max_iteration(int32_t max_iteration)
+{
+	require(max_iteration >= 0, "Number of iterations ({}) must not be negative", max_iteration);
+	m_nndescent_max_iteration = max_iteration;
+}
+
+int32_t EmbeddingConverter::get_nndescent_max_iteration() const
+{
+	return m_nndescent_max_iteration;
+}
+
+void EmbeddingConverter::set_nndescent_sample_rate(float64_t sample_rate)
+{
+	require(sample_rate > 0 && sample_rate <= 1,
+		"Sample rate ({}) must be in (0,1]", sample_rate);
+	m_nndescent_sample_rate = sample_rate;
+}
+
+float64_t EmbeddingConverter::get_nndescent_sample_rate() const
+{
+	return m_nndescent_sample_rate;
+}
+
+void EmbeddingConverter::init_neighbors_parameters(TAPKEE_PARAMETERS_FOR_SHOGUN& parameters) const
+{
+	parameters.neighbors_method = m_neighbors_method;
+	parameters.nndescent_max_iteration = m_nndescent_max_iteration;
+	parameters.nndescent_sample_rate = m_nndescent_sample_rate;
+}
+
 void EmbeddingConverter::init()
 {
 	SG_ADD(&m_target_dim, "target_dim",
@@ -79,5 +122,13 @@ void EmbeddingConverter::init()
 		ParameterProperties::HYPER);
 	SG_ADD(
 		&m_kernel, "kernel", "kernel to be used for embedding", ParameterProperties::HYPER);
+	SG_ADD_OPTIONS(
+		(machine_int_t*)&m_neighbors_method, "neighbors_method",
+		"nearest neighbors method", ParameterProperties::NONE,
+		SG_OPTIONS(NEIGHBORS_EXACT, NEIGHBORS_NN_DESCENT));
+	SG_ADD(&m_nndescent_max_iteration, "nndescent_max_iteration",
+		"maximal number of NN-descent iterations");
+	SG_ADD(&m_nndescent_sample_rate, "nndescent_sample_rate",
+		"fraction of neighbors sampled in an NN-descent iteration");
 }
 }
@@ -21,6 +21,16 @@ namespace shogun
 class Features;
 class Distance;
 class Kernel;
+struct TAPKEE_PARAMETERS_FOR_SHOGUN;
+
+/** method to find nearest neighbors of neighborhood based embeddings */
+enum ENeighborsMethod
+{
+	/** exact search with a cover or vantage point tree */
+	NEIGHBORS_EXACT,
+	/** approximate search with NN-descent */
+	NEIGHBORS_NN_DESCENT
+};
 
 /** @brief class EmbeddingConverter (part of the Efficient Dimensionality
  * Reduction Toolkit) used to construct embeddings of
@@ -73,6 +83,39 @@ public:
 	 */
 	std::shared_ptr<Kernel> get_kernel() const;
 
+	/** setter for the nearest neighbors method used by neighborhood based
+	 * embeddings
+	 * @param method neighbors method
+	 */
+	void set_neighbors_method(ENeighborsMethod method);
+
+	/** getter for the nearest neighbors method
+	 * @return neighbors method
+	 */
+	ENeighborsMethod get_neighbors_method() const;
+
+	/** setter for the maximal number of NN-descent iterations
+	 * @param max_iteration maximal number of iterations
+	 */
+	void set_nndescent_max_iteration(int32_t max_iteration);
+
+	/** getter for the maximal number of NN-descent iterations
+	 * @return maximal number of iterations
+	 */
+	int32_t get_nndescent_max_iteration() const;
+
+	/** setter for the fraction of neighbors NN-descent samples as new
+	 * candidates in each iteration, lower is faster and higher gives a
+	 * better recall
+	 * @param sample_rate sample rate in (0,1]
+	 */
+	void set_nndescent_sample_rate(float64_t sample_rate);
+
+	/** getter for the NN-descent sample rate
+	 * @return sample rate
+	 */
+	float64_t get_nndescent_sample_rate() const;
+
 	const char* get_name() const override { return "EmbeddingConverter"; };
 
 protected:
@@ -80,6 +123,11 @@ protected:
 	/** default init */
 	void init();
 
+	/** stores the neighbors method settings in tapkee parameters
+	 * @param parameters parameters to fill
+	 */
+	void init_neighbors_parameters(TAPKEE_PARAMETERS_FOR_SHOGUN& parameters) const;
+
 protected:
 
 	/** target dim of dimensionality reduction preprocessor */
@@ -90,6 +138,15 @@ protected:
 
 	/** kernel to be used */
 	std::shared_ptr<Kernel> m_kernel;
+
+	/** nearest neighbors method */
+	ENeighborsMethod m_neighbors_method;
+
+	/** maximal number of NN-descent iterations */
+	int32_t m_nndescent_max_iteration;
+
+	/** fraction of neighbors sampled in an NN-descent iteration */
+	float64_t m_nndescent_sample_rate;
 };
 }
 
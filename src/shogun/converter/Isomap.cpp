@@ -50,13 +50,14 @@ std::shared_ptr<DenseFeatures<float64_t>> Isomap::embed_distance(std::shared_ptr
 	if (m_landmark)
 	{
 		parameters.method = SHOGUN_LANDMARK_ISOMAP;
-		parameters.landmark_ratio = float64_t(m_landmark_number)/distance->get_num_vec_lhs();
+		parameters.landmark_ratio = get_landmark_ratio(distance->get_num_vec_lhs());
 	}
 	else
 	{
 		parameters.method = SHOGUN_ISOMAP;
 	}
 	parameters.n_neighbors = m_k;
+	init_neighbors_parameters(parameters);
 	parameters.target_dimension = m_target_dim;
 	parameters.distance = distance.get();
 	return tapkee_embed(parameters);
@@ -39,6 +39,11 @@ class Distance;
  *   dividing each eigenvector by the square root of its corresponding eigenvalue. Form the final embedding with eigenvectors as rows and projected
  *   feature vectors as columns.
 
+ * Landmark Isomap (see set_landmark) relaxes shortest paths from the
+ * landmarks only, embeds the landmarks with classical scaling and
+ * triangulates the other vectors. It stores \f$ L \times N \f$ geodesic
+ * distances instead of \f$ N \times N \f$ ones.
+ *
  * It is possible to apply preprocessor to specified distance using
  * apply_to_distance.
  *
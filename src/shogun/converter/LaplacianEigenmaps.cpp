@@ -80,6 +80,7 @@ std::shared_ptr<DenseFeatures<float64_t>> LaplacianEigenmaps::embed_distance(std
 {
 	TAPKEE_PARAMETERS_FOR_SHOGUN parameters;
 	parameters.n_neighbors = m_k;
+	init_neighbors_parameters(parameters);
 	parameters.gaussian_kernel_width = m_tau;
 	parameters.method = SHOGUN_LAPLACIAN_EIGENMAPS;
 	parameters.target_dimension = m_target_dim;
@@ -81,6 +81,7 @@ std::shared_ptr<Features> ManifoldSculpting::transform(std::shared_ptr<Features>
 
 	TAPKEE_PARAMETERS_FOR_SHOGUN parameters;
 	parameters.n_neighbors = m_k;
+	init_neighbors_parameters(parameters);
 	parameters.squishing_rate = m_squishing_rate;
 	parameters.max_iteration = m_max_iteration;
 	parameters.features = feats.get();
@@ -68,6 +68,16 @@ bool MultidimensionalScaling::get_landmark() const
 	return m_landmark;
 }
 
+float64_t MultidimensionalScaling::get_landmark_ratio(int32_t num_vectors) const
+{
+	if (m_landmark_number > num_vectors)
+	{
+		io::warn("Number of landmarks ({}) exceeds number of feature vectors ({})",m_landmark_number,num_vectors);
+		return 1.0;
+	}
+	return float64_t(m_landmark_number)/num_vectors;
+}
+
 const char* MultidimensionalScaling::get_name() const
 {
 	return "MultidimensionalScaling";
@@ -79,11 +89,7 @@ std::shared_ptr<DenseFeatures<float64_t>> MultidimensionalScaling::embed_distanc
 	if (m_landmark)
 	{
 		parameters.method = SHOGUN_LANDMARK_MULTIDIMENSIONAL_SCALING;
-		parameters.landmark_ratio = float64_t(m_landmark_number)/distance->get_num_vec_lhs();
-		if (parameters.landmark_ratio > 1.0) {
-			io::warn("Number of landmarks ({}) exceeds number of feature vectors ({})",m_landmark_number,distance->get_num_vec_lhs());
-			parameters.landmark_ratio = 1.0;
-		}
+		parameters.landmark_ratio = get_landmark_ratio(distance->get_num_vec_lhs());
 	}
 	else
 	{
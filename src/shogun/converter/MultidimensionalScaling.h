@@ -42,11 +42,14 @@ class Distance;
  * By default euclidean distance is used (with parallel
  * instance replaced by preprocessor's one).
  *
- * Faster landmark approximation is parallel using posix threads.
- * As for choice of landmark number it should be at least 3 for
- * proper triangulation. For reasonable embedding accuracy greater
- * values (30%-50% of total examples number) is pretty good for the
- * most tasks.
+ * Faster landmark approximation is parallel using OpenMP. It
+ * embeds the landmarks with classical scaling and triangulates the
+ * other vectors from their distances to the landmarks, so only
+ * \f$ O(LN) \f$ distances are computed and no \f$ N \times N \f$
+ * matrix is stored. As for choice of landmark number it should be at
+ * least 3 for proper triangulation. For reasonable embedding accuracy
+ * greater values (30%-50% of total examples number) is pretty good for
+ * the most tasks.
  *
  * Uses implementation from the Tapkee library.
  *
@@ -113,6 +116,12 @@ protected:
 	/** default initialization */
 	virtual void init();
 
+	/** ratio of landmarks to vectors, at most one
+	 * @param num_vectors number of vectors to embed
+	 * @return landmark ratio
+	 */
+	float64_t get_landmark_ratio(int32_t num_vectors) const;
+
 /// FIELDS
 protected:
 
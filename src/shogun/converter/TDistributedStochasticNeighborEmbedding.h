@@ -18,7 +18,10 @@ namespace shogun
  * data using t-distributed stochastic neighbor embedding algorithm:
  * http://jmlr.csail.mit.edu/papers/volume9/vandermaaten08a/vandermaaten08a.pdf.
  *
- * Uses implementation from the Tapkee library.
+ * Uses implementation from the Tapkee library. Input similarities, attractive
+ * forces and Barnes-Hut repulsive forces are computed in parallel. Larger data
+ * can use FFT accelerated interpolation of the repulsive forces instead, see
+ * set_interpolation.
  *
  */
 class TDistributedStochasticNeighborEmbedding : public EmbeddingConverter
@@ -64,6 +67,20 @@ public:
 	 */
 	float64_t get_perplexity() const;
 
+	/** setter for interpolation of repulsive forces on a grid, which
+	 * replaces the Barnes-Hut approximation (theta is ignored) and
+	 * supports 2 and 3 target dimensions
+	 *
+	 * @param interpolation whether to interpolate
+	 */
+	void set_interpolation(const bool interpolation);
+
+	/** getter for interpolation of repulsive forces
+	 *
+	 * @return whether to interpolate
+	 */
+	bool get_interpolation() const;
+
 private:
 
 	/** default init */
@@ -77,6 +94,9 @@ private:
 	/** perplexity */
 	float64_t m_perplexity;
 
+	/** interpolate repulsive forces */
+	bool m_interpolation;
+
 }; /* class CTDistributedStochasticNeighborEmbedding */
 
 } /* namespace shogun */
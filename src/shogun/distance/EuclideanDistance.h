@@ -144,6 +144,18 @@ public:
 	 */
 	void precompute_lhs() override;
 
+	/** @return precomputed squared norms of the left hand side features */
+	SGVector<float64_t> get_lhs_squared_norms() const
+	{
+		return m_lhs_squared_norms;
+	}
+
+	/** @return precomputed squared norms of the right hand side features */
+	SGVector<float64_t> get_rhs_squared_norms() const
+	{
+		return m_rhs_squared_norms;
+	}
+
 	/**
 	 * Reset squared norm precomputations for features of both sides
 	 * Should be used to reset whenever features or feature matrix are changed.
@@ -85,9 +85,11 @@ SGMatrix<float64_t> GaussianDistribution::sample(int32_t num_samples,
 	}
 	else
 	{
-		/* allocate memory and sample from std normal */
+		/* allocate memory and sample from std normal, blocks are drawn in
+		 * parallel from substreams, independent of the number of threads */
 		samples=SGMatrix<float64_t>(m_dimension, num_samples);
-		random::fill_array(samples, NormalDistribution<float64_t>(), m_prng);
+		random::fill_array_parallel(
+				samples, NormalDistribution<float64_t>(), counter_prng());
 	}
 
 	/* map into desired Gaussian covariance */
@@ -0,0 +1,54 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/base/ShogunEnv.h>
+#include <shogun/evaluation/BinaryClassEvaluation.h>
+
+#include <algorithm>
+
+using namespace shogun;
+
+SGVector<index_t>
+BinaryClassEvaluation::argsort_descending(const SGVector<float64_t>& outputs)
+{
+	// below this many elements per chunk threads do not pay off
+	constexpr index_t min_chunk_size = 1 << 16;
+
+	SGVector<index_t> idx(outputs.vlen);
+	idx.range_fill();
+	auto greater = [&outputs](index_t a, index_t b) {
+		return outputs[a] > outputs[b];
+	};
+
+	index_t num_chunks = std::min<index_t>(
+	    env()->get_num_threads(), outputs.vlen / min_chunk_size);
+	if (num_chunks <= 1)
+	{
+		std::stable_sort(idx.begin(), idx.end(), greater);
+		return idx;
+	}
+
+	SGVector<index_t> bounds(num_chunks + 1);
+	for (index_t c = 0; c <= num_chunks; ++c)
+		bounds[c] = int64_t(outputs.vlen) * c / num_chunks;
+
+#pragma omp parallel for
+	for (index_t c = 0; c < num_chunks; ++c)
+		std::stable_sort(
+		    idx.begin() + bounds[c], idx.begin() + bounds[c + 1], greater);
+
+	for (index_t width = 1; width < num_chunks; width *= 2)
+	{
+#pragma omp parallel for
+		for (index_t c = 0; c < num_chunks - width; c += 2 * width)
+		{
+			auto last = std::min<index_t>(c + 2 * width, num_chunks);
+			std::inplace_merge(
+			    idx.begin() + bounds[c], idx.begin() + bounds[c + width],
+			    idx.begin() + bounds[last], greater);
+		}
+	}
+
+	return idx;
+}
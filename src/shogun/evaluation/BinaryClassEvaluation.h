@@ -44,6 +44,19 @@ public:
 	{
 		return "BinaryClassEvaluation";
 	}
+
+protected:
+	/** Sorts indices of outputs by decreasing output. Large vectors are
+	 * sorted in parallel: chunks are sorted per thread and then merged
+	 * pairwise, with the merges of one round running in parallel. Sorting
+	 * and merging are stable, so equal outputs stay in index order and
+	 * the result does not depend on the number of threads.
+	 *
+	 * @param outputs values to sort by
+	 * @return indices of outputs in descending order
+	 */
+	static SGVector<index_t>
+	argsort_descending(const SGVector<float64_t>& outputs);
 };
 
 }
@@ -11,6 +11,7 @@
 #include <shogun/evaluation/CrossValidationStorage.h>
 #include <shogun/evaluation/Evaluation.h>
 #include <shogun/evaluation/SplittingStrategy.h>
+#include <shogun/kernel/Kernel.h>
 #include <shogun/lib/observers/ObservedValueTemplated.h>
 #include <shogun/machine/Machine.h>
 #include <shogun/mathematics/Statistics.h>
@@ -50,19 +51,30 @@ CrossValidation::~CrossValidation()
 void CrossValidation::init()
 {
 	m_num_runs = 1;
+	m_precompute_kernel = false;
 
 	SG_ADD(&m_num_runs, kNumRuns, "Number of repetitions");
+	SG_ADD(
+	    &m_precompute_kernel, kPrecomputeKernel,
+	    "Whether to share one precomputed kernel matrix between folds",
+	    ParameterProperties::SETTING);
 }
 
 std::shared_ptr<EvaluationResult> CrossValidation::evaluate_impl() const
 {
 	SGVector<float64_t> results(m_num_runs);
 
+	/* kernel values are computed once for all folds and runs */
+	SGMatrix<float32_t> kernel_matrix;
+	if (m_precompute_kernel)
+		kernel_matrix =
+		    precompute_kernel_matrix(m_machine->get<Kernel>("kernel"));
+
 	/* perform all the x-val runs */
 	SG_DEBUG("starting {} runs of cross-validation", m_num_runs);
 	for (auto i : SG_PROGRESS(range(m_num_runs)))
 	{
-		results[i] = evaluate_one_run(i);
+		results[i] = evaluate_one_run(i, kernel_matrix);
 		io::info("Result of cross-validation run {}/{} is {}", i+1, m_num_runs, results[i]);
 	}
 
@@ -85,7 +97,13 @@ void CrossValidation::set_num_runs(int32_t num_runs)
 	m_num_runs = num_runs;
 }
 
-float64_t CrossValidation::evaluate_one_run(int64_t index) const
+void CrossValidation::set_precompute_kernel(bool precompute_kernel)
+{
+	m_precompute_kernel = precompute_kernel;
+}
+
+float64_t CrossValidation::evaluate_one_run(
+    int64_t index, const SGMatrix<float32_t>& kernel_matrix) const
 {
 	SG_TRACE("entering {}::evaluate_one_run()", get_name());
 	index_t num_subsets = m_splitting_strategy->get_num_subsets();
@@ -95,6 +113,9 @@ float64_t CrossValidation::evaluate_one_run(int64_t index) const
 
 	SGVector<float64_t> results(num_subsets);
 
+	/* with a precomputed kernel, folds index into it through IndexFeatures */
+	auto features = kernel_matrix.matrix ? get_index_features() : m_features;
+
 	#pragma omp parallel for shared(results)
 	for (auto i = 0; i<num_subsets; ++i)
 	{
@@ -102,6 +123,8 @@ float64_t CrossValidation::evaluate_one_run(int64_t index) const
 		// model parameters are inferred/learned during training
 		auto machine = make_clone(m_machine,
 				ParameterProperties::HYPER | ParameterProperties::SETTING);
+		if (kernel_matrix.matrix)
+			set_precomputed_kernel(machine, kernel_matrix);
 
 		SGVector<index_t> idx_train =
 			m_splitting_strategy->generate_subset_inverse(i);
@@ -109,9 +132,9 @@ float64_t CrossValidation::evaluate_one_run(int64_t index) const
 		SGVector<index_t> idx_test =
 			m_splitting_strategy->generate_subset_indices(i);
 
-		auto features_train = view(m_features, idx_train);
+		auto features_train = view(features, idx_train);
 		auto labels_train = view(m_labels, idx_train);
-		auto features_test = view(m_features, idx_test);
+		auto features_test = view(features, idx_test);
 		auto labels_test = view(m_labels, idx_test);
 
 		auto evaluation_criterion = make_clone(m_evaluation_criterion);
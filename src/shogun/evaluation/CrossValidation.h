@@ -159,6 +159,15 @@ namespace shogun
 		/** setter for the number of runs to use for evaluation */
 		void set_num_runs(int32_t num_runs);
 
+		/** Whether to compute the kernel matrix of a kernel machine once
+		 * for all folds and runs. Folds then train and test on views of
+		 * IndexFeatures with a CustomKernel that shares the matrix, which
+		 * needs quadratic memory in the number of vectors.
+		 *
+		 * @param precompute_kernel whether to precompute the kernel matrix
+		 */
+		void set_precompute_kernel(bool precompute_kernel);
+
 		/** @return name of the SGSerializable */
 		const char* get_name() const override
 		{
@@ -182,16 +191,25 @@ namespace shogun
 		 * F1-measure. Has to be overridden by sub-classes if results have to be
 		 * merged differently
 		 *
+		 * @param index index of the run
+		 * @param kernel_matrix precomputed kernel matrix of all features,
+		 * empty if the machine's kernel is to be used
 		 * @return evaluation result of one cross-validation run
 		 */
-		float64_t evaluate_one_run(int64_t index) const;
+		float64_t evaluate_one_run(
+		    int64_t index,
+		    const SGMatrix<float32_t>& kernel_matrix = SGMatrix<float32_t>()) const;
 
 		/** number of evaluation runs for one fold */
 		int32_t m_num_runs;
 
+		/** whether to share one precomputed kernel matrix between folds */
+		bool m_precompute_kernel;
+
 	#ifndef SWIG
 	public:
 		static constexpr std::string_view kNumRuns = "num_runs";
+		static constexpr std::string_view kPrecomputeKernel = "precompute_kernel";
 	#endif
 	};
 }
@@ -0,0 +1,457 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/evaluation/HyperParameterSearch.h>
+
+#include <shogun/evaluation/Evaluation.h>
+#include <shogun/evaluation/SplittingStrategy.h>
+#include <shogun/kernel/Kernel.h>
+#include <shogun/lib/View.h>
+#include <shogun/machine/Machine.h>
+#include <shogun/mathematics/Statistics.h>
+#include <shogun/mathematics/UniformIntDistribution.h>
+#include <shogun/mathematics/UniformRealDistribution.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <numeric>
+#include <utility>
+
+using namespace shogun;
+
+static constexpr std::string_view kernel_prefix = "kernel::";
+
+static bool is_kernel_parameter(const std::string& name)
+{
+	return name.compare(0, kernel_prefix.size(), kernel_prefix) == 0;
+}
+
+HyperParameterSearch::HyperParameterSearch()
+    : RandomMixin<MachineEvaluation>()
+{
+	init();
+}
+
+HyperParameterSearch::HyperParameterSearch(
+    std::shared_ptr<Machine> machine, std::shared_ptr<Features> features,
+    std::shared_ptr<Labels> labels,
+    std::shared_ptr<SplittingStrategy> splitting_strategy,
+    std::shared_ptr<Evaluation> evaluation_criterion)
+    : RandomMixin<MachineEvaluation>(
+          std::move(machine), std::move(features), std::move(labels),
+          std::move(splitting_strategy), std::move(evaluation_criterion))
+{
+	init();
+}
+
+HyperParameterSearch::~HyperParameterSearch()
+{
+}
+
+void HyperParameterSearch::init()
+{
+	m_strategy = HPS_GRID;
+	m_num_candidates = 10;
+	m_successive_halving = false;
+	m_min_iterations = 1;
+	m_reduction_factor = 3;
+	m_refit = true;
+	m_precompute_kernel = false;
+
+	SG_ADD_OPTIONS(
+	    (machine_int_t*)&m_strategy, kStrategy,
+	    "Candidate generation strategy", ParameterProperties::SETTING,
+	    SG_OPTIONS(HPS_GRID, HPS_RANDOM));
+	SG_ADD(
+	    &m_num_candidates, kNumCandidates,
+	    "Number of candidates drawn by random search",
+	    ParameterProperties::SETTING | ParameterProperties::CONSTRAIN,
+	    SG_CONSTRAINT(positive<>()));
+	SG_ADD(
+	    &m_successive_halving, kSuccessiveHalving,
+	    "Whether to use successive halving on the number of iterations",
+	    ParameterProperties::SETTING);
+	SG_ADD(
+	    &m_min_iterations, kMinIterations,
+	    "Budget of the first successive halving round",
+	    ParameterProperties::SETTING | ParameterProperties::CONSTRAIN,
+	    SG_CONSTRAINT(positive<>()));
+	SG_ADD(
+	    &m_reduction_factor, kReductionFactor,
+	    "Successive halving keeps 1/reduction_factor candidates per round",
+	    ParameterProperties::SETTING | ParameterProperties::CONSTRAIN,
+	    SG_CONSTRAINT(greater_than_or_equal<int32_t>(2)));
+	SG_ADD(
+	    &m_refit, kRefit, "Whether to train the best candidate on all data",
+	    ParameterProperties::SETTING);
+	SG_ADD(
+	    &m_precompute_kernel, kPrecomputeKernel,
+	    "Whether to share precomputed kernel matrices between candidates",
+	    ParameterProperties::SETTING);
+}
+
+void HyperParameterSearch::add_parameter(
+    std::string_view name, SGVector<float64_t> values)
+{
+	require(values.vlen > 0, "No values provided for parameter {}", name);
+
+	m_names.emplace_back(name);
+	m_values.push_back(values);
+	m_low.push_back(0);
+	m_high.push_back(0);
+	m_log_scale.push_back(false);
+}
+
+void HyperParameterSearch::add_parameter_range(
+    std::string_view name, float64_t low, float64_t high, bool log_scale)
+{
+	require(
+	    low <= high, "Lower end ({}) of range of parameter {} exceeds upper "
+	                 "end ({})",
+	    low, name, high);
+	require(
+	    !log_scale || low > 0,
+	    "Log scaled range of parameter {} has to be positive", name);
+
+	m_names.emplace_back(name);
+	m_values.emplace_back();
+	m_low.push_back(low);
+	m_high.push_back(high);
+	m_log_scale.push_back(log_scale);
+}
+
+SGMatrix<float64_t> HyperParameterSearch::generate_candidates() const
+{
+	const index_t num_params = m_names.size();
+	SGMatrix<float64_t> candidates;
+
+	switch (m_strategy)
+	{
+	case HPS_GRID:
+	{
+		index_t num_candidates = 1;
+		for (index_t p = 0; p < num_params; ++p)
+		{
+			require(
+			    m_values[p].vlen > 0,
+			    "Parameter ranges ({}) are only supported by random search",
+			    m_names[p]);
+			num_candidates *= m_values[p].vlen;
+		}
+
+		// mixed radix enumeration, first parameter varies fastest
+		candidates = SGMatrix<float64_t>(num_params, num_candidates);
+		for (index_t c = 0; c < num_candidates; ++c)
+		{
+			auto rest = c;
+			for (index_t p = 0; p < num_params; ++p)
+			{
+				candidates(p, c) = m_values[p][rest % m_values[p].vlen];
+				rest /= m_values[p].vlen;
+			}
+		}
+		break;
+	}
+	case HPS_RANDOM:
+	{
+		candidates = SGMatrix<float64_t>(num_params, m_num_candidates);
+		for (index_t c = 0; c < m_num_candidates; ++c)
+		{
+			for (index_t p = 0; p < num_params; ++p)
+			{
+				if (m_values[p].vlen > 0)
+				{
+					UniformIntDistribution<index_t> uniform(
+					    0, m_values[p].vlen - 1);
+					candidates(p, c) = m_values[p][uniform(m_prng)];
+				}
+				else if (m_log_scale[p])
+				{
+					UniformRealDistribution<float64_t> uniform(
+					    std::log(m_low[p]), std::log(m_high[p]));
+					candidates(p, c) = std::exp(uniform(m_prng));
+				}
+				else
+				{
+					UniformRealDistribution<float64_t> uniform(
+					    m_low[p], m_high[p]);
+					candidates(p, c) = uniform(m_prng);
+				}
+			}
+		}
+		break;
+	}
+	default:
+		error("Search strategy {} not supported", m_strategy);
+	}
+
+	return candidates;
+}
+
+void HyperParameterSearch::set_parameter(
+    std::shared_ptr<SGObject> obj, std::string_view name, float64_t value)
+{
+	static constexpr std::string_view separator = "::";
+
+	auto pos = name.find(separator);
+	while (pos != std::string_view::npos)
+	{
+		auto part = name.substr(0, pos);
+		auto child = obj->get(part);
+		require(
+		    child, "{}::{} is not set, cannot set its parameters",
+		    obj->get_name(), part);
+		obj = child;
+		name = name.substr(pos + separator.size());
+		pos = name.find(separator);
+	}
+
+	// option parameters are integers that have to be one of the options
+	const auto options = obj->get_string_to_enum_map();
+	auto it = options.find(name);
+	if (it != options.end())
+	{
+		auto option = (machine_int_t)std::lround(value);
+		require(
+		    std::any_of(
+		        it->second.begin(), it->second.end(),
+		        [option](const auto& entry) { return entry.second == option; }),
+		    "{} is not an option of {}::{}", option, obj->get_name(), name);
+		obj->put(name, option);
+		return;
+	}
+
+	if (obj->has<float64_t>(name))
+		obj->put(name, value);
+	else if (obj->has<float32_t>(name))
+		obj->put(name, (float32_t)value);
+	else if (obj->has<int32_t>(name))
+		obj->put(name, (int32_t)std::lround(value));
+	else if (obj->has<int64_t>(name))
+		obj->put(name, (int64_t)std::llround(value));
+	else if (obj->has<bool>(name))
+		obj->put(name, value != 0);
+	else
+		error(
+		    "{} has no floating point, integer, boolean or option parameter {}",
+		    obj->get_name(), name);
+}
+
+void HyperParameterSearch::apply_candidate(
+    const std::shared_ptr<Machine>& machine,
+    const SGVector<float64_t>& candidate, bool skip_kernel) const
+{
+	for (index_t p = 0; p < (index_t)m_names.size(); ++p)
+	{
+		if (skip_kernel && is_kernel_parameter(m_names[p]))
+			continue;
+		set_parameter(machine, m_names[p], candidate[p]);
+	}
+}
+
+std::vector<SGMatrix<float32_t>> HyperParameterSearch::precompute_kernels(
+    const SGMatrix<float64_t>& candidates, SGVector<index_t>& groups) const
+{
+	auto kernel = m_machine->get<Kernel>("kernel");
+	require(kernel, "Kernel precomputation requires a kernel machine");
+
+	std::vector<index_t> kernel_params;
+	for (index_t p = 0; p < (index_t)m_names.size(); ++p)
+	{
+		if (is_kernel_parameter(m_names[p]))
+			kernel_params.push_back(p);
+	}
+
+	std::map<std::vector<float64_t>, index_t> group_of;
+	std::vector<SGMatrix<float32_t>> kernel_matrices;
+	groups = SGVector<index_t>(candidates.num_cols);
+	for (index_t c = 0; c < candidates.num_cols; ++c)
+	{
+		std::vector<float64_t> key;
+		for (auto p : kernel_params)
+			key.push_back(candidates(p, c));
+
+		auto it = group_of.find(key);
+		if (it != group_of.end())
+		{
+			groups[c] = it->second;
+			continue;
+		}
+
+		auto group_kernel = make_clone(
+		    kernel, ParameterProperties::HYPER | ParameterProperties::SETTING);
+		for (auto p : kernel_params)
+			set_parameter(
+			    group_kernel, std::string_view(m_names[p]).substr(
+			                      kernel_prefix.size()),
+			    candidates(p, c));
+
+		kernel_matrices.push_back(precompute_kernel_matrix(group_kernel));
+
+		groups[c] = group_of[key] = kernel_matrices.size() - 1;
+	}
+
+	SG_DEBUG(
+	    "precomputed {} kernel matrices for {} candidates",
+	    kernel_matrices.size(), candidates.num_cols);
+	return kernel_matrices;
+}
+
+std::shared_ptr<EvaluationResult> HyperParameterSearch::evaluate_impl() const
+{
+	require(!m_names.empty(), "No parameters to search over");
+
+	auto candidates = generate_candidates();
+	const index_t num_candidates = candidates.num_cols;
+
+	// fail on unknown parameters before any job is started
+	apply_candidate(
+	    make_clone(
+	        m_machine,
+	        ParameterProperties::HYPER | ParameterProperties::SETTING),
+	    candidates.get_column(0), false);
+
+	int32_t max_iterations = 0;
+	int32_t budget = 0;
+	if (m_successive_halving)
+	{
+		require(
+		    m_machine->has<int32_t>("max_iterations"),
+		    "Successive halving requires an iterative machine, {} has no "
+		    "max_iterations",
+		    m_machine->get_name());
+		max_iterations = m_machine->get<int32_t>("max_iterations");
+		budget = std::min(m_min_iterations, max_iterations);
+	}
+
+	// shared kernel matrices index the vectors through IndexFeatures
+	SGVector<index_t> groups;
+	std::vector<SGMatrix<float32_t>> kernel_matrices;
+	auto features = m_features;
+	if (m_precompute_kernel)
+	{
+		kernel_matrices = precompute_kernels(candidates, groups);
+		features = get_index_features();
+	}
+
+	const index_t num_folds = m_splitting_strategy->get_num_subsets();
+	SG_DEBUG("building index sets for {}-fold cross-validation", num_folds)
+	m_splitting_strategy->build_subsets();
+
+	std::vector<SGVector<index_t>> idx_train(num_folds), idx_test(num_folds);
+	for (index_t f = 0; f < num_folds; ++f)
+	{
+		idx_train[f] = m_splitting_strategy->generate_subset_inverse(f);
+		idx_test[f] = m_splitting_strategy->generate_subset_indices(f);
+	}
+
+	// machines are kept between successive halving rounds to resume training
+	std::vector<std::shared_ptr<Machine>> machines(num_candidates * num_folds);
+	SGMatrix<float64_t> fold_scores(num_folds, num_candidates);
+	SGVector<float64_t> scores(num_candidates);
+	SGVector<int32_t> budgets(num_candidates);
+	budgets.zero();
+
+	std::vector<index_t> alive(num_candidates);
+	std::iota(alive.begin(), alive.end(), 0);
+
+	const bool maximize = get_evaluation_direction() == ED_MAXIMIZE;
+	while (true)
+	{
+		const index_t num_jobs = alive.size() * num_folds;
+
+#pragma omp parallel for schedule(dynamic)
+		for (index_t job = 0; job < num_jobs; ++job)
+		{
+			auto c = alive[job / num_folds];
+			auto f = job % num_folds;
+			auto& machine = machines[c * num_folds + f];
+
+			auto features_train = view(features, idx_train[f]);
+			auto features_test = view(features, idx_test[f]);
+			auto labels_train = view(m_labels, idx_train[f]);
+			auto labels_test = view(m_labels, idx_test[f]);
+
+			if (!machine)
+			{
+				// only need to clone hyperparameters and settings of machine
+				machine = make_clone(
+				    m_machine,
+				    ParameterProperties::HYPER | ParameterProperties::SETTING);
+				apply_candidate(
+				    machine, candidates.get_column(c), m_precompute_kernel);
+
+				if (m_precompute_kernel)
+					set_precomputed_kernel(machine, kernel_matrices[groups[c]]);
+				if (m_successive_halving)
+					machine->put("max_iterations", budget);
+
+				machine->set_labels(labels_train);
+				machine->train(features_train);
+			}
+			else
+			{
+				// applying may have replaced the training features
+				if (machine->has<Features>("features"))
+					machine->put("features", features_train);
+				machine->put("max_iterations", budget);
+				machine->continue_train();
+			}
+
+			auto evaluation_criterion = make_clone(m_evaluation_criterion);
+			auto result_labels = machine->apply(features_test);
+			fold_scores(f, c) =
+			    evaluation_criterion->evaluate(result_labels, labels_test);
+		}
+
+		for (auto c : alive)
+		{
+			scores[c] = Statistics::mean(SGVector<float64_t>(
+			    fold_scores.get_column_vector(c), num_folds, false));
+			budgets[c] = budget;
+		}
+
+		std::sort(alive.begin(), alive.end(), [&](index_t a, index_t b) {
+			return maximize ? scores[a] > scores[b] : scores[a] < scores[b];
+		});
+
+		if (!m_successive_halving || budget >= max_iterations ||
+		    alive.size() == 1)
+			break;
+
+		index_t num_alive =
+		    (alive.size() + m_reduction_factor - 1) / m_reduction_factor;
+		for (auto it = alive.begin() + num_alive; it != alive.end(); ++it)
+		{
+			for (index_t f = 0; f < num_folds; ++f)
+				machines[*it * num_folds + f].reset();
+		}
+		alive.resize(num_alive);
+
+		io::info(
+		    "Successive halving: {} candidates remain after {} iterations",
+		    num_alive, budget);
+		budget = (int32_t)std::min<int64_t>(
+		    (int64_t)budget * m_reduction_factor, max_iterations);
+	}
+
+	auto best = alive.front();
+	io::info(
+	    "Best of {} candidates is {} with score {}", num_candidates, best + 1,
+	    scores[best]);
+
+	auto best_machine = make_clone(
+	    m_machine, ParameterProperties::HYPER | ParameterProperties::SETTING);
+	apply_candidate(best_machine, candidates.get_column(best), false);
+	if (m_refit)
+	{
+		best_machine->set_labels(m_labels);
+		best_machine->train(m_features);
+	}
+
+	auto result = std::make_shared<HyperParameterSearchResult>();
+	result->set_results(candidates, scores, budgets, best, best_machine);
+	return result;
+}
@@ -0,0 +1,306 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef __HYPERPARAMETERSEARCH_H_
+#define __HYPERPARAMETERSEARCH_H_
+
+#include <shogun/lib/config.h>
+
+#include <shogun/evaluation/EvaluationResult.h>
+#include <shogun/evaluation/MachineEvaluation.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/machine/Machine.h>
+#include <shogun/mathematics/RandomMixin.h>
+
+#include <string>
+#include <vector>
+
+namespace shogun
+{
+	/** Candidate generation strategy of HyperParameterSearch */
+	enum EHyperParameterSearchStrategy
+	{
+		/** all combinations of the given parameter values */
+		HPS_GRID = 10,
+		/** a fixed number of randomly drawn combinations */
+		HPS_RANDOM = 20
+	};
+
+	/** @brief Result of a HyperParameterSearch: all evaluated candidates,
+	 * their cross-validated scores and the best machine.
+	 */
+	class HyperParameterSearchResult : public EvaluationResult
+	{
+	public:
+		HyperParameterSearchResult()
+		{
+			m_best_index = -1;
+
+			SG_ADD(
+			    &m_candidates, "candidates",
+			    "Parameter values, one column per candidate");
+			SG_ADD(&m_scores, "scores", "Mean score of each candidate");
+			SG_ADD(
+			    &m_budgets, "budgets",
+			    "Number of iterations each candidate was last evaluated with");
+			SG_ADD(&m_best_index, "best_index", "Index of best candidate");
+			SG_ADD(&m_best_machine, "best_machine", "Best machine");
+		}
+
+		/** @return name of the SGSerializable */
+		const char* get_name() const override
+		{
+			return "HyperParameterSearchResult";
+		}
+
+		/** print result */
+		void print_result() override
+		{
+			io::print(
+			    "best candidate {}/{} with score {}\n", m_best_index + 1,
+			    m_scores.vlen, get_best_score());
+		}
+
+		/** @return parameter values, one column per candidate */
+		SGMatrix<float64_t> get_candidates() const
+		{
+			return m_candidates;
+		}
+
+		/** @return cross-validated mean score of each candidate */
+		SGVector<float64_t> get_scores() const
+		{
+			return m_scores;
+		}
+
+		/** @return iterations each candidate was last evaluated with, zero
+		 * if no budget was imposed
+		 */
+		SGVector<int32_t> get_budgets() const
+		{
+			return m_budgets;
+		}
+
+		/** @return index of the best candidate */
+		index_t get_best_index() const
+		{
+			return m_best_index;
+		}
+
+		/** @return parameter values of the best candidate */
+		SGVector<float64_t> get_best_parameters() const
+		{
+			return m_candidates.get_column(m_best_index);
+		}
+
+		/** @return score of the best candidate */
+		float64_t get_best_score() const
+		{
+			return m_scores[m_best_index];
+		}
+
+		/** @return machine configured with the best candidate, trained on
+		 * all data if refitting was enabled
+		 */
+		std::shared_ptr<Machine> get_best_machine() const
+		{
+			return m_best_machine;
+		}
+
+		/** set all results at once */
+		void set_results(
+		    SGMatrix<float64_t> candidates, SGVector<float64_t> scores,
+		    SGVector<int32_t> budgets, index_t best_index,
+		    std::shared_ptr<Machine> best_machine)
+		{
+			m_candidates = candidates;
+			m_scores = scores;
+			m_budgets = budgets;
+			m_best_index = best_index;
+			m_best_machine = std::move(best_machine);
+		}
+
+	private:
+		SGMatrix<float64_t> m_candidates;
+		SGVector<float64_t> m_scores;
+		SGVector<int32_t> m_budgets;
+		index_t m_best_index;
+		std::shared_ptr<Machine> m_best_machine;
+	};
+
+	/** @brief Cross-validated search over hyper-parameters of a machine.
+	 *
+	 * Candidate values are registered by parameter name and applied through
+	 * the put/get parameter API, nested parameters are addressed with "::",
+	 * e.g. "kernel::width". Candidates are either all combinations of the
+	 * given values (HPS_GRID) or a number of random draws (HPS_RANDOM), in
+	 * which case continuous ranges may be sampled as well.
+	 *
+	 * All (candidate, fold) pairs are independent jobs that are scheduled
+	 * dynamically over all threads, rather than parallelising only over
+	 * the folds of one candidate as CrossValidation does.
+	 *
+	 * Two kinds of work are shared between candidates:
+	 *  - with precompute_kernel enabled, candidates that agree in all
+	 *    "kernel::" parameters (e.g. a grid over C of an SVM) use one kernel
+	 *    matrix of all features, computed once, instead of computing kernel
+	 *    rows in every training of every fold.
+	 *  - with successive_halving enabled, machines with a "max_iterations"
+	 *    parameter (IterativeMachine) are first trained with a budget of
+	 *    min_iterations, and only the best 1/reduction_factor of candidates
+	 *    continue training with reduction_factor times the budget, up to the
+	 *    max_iterations of the machine. Training is resumed with
+	 *    continue_train, so no iterations are repeated.
+	 *
+	 * Jamieson, K., & Talwalkar, A. (2016). Non-stochastic best arm
+	 * identification and hyperparameter optimization. AISTATS.
+	 */
+	class HyperParameterSearch : public RandomMixin<MachineEvaluation>
+	{
+	public:
+		/** constructor */
+		HyperParameterSearch();
+
+		/** constructor
+		 * @param machine learning machine to tune
+		 * @param features features to use for cross-validation
+		 * @param labels labels that correspond to the features
+		 * @param splitting_strategy splitting strategy to use
+		 * @param evaluation_criterion evaluation criterion to use
+		 */
+		HyperParameterSearch(
+		    std::shared_ptr<Machine> machine, std::shared_ptr<Features> features,
+		    std::shared_ptr<Labels> labels,
+		    std::shared_ptr<SplittingStrategy> splitting_strategy,
+		    std::shared_ptr<Evaluation> evaluation_criterion);
+
+		~HyperParameterSearch() override;
+
+		/** Adds a parameter with a discrete set of candidate values.
+		 * Values are converted to the type of the parameter, which has to
+		 * be a floating point, integer, boolean or option parameter.
+		 *
+		 * @param name parameter name, nested parameters separated by "::"
+		 * @param values candidate values
+		 */
+		void add_parameter(std::string_view name, SGVector<float64_t> values);
+
+		/** Adds a parameter sampled from a continuous range, only possible
+		 * with random search.
+		 *
+		 * @param name parameter name, nested parameters separated by "::"
+		 * @param low lower end of range
+		 * @param high upper end of range
+		 * @param log_scale whether to sample uniformly in log space
+		 */
+		void add_parameter_range(
+		    std::string_view name, float64_t low, float64_t high,
+		    bool log_scale = false);
+
+		/** @return names of the parameters, in the row order of the
+		 * candidates of the result
+		 */
+		std::vector<std::string> get_parameter_names() const
+		{
+			return m_names;
+		}
+
+		/** @return name of the SGSerializable */
+		const char* get_name() const override
+		{
+			return "HyperParameterSearch";
+		}
+
+	private:
+		void init() override;
+
+	protected:
+		std::shared_ptr<EvaluationResult> evaluate_impl() const override;
+
+		/** @return candidate parameter values, one column per candidate */
+		SGMatrix<float64_t> generate_candidates() const;
+
+		/** Sets all parameters of a candidate on a machine.
+		 * @param machine machine to configure
+		 * @param candidate parameter values
+		 * @param skip_kernel whether to leave "kernel::" parameters out
+		 */
+		void apply_candidate(
+		    const std::shared_ptr<Machine>& machine,
+		    const SGVector<float64_t>& candidate, bool skip_kernel) const;
+
+		/** Sets a possibly nested parameter, converting the value to the
+		 * type of the parameter.
+		 */
+		static void set_parameter(
+		    std::shared_ptr<SGObject> obj, std::string_view name,
+		    float64_t value);
+
+		/** Computes one kernel matrix of all features for each group of
+		 * candidates with equal "kernel::" parameters.
+		 *
+		 * @param candidates all candidates
+		 * @param groups group index of each candidate, output
+		 * @return kernel matrix of each group
+		 */
+		std::vector<SGMatrix<float32_t>> precompute_kernels(
+		    const SGMatrix<float64_t>& candidates,
+		    SGVector<index_t>& groups) const;
+
+	protected:
+		/** candidate generation strategy */
+		EHyperParameterSearchStrategy m_strategy;
+
+		/** number of candidates drawn by random search */
+		int32_t m_num_candidates;
+
+		/** whether to use successive halving on the number of iterations */
+		bool m_successive_halving;
+
+		/** budget of the first successive halving round */
+		int32_t m_min_iterations;
+
+		/** successive halving keeps 1/reduction_factor of the candidates
+		 * per round
+		 */
+		int32_t m_reduction_factor;
+
+		/** whether to train the best candidate on all data */
+		bool m_refit;
+
+		/** whether to share precomputed kernel matrices between candidates */
+		bool m_precompute_kernel;
+
+		/** parameter names */
+		std::vector<std::string> m_names;
+
+		/** discrete candidate values of each parameter, empty for ranges */
+		std::vector<SGVector<float64_t>> m_values;
+
+		/** lower end of parameter ranges */
+		std::vector<float64_t> m_low;
+
+		/** upper end of parameter ranges */
+		std::vector<float64_t> m_high;
+
+		/** whether parameter ranges are log scaled */
+		std::vector<bool> m_log_scale;
+
+#ifndef SWIG
+	public:
+		static constexpr std::string_view kStrategy = "strategy";
+		static constexpr std::string_view kNumCandidates = "num_candidates";
+		static constexpr std::string_view kSuccessiveHalving =
+		    "successive_halving";
+		static constexpr std::string_view kMinIterations = "min_iterations";
+		static constexpr std::string_view kReductionFactor = "reduction_factor";
+		static constexpr std::string_view kRefit = "refit";
+		static constexpr std::string_view kPrecomputeKernel =
+		    "precompute_kernel";
+#endif
+	};
+}
+
+#endif /* __HYPERPARAMETERSEARCH_H_ */
@@ -8,6 +8,8 @@
 #include <shogun/evaluation/Evaluation.h>
 #include <shogun/evaluation/MachineEvaluation.h>
 #include <shogun/evaluation/SplittingStrategy.h>
+#include <shogun/features/IndexFeatures.h>
+#include <shogun/kernel/CustomKernel.h>
 #include <shogun/machine/Machine.h>
 #include <shogun/mathematics/Statistics.h>
 
@@ -104,3 +106,42 @@ EEvaluationDirection MachineEvaluation::get_evaluation_direction() const
 {
 	return m_evaluation_criterion->get_evaluation_direction();
 }
+
+SGMatrix<float32_t> MachineEvaluation::precompute_kernel_matrix(
+    const std::shared_ptr<Kernel>& kernel) const
+{
+	require(kernel, "No kernel to precompute");
+
+	auto cloned = make_clone(
+	    kernel, ParameterProperties::HYPER | ParameterProperties::SETTING);
+	cloned->init(m_features, m_features);
+	auto kernel_matrix = cloned->get_kernel_matrix<float32_t>();
+	cloned->cleanup();
+
+	SG_DEBUG(
+	    "precomputed {}x{} kernel matrix", kernel_matrix.num_rows,
+	    kernel_matrix.num_cols);
+	return kernel_matrix;
+}
+
+std::shared_ptr<Features> MachineEvaluation::get_index_features() const
+{
+	SGVector<index_t> all(m_features->get_num_vectors());
+	all.range_fill();
+	return std::make_shared<IndexFeatures>(all);
+}
+
+void MachineEvaluation::set_precomputed_kernel(
+    const std::shared_ptr<Machine>& machine,
+    const SGMatrix<float32_t>& kernel_matrix)
+{
+	require(
+	    machine->has<Kernel>("kernel"),
+	    "{} is no kernel machine, cannot use a precomputed kernel",
+	    machine->get_name());
+
+	auto kernel = std::make_shared<CustomKernel>();
+	kernel->set_full_kernel_matrix_from_full(kernel_matrix);
+	kernel->put("is_symmetric", true);
+	machine->put("kernel", std::shared_ptr<Kernel>(kernel));
+}
@@ -11,6 +11,7 @@
 #include <shogun/evaluation/Evaluation.h>
 #include <shogun/evaluation/EvaluationResult.h>
 #include <shogun/evaluation/MachineEvaluation.h>
+#include <shogun/lib/SGMatrix.h>
 #include <shogun/lib/StoppableSGObject.h>
 #include <shogun/lib/config.h>
 
@@ -21,6 +22,7 @@ namespace shogun
 	class Labels;
 	class SplittingStrategy;
 	class Evaluation;
+	class Kernel;
 
 	/** @brief Machine Evaluation is an abstract class
 	 * that evaluates a machine according to some criterion.
@@ -88,6 +90,32 @@ namespace shogun
 		 */
 		virtual std::shared_ptr<EvaluationResult> evaluate_impl() const = 0;
 
+		/** Computes the kernel matrix of all features, so that training and
+		 * testing on any split only indexes into it. Needs quadratic memory
+		 * in the number of vectors.
+		 *
+		 * @param kernel kernel to evaluate, a clone of it is initialized
+		 * @return kernel matrix in single precision, as used by CustomKernel
+		 */
+		SGMatrix<float32_t>
+		precompute_kernel_matrix(const std::shared_ptr<Kernel>& kernel) const;
+
+		/** @return IndexFeatures of all vectors, views of which select the
+		 * rows and columns of a precomputed kernel matrix
+		 */
+		std::shared_ptr<Features> get_index_features() const;
+
+		/** Replaces the kernel of a machine by a CustomKernel that shares
+		 * (does not copy) a precomputed kernel matrix. The machine then has
+		 * to be trained and applied on views of get_index_features().
+		 *
+		 * @param machine kernel machine
+		 * @param kernel_matrix kernel matrix of all features
+		 */
+		static void set_precomputed_kernel(
+		    const std::shared_ptr<Machine>& machine,
+		    const SGMatrix<float32_t>& kernel_matrix);
+
 		/** connect the machine instance to the signal handler */
 	protected:
 		/** Machine to be Evaluated */
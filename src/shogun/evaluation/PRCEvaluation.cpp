@@ -36,35 +36,27 @@ float64_t PRCEvaluation::evaluate(std::shared_ptr<Labels> predicted, std::shared
 
 	// number of true positive examples
 	float64_t tp = 0.0;
-	int32_t i;
 
 	// total number of positive labels in predicted
-	int32_t pos_count = 0;
+	index_t pos_count = 0;
 
-	// initialize number of labels and labels
-	SGVector<float64_t> orig_labels = predicted->get_values();
-	int32_t length = orig_labels.vlen;
-	float64_t* labels =
-	    SGVector<float64_t>::clone_vector(orig_labels.vector, length);
+	SGVector<float64_t> outputs = predicted->get_values();
+	SGVector<float64_t> truth = ground_truth->get_values();
+	index_t length = outputs.vlen;
 
-	// get indexes for sort
-	int32_t* idxs = SG_MALLOC(int32_t, length);
-	for (i = 0; i < length; i++)
-		idxs[i] = i;
-
-	// sort indexes by labels ascending
-	Math::qsort_backward_index(labels, idxs, length);
+	// sort indexes by labels descending
+	SGVector<index_t> idxs = argsort_descending(outputs);
 
 	// clean and initialize graph and auPRC
-	SG_FREE(labels);
 	m_PRC_graph = SGMatrix<float64_t>(2, length);
 	m_thresholds = SGVector<float64_t>(length);
 	m_auPRC = 0.0;
 
 	// get total numbers of positive and negative labels
-	for (i = 0; i < length; i++)
+#pragma omp parallel for reduction(+ : pos_count)
+	for (index_t i = 0; i < length; i++)
 	{
-		if (ground_truth->get_value(i) > 0)
+		if (truth[i] > 0)
 			pos_count++;
 	}
 
@@ -72,10 +64,10 @@ float64_t PRCEvaluation::evaluate(std::shared_ptr<Labels> predicted, std::shared
 	ASSERT(pos_count > 0)
 
 	// create PRC curve
-	for (i = 0; i < length; i++)
+	for (index_t i = 0; i < length; i++)
 	{
 		// update number of true positive examples
-		if (ground_truth->get_value(idxs[i]) > 0)
+		if (truth[idxs[i]] > 0)
 			tp += 1.0;
 
 		// precision (x)
@@ -83,7 +75,7 @@ float64_t PRCEvaluation::evaluate(std::shared_ptr<Labels> predicted, std::shared
 		// recall (y)
 		m_PRC_graph[2 * i + 1] = tp / float64_t(pos_count);
 
-		m_thresholds[i] = predicted->get_value(idxs[i]);
+		m_thresholds[i] = outputs[idxs[i]];
 	}
 
 	// calc auRPC using area under curve
@@ -92,7 +84,6 @@ float64_t PRCEvaluation::evaluate(std::shared_ptr<Labels> predicted, std::shared
 	// set computed indicator
 	m_computed = true;
 
-	SG_FREE(idxs);
 	return m_auPRC;
 }
 
@@ -52,51 +52,31 @@ float64_t ROCEvaluation::evaluate_roc(const std::shared_ptr<BinaryLabels>& predi
 	// true positive rate
 	float64_t tp = 0.0;
 
-	int32_t i;
-	// total number of positive labels in predicted
-	int32_t pos_count = 0;
-	int32_t neg_count = 0;
-
 	// initialize number of labels and labels
-	SGVector<float64_t> orig_labels(predicted->get_num_labels());
-	int32_t length = orig_labels.vlen;
-	for (i = 0; i < length; i++)
-		orig_labels[i] = predicted->get_value(i);
-	float64_t* labels =
-	    SGVector<float64_t>::clone_vector(orig_labels.vector, length);
+	index_t length = predicted->get_num_labels();
+	SGVector<float64_t> outputs(length);
+#pragma omp parallel for
+	for (index_t i = 0; i < length; i++)
+		outputs[i] = predicted->get_value(i);
+	SGVector<float64_t> truth = ground_truth->get_labels();
 
 	// get sorted indexes
-	SGVector<int32_t> idxs(length);
-	for (i = 0; i < length; i++)
-		idxs[i] = i;
-
-	Math::qsort_backward_index(labels, idxs.vector, idxs.vlen);
+	SGVector<index_t> idxs = argsort_descending(outputs);
 
 	// number of different predicted labels
-	int32_t diff_count = 1;
+	index_t diff_count = 1;
+	// total number of positive labels in predicted
+	index_t pos_count = 0;
 
-	// get number of different labels
-	for (i = 0; i < length - 1; i++)
+#pragma omp parallel for reduction(+ : diff_count, pos_count)
+	for (index_t i = 0; i < length; i++)
 	{
-		if (labels[i] != labels[i + 1])
+		if (i < length - 1 && outputs[idxs[i]] != outputs[idxs[i + 1]])
 			diff_count++;
-	}
-
-	SG_FREE(labels);
-
-	// initialize graph and auROC
-	m_ROC_graph = SGMatrix<float64_t>(2, diff_count + 1);
-	m_thresholds = SGVector<float64_t>(length);
-	m_auROC = 0.0;
-
-	// get total numbers of positive and negative labels
-	for (i = 0; i < length; i++)
-	{
-		if (ground_truth->get_label(i) >= 0)
+		if (truth[i] >= 0)
 			pos_count++;
-		else
-			neg_count++;
 	}
+	index_t neg_count = length - pos_count;
 
 	// assure both number of positive and negative examples is >0
 	require(
@@ -110,13 +90,17 @@ float64_t ROCEvaluation::evaluate_roc(const std::shared_ptr<BinaryLabels>& predi
 	    "zero, ROC fails!",
 	    get_name());
 
-	int32_t j = 0;
-	float64_t label;
+	// initialize graph and auROC
+	m_ROC_graph = SGMatrix<float64_t>(2, diff_count + 1);
+	m_thresholds = SGVector<float64_t>(length);
+	m_auROC = 0.0;
+
+	index_t j = 0;
 
 	// create ROC curve and calculate auROC
-	for (i = 0; i < length; i++)
+	for (index_t i = 0; i < length; i++)
 	{
-		label = predicted->get_value(idxs[i]);
+		float64_t label = outputs[idxs[i]];
 
 		if (label != threshold)
 		{
@@ -128,7 +112,7 @@ float64_t ROCEvaluation::evaluate_roc(const std::shared_ptr<BinaryLabels>& predi
 
 		m_thresholds[i] = threshold;
 
-		if (ground_truth->get_label(idxs[i]) > 0)
+		if (truth[idxs[i]] > 0)
 			tp += 1.0;
 		else
 			fp += 1.0;
@@ -0,0 +1,186 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/evaluation/StreamingAUCEvaluation.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace shogun;
+
+StreamingAUCEvaluation::StreamingAUCEvaluation() : BinaryClassEvaluation()
+{
+	init();
+}
+
+StreamingAUCEvaluation::StreamingAUCEvaluation(
+    float64_t low, float64_t high, int32_t num_bins)
+    : BinaryClassEvaluation()
+{
+	init();
+
+	require(low < high, "Output range [{}, {}] is empty", low, high);
+	require(num_bins > 0, "Number of bins ({}) must be positive", num_bins);
+	m_low = low;
+	m_high = high;
+	m_num_bins = num_bins;
+	reset();
+}
+
+StreamingAUCEvaluation::~StreamingAUCEvaluation()
+{
+}
+
+void StreamingAUCEvaluation::init()
+{
+	m_low = -1;
+	m_high = 1;
+	m_num_bins = 10000;
+	reset();
+
+	// the histograms are allocated for the range and bins, which are
+	// therefore only set by the constructor
+	SG_ADD(
+	    &m_low, "low", "Lower end of output range",
+	    ParameterProperties::READONLY);
+	SG_ADD(
+	    &m_high, "high", "Upper end of output range",
+	    ParameterProperties::READONLY);
+	SG_ADD(
+	    &m_num_bins, "num_bins", "Number of bins",
+	    ParameterProperties::READONLY);
+	SG_ADD(&m_positive, "positive", "Number of positive examples per bin");
+	SG_ADD(&m_negative, "negative", "Number of negative examples per bin");
+	watch_method("auROC", &StreamingAUCEvaluation::get_auROC);
+	watch_method("error_bound", &StreamingAUCEvaluation::get_error_bound);
+}
+
+void StreamingAUCEvaluation::reset()
+{
+	m_positive = SGVector<float64_t>(m_num_bins);
+	m_negative = SGVector<float64_t>(m_num_bins);
+	m_positive.zero();
+	m_negative.zero();
+}
+
+float64_t StreamingAUCEvaluation::evaluate(
+    std::shared_ptr<Labels> predicted, std::shared_ptr<Labels> ground_truth)
+{
+	reset();
+	add_batch(std::move(predicted), std::move(ground_truth));
+	return get_auROC();
+}
+
+void StreamingAUCEvaluation::add_batch(
+    std::shared_ptr<Labels> predicted, std::shared_ptr<Labels> ground_truth)
+{
+	require(predicted, "No predicted labels provided.");
+	require(ground_truth, "No ground truth labels provided.");
+	require(
+	    predicted->get_num_labels() == ground_truth->get_num_labels(),
+	    "Number of predicted labels ({}) must match number of ground truth "
+	    "labels ({}).",
+	    predicted->get_num_labels(), ground_truth->get_num_labels());
+
+	auto pred = binary_labels(predicted);
+	auto truth = binary_labels(ground_truth);
+	truth->ensure_valid();
+
+	check_histograms();
+
+	const index_t length = pred->get_num_labels();
+	const float64_t scale = m_num_bins / (m_high - m_low);
+
+	// NaN has no bin, checked here as exceptions must not leave the
+	// parallel region below
+	for (index_t i = 0; i < length; ++i)
+	{
+		require(
+		    !std::isnan(pred->get_value(i)),
+		    "Output {} is NaN and cannot be ranked.", i);
+	}
+
+#pragma omp parallel
+	{
+		std::vector<float64_t> positive(m_num_bins, 0), negative(m_num_bins, 0);
+
+#pragma omp for nowait
+		for (index_t i = 0; i < length; ++i)
+		{
+			auto bin = std::floor((pred->get_value(i) - m_low) * scale);
+			auto b = (index_t)std::clamp<float64_t>(bin, 0, m_num_bins - 1);
+			if (truth->get_label(i) > 0)
+				positive[b] += 1;
+			else
+				negative[b] += 1;
+		}
+
+#pragma omp critical
+		for (index_t b = 0; b < m_num_bins; ++b)
+		{
+			m_positive[b] += positive[b];
+			m_negative[b] += negative[b];
+		}
+	}
+}
+
+void StreamingAUCEvaluation::check_histograms() const
+{
+	require(
+	    m_positive.vlen == m_num_bins && m_negative.vlen == m_num_bins,
+	    "{}: Histograms of {} and {} bins do not match the number of bins "
+	    "({}).",
+	    get_name(), m_positive.vlen, m_negative.vlen, m_num_bins);
+}
+
+float64_t StreamingAUCEvaluation::get_auROC() const
+{
+	check_histograms();
+
+	float64_t num_positive = 0;
+	float64_t num_negative = 0;
+	float64_t correct = 0;
+
+	// a positive is ranked above all negatives of lower bins
+	for (index_t b = 0; b < m_num_bins; ++b)
+	{
+		correct += m_positive[b] * (num_negative + 0.5 * m_negative[b]);
+		num_positive += m_positive[b];
+		num_negative += m_negative[b];
+	}
+
+	require(
+	    num_positive > 0 && num_negative > 0,
+	    "{}::get_auROC(): Both positive ({}) and negative ({}) examples "
+	    "are needed.",
+	    get_name(), num_positive, num_negative);
+
+	return correct / (num_positive * num_negative);
+}
+
+float64_t StreamingAUCEvaluation::get_error_bound() const
+{
+	float64_t num_positive = 0;
+	float64_t num_negative = 0;
+	float64_t ties = 0;
+	for (index_t b = 0; b < m_num_bins; ++b)
+	{
+		ties += m_positive[b] * m_negative[b];
+		num_positive += m_positive[b];
+		num_negative += m_negative[b];
+	}
+
+	if (num_positive == 0 || num_negative == 0)
+		return 0;
+	return 0.5 * ties / (num_positive * num_negative);
+}
+
+int64_t StreamingAUCEvaluation::get_num_examples() const
+{
+	float64_t total = 0;
+	for (index_t b = 0; b < m_num_bins; ++b)
+		total += m_positive[b] + m_negative[b];
+	return (int64_t)total;
+}
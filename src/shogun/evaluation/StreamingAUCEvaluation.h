@@ -0,0 +1,106 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef STREAMINGAUCEVALUATION_H_
+#define STREAMINGAUCEVALUATION_H_
+
+#include <shogun/lib/config.h>
+
+#include <shogun/evaluation/BinaryClassEvaluation.h>
+
+namespace shogun
+{
+
+class Labels;
+
+/** @brief Class StreamingAUCEvaluation approximates the area under the ROC
+ * curve from histograms of the outputs of positive and negative examples.
+ *
+ * Outputs are counted into num_bins equally sized bins over [low, high],
+ * outputs outside the range fall into the first or last bin. Batches can be
+ * added one at a time (e.g. the results of applying a machine to chunks of
+ * a large data set), so that memory is independent of the number of
+ * examples and no sort is needed.
+ *
+ * Pairs of a positive and a negative example in different bins are ranked
+ * exactly, pairs within the same bin count as ties. The deviation from the
+ * exact auROC is therefore at most half the fraction of such pairs, which
+ * is available through get_error_bound().
+ */
+class StreamingAUCEvaluation : public BinaryClassEvaluation
+{
+public:
+	/** constructor, with 10000 bins over [-1, 1] */
+	StreamingAUCEvaluation();
+
+	/** constructor
+	 * @param low lower end of output range
+	 * @param high upper end of output range
+	 * @param num_bins number of bins
+	 */
+	StreamingAUCEvaluation(float64_t low, float64_t high, int32_t num_bins);
+
+	~StreamingAUCEvaluation() override;
+
+	/** get name */
+	const char* get_name() const override { return "StreamingAUCEvaluation"; };
+
+	/** evaluate auROC of a single batch, discarding previous batches
+	 * @param predicted labels
+	 * @param ground_truth labels assumed to be correct
+	 * @return approximate auROC
+	 */
+	float64_t evaluate(std::shared_ptr<Labels> predicted, std::shared_ptr<Labels> ground_truth) override;
+
+	EEvaluationDirection get_evaluation_direction() const override
+	{
+		return ED_MAXIMIZE;
+	}
+
+	/** add the outputs of a batch to the histograms, outputs must not be NaN
+	 * @param predicted labels
+	 * @param ground_truth labels assumed to be correct
+	 */
+	void add_batch(std::shared_ptr<Labels> predicted, std::shared_ptr<Labels> ground_truth);
+
+	/** discard all batches */
+	void reset();
+
+	/** get approximate auROC of all batches
+	 * @return area under ROC (auROC)
+	 */
+	float64_t get_auROC() const;
+
+	/** get maximum deviation of get_auROC() from the exact auROC
+	 * @return error bound
+	 */
+	float64_t get_error_bound() const;
+
+	/** @return number of examples added so far */
+	int64_t get_num_examples() const;
+
+private:
+	void init();
+
+	/** requires the histograms to have num_bins bins */
+	void check_histograms() const;
+
+protected:
+	/** lower end of output range */
+	float64_t m_low;
+
+	/** upper end of output range */
+	float64_t m_high;
+
+	/** number of bins */
+	int32_t m_num_bins;
+
+	/** number of positive examples per bin */
+	SGVector<float64_t> m_positive;
+
+	/** number of negative examples per bin */
+	SGVector<float64_t> m_negative;
+};
+}
+#endif /* STREAMINGAUCEVALUATION_H_ */
@@ -302,6 +302,7 @@ void DenseFeatures<ST>::copy_feature_matrix(SGMatrix<ST>& target, index_t column
 	}
 	else
 	{
+#pragma omp parallel for
 		for (int32_t i=0; i<num_vecs; ++i)
 		{
 			auto real_i=m_subset_stack->subset_idx_conversion(i);
@@ -523,17 +524,28 @@ template<class ST> std::shared_ptr<Features> DenseFeatures<ST>::copy_subset(SGVe
 {
 	SGMatrix<ST> feature_matrix_copy(num_features, indices.vlen);
 
+#pragma omp parallel for
 	for (index_t i=0; i<indices.vlen; ++i)
 	{
 		index_t real_idx=m_subset_stack->subset_idx_conversion(indices.vector[i]);
-		sg_memcpy(&feature_matrix_copy.matrix[i*num_features],
-				&feature_matrix.matrix[real_idx*num_features],
+		sg_memcpy(&feature_matrix_copy.matrix[i*int64_t(num_features)],
+				&feature_matrix.matrix[real_idx*int64_t(num_features)],
 				num_features*sizeof(ST));
 	}
 
 	return std::make_shared<DenseFeatures>(feature_matrix_copy);
 }
 
+template<class ST> std::shared_ptr<Features> DenseFeatures<ST>::materialize_subset()
+{
+	if (!m_subset_stack->has_subsets() || !feature_matrix.matrix ||
+		get_num_preprocessors())
+		return Features::materialize_subset();
+
+	SG_DEBUG("Gathering {} of {} feature vectors", get_num_vectors(), num_vectors);
+	return std::make_shared<DenseFeatures>(get_feature_matrix());
+}
+
 template<class ST>
 std::shared_ptr<Features> DenseFeatures<ST>::copy_dimension_subset(SGVector<index_t> dims) const
 {
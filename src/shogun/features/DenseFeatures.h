@@ -454,6 +454,17 @@ public:
 	 */
 	std::shared_ptr<Features> copy_dimension_subset(SGVector<index_t> dims) const override;
 
+	/** Gathers the vectors of the active subset into a new feature matrix,
+	 * in parallel. Features with preprocessors or without a feature matrix
+	 * are returned as they are.
+	 *
+	 * possible with subset
+	 *
+	 * @return this instance without active subset, new features with a
+	 * contiguous copy of the subset otherwise
+	 */
+	std::shared_ptr<Features> materialize_subset() override;
+
 	/** checks if the contents of this DenseFeatures object are the same to
 	 * the contents of rhs
 	 *
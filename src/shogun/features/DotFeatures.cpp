@@ -13,6 +13,7 @@
 #include <shogun/lib/Signal.h>
 #include <shogun/lib/Time.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/ScatterMatrix.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 
 #ifdef HAVE_OPENMP
@@ -263,42 +264,9 @@ DotFeatures::compute_mean(const std::shared_ptr<DotFeatures>& lhs, const std::sh
 SGMatrix<float64_t> DotFeatures::get_cov(bool copy_data_for_speed) const
 {
 	int32_t num=get_num_vectors();
-	int32_t dim=get_dim_feature_space();
 	ASSERT(num>0)
-	ASSERT(dim>0)
-
-	SGMatrix<float64_t> cov(dim, dim);
-	SGVector<float64_t> mean = get_mean();
 
-	if (copy_data_for_speed)
-	{
-		SGMatrix<float64_t> centered_data(dim, num);
-		for (int i = 0; i < num; i++)
-		{
-			SGVector<float64_t> v = get_computed_dot_feature_vector(i);
-			centered_data.set_column(i, linalg::add(v, mean, 1.0, -1.0));
-		}
-
-		cov = linalg::matrix_prod(centered_data, centered_data, false, true);
-	}
-	else
-	{
-		linalg::zero(cov);
-		for (int i = 0; i < num; i++)
-		{
-			SGVector<float64_t> v = get_computed_dot_feature_vector(i);
-			linalg::add(v, mean, v, 1.0, -1.0);
-			for (int m = 0; m < v.vlen; m++)
-				linalg::add_col_vec(cov, m, v, cov, 1.0, v.vector[m]);
-		}
-		for (int m = 0; m < dim - 1; m++)
-		{
-			for (int n = m + 1; n < dim; n++)
-			{
-				(cov.matrix)[m * dim + n] = (cov.matrix)[n * dim + m];
-			}
-		}
-	}
+	auto cov = ScatterMatrix<float64_t>(*this).get_scatter();
 	linalg::scale(cov, cov, 1.0 / num);
 
 	return cov;
@@ -307,64 +275,16 @@ SGMatrix<float64_t> DotFeatures::get_cov(bool copy_data_for_speed) const
 SGMatrix<float64_t> DotFeatures::compute_cov(
     const std::shared_ptr<DotFeatures>& lhs, const std::shared_ptr<DotFeatures>& rhs, bool copy_data_for_speed)
 {
-	std::shared_ptr<DotFeatures> feats[2];
-	feats[0]=lhs;
-	feats[1]=rhs;
-
-	int32_t nums[2], dims[2], num=0;
-
-	for (int i = 0; i < 2; i++)
-	{
-		nums[i]=feats[i]->get_num_vectors();
-		dims[i]=feats[i]->get_dim_feature_space();
-		ASSERT(nums[i]>0)
-		ASSERT(dims[i]>0)
-		num += nums[i];
-	}
-
-	ASSERT(dims[0]==dims[1])
-	int32_t dim = dims[0];
-
-	SGMatrix<float64_t> cov(dim, dim);
-	SGVector<float64_t> mean = compute_mean(lhs, rhs);
-
-	if (copy_data_for_speed)
-	{
-		SGMatrix<float64_t> centered_data(dim, num);
-		for (int i = 0; i < num; i++)
-		{
-			SGVector<float64_t> v =
-			    i < nums[0] ? lhs->get_computed_dot_feature_vector(i)
-			                : rhs->get_computed_dot_feature_vector(i - nums[0]);
-
-			centered_data.set_column(i, linalg::add(v, mean, 1.0, -1.0));
-		}
+	ASSERT(lhs && rhs)
+	ASSERT(lhs->get_dim_feature_space() == rhs->get_dim_feature_space())
 
-		cov = linalg::matrix_prod(centered_data, centered_data, false, true);
-	}
-	else
-	{
-		linalg::zero(cov);
-		for (int i = 0; i < 2; i++)
-		{
-			for (int j = 0; j < nums[i]; j++)
-			{
-				SGVector<float64_t> v =
-				    feats[i]->get_computed_dot_feature_vector(j);
-				linalg::add(v, mean, v, 1.0, -1.0);
-				for (int m = 0; m < v.vlen; m++)
-					linalg::add_col_vec(cov, m, v, cov, 1.0, v.vector[m]);
-			}
-		}
+	int32_t num = lhs->get_num_vectors() + rhs->get_num_vectors();
+	ASSERT(lhs->get_num_vectors()>0)
+	ASSERT(rhs->get_num_vectors()>0)
 
-		for (int m = 0; m < dim - 1; m++)
-		{
-			for (int n = m + 1; n < dim; n++)
-			{
-				(cov.matrix[m * dim + n]) = (cov.matrix)[n * dim + m];
-			}
-		}
-	}
+	ScatterMatrix<float64_t> scatter(*lhs);
+	scatter.merge(ScatterMatrix<float64_t>(*rhs));
+	auto cov = scatter.get_scatter();
 	linalg::scale(cov, cov, 1.0 / num);
 
 	return cov;
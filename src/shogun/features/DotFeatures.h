@@ -196,16 +196,10 @@ class DotFeatures : public Features
 		static SGVector<float64_t>
 		compute_mean(const std::shared_ptr<DotFeatures>& lhs, const std::shared_ptr<DotFeatures>& rhs);
 
-		/** get covariance
-		 *
-		 * @param copy_data_for_speed if true, the method stores explicitly
-		 * the centered data matrix and the covariance is calculated by matrix
-		 * product of the centered data with its transpose, this make it
-		 * possible to take advantage of multithreaded matrix product,
-		 * this may not be possible if the data doesn't fit into memory,
-		 * in such case set this parameter to false to compute iteratively
-		 * the covariance matrix without storing the centered data.
-		 * [default = true]
+		/** get covariance, computed blockwise in parallel (cf.
+		 * ScatterMatrix) without storing the centered data
+		 *
+		 * @param copy_data_for_speed ignored, kept for compatibility
 		 * @return covariance
 		 */
 		virtual SGMatrix<float64_t> get_cov(bool copy_data_for_speed = true) const;
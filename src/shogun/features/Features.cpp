@@ -206,6 +206,11 @@ std::shared_ptr<Features> Features::copy_dimension_subset(SGVector<index_t> dims
 	return NULL;
 }
 
+std::shared_ptr<Features> Features::materialize_subset()
+{
+	return std::static_pointer_cast<Features>(shared_from_this());
+}
+
 bool Features::get_feature_class_compatibility(EFeatureClass rhs) const
 {
 	if (this->get_feature_class()==rhs)
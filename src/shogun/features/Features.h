@@ -304,6 +304,16 @@ class Features : public SGObject
 		 */
 		virtual std::shared_ptr<Features> copy_dimension_subset(SGVector<index_t> dims) const;
 
+		/** Returns features that store the vectors of the active subset
+		 * contiguously, in subset order, so that training loops do not
+		 * gather through the subset on every access. Types that cannot
+		 * materialize their subsets return this instance.
+		 *
+		 * @return this instance without active subset, a contiguous copy
+		 * otherwise
+		 */
+		virtual std::shared_ptr<Features> materialize_subset();
+
 		/** does this class support compatible computation bewteen difference classes?
 		 * for example, this->dot(rhs_prt),
 		 * can rhs_prt be an instance of a difference class?
@@ -8,11 +8,92 @@
 #include <string.h>
 #include <stdlib.h>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace shogun
 {
 
 template <class ST> class SparsePreprocessor;
 
+/** dot product of two vectors in compressed storage with sorted indices */
+template <class ST>
+static ST compressed_sparse_dot(
+	const index_t* a_indices, const ST* a_values, index_t a_len,
+	const index_t* b_indices, const ST* b_values, index_t b_len)
+{
+	ST result=0;
+	index_t i=0, j=0;
+	while (i<a_len && j<b_len)
+	{
+		if (a_indices[i]<b_indices[j])
+			i++;
+		else if (a_indices[i]>b_indices[j])
+			j++;
+		else
+			result+=a_values[i++]*b_values[j++];
+	}
+	return result;
+}
+
+/** sorts the entries of every vector in compressed storage by feature index,
+ * as required by compressed_sparse_dot, and sums up entries of the same
+ * feature. The arrays are only replaced if they are not sorted already.
+ */
+template <class ST>
+static void sort_compressed(
+	SGVector<index_t>& indptr, SGVector<index_t>& indices,
+	SGVector<ST>& values)
+{
+	const index_t num_vectors=indptr.vlen-1;
+	bool sorted=true;
+	for (index_t i=0; i<num_vectors && sorted; i++)
+	{
+		for (index_t k=indptr[i]+1; k<indptr[i+1] && sorted; k++)
+			sorted=indices[k-1]<indices[k];
+	}
+	if (sorted)
+		return;
+
+	SGVector<index_t> sorted_indptr(indptr.vlen);
+	SGVector<index_t> sorted_indices(indices.vlen);
+	SGVector<ST> sorted_values(values.vlen);
+	std::vector<std::pair<index_t, ST>> entries;
+	index_t nnz=0;
+	sorted_indptr[0]=0;
+	for (index_t i=0; i<num_vectors; i++)
+	{
+		entries.clear();
+		for (index_t k=indptr[i]; k<indptr[i+1]; k++)
+			entries.emplace_back(indices[k], values[k]);
+		std::stable_sort(entries.begin(), entries.end(),
+			[](const std::pair<index_t, ST>& a, const std::pair<index_t, ST>& b)
+			{
+				return a.first<b.first;
+			});
+
+		for (const auto& entry : entries)
+		{
+			if (nnz>sorted_indptr[i] && sorted_indices[nnz-1]==entry.first)
+				sorted_values[nnz-1]=sorted_values[nnz-1]+entry.second;
+			else
+			{
+				sorted_indices[nnz]=entry.first;
+				sorted_values[nnz]=entry.second;
+				nnz++;
+			}
+		}
+		sorted_indptr[i+1]=nnz;
+	}
+	sorted_indices.resize_vector(nnz);
+	sorted_values.resize_vector(nnz);
+
+	indptr=sorted_indptr;
+	indices=sorted_indices;
+	values=sorted_values;
+}
+
 template<class ST> SparseFeatures<ST>::SparseFeatures(int32_t size)
 : DotFeatures(size), feature_cache(NULL)
 {
@@ -31,9 +112,42 @@ template<class ST> SparseFeatures<ST>::SparseFeatures(SGMatrix<ST> dense)
 	set_full_feature_matrix(dense);
 }
 
+template<class ST> SparseFeatures<ST>::SparseFeatures(
+	SGVector<index_t> indptr, SGVector<index_t> indices, SGVector<ST> values,
+	int32_t num_features)
+: SparseFeatures(0)
+{
+	require(indptr.vlen>0, "Offsets of compressed storage must not be empty");
+	require(indptr[0]==0 && indptr[indptr.vlen-1]==indices.vlen,
+		"Offsets of compressed storage must range from 0 to {}", indices.vlen);
+	require(indices.vlen==values.vlen,
+		"Number of indices ({}) and values ({}) must match",
+		indices.vlen, values.vlen);
+
+	for (index_t i=0; i<indptr.vlen-1; i++)
+	{
+		require(indptr[i]<=indptr[i+1],
+			"Offsets of compressed storage must be non-decreasing, "
+			"vector {} has offsets {} and {}", i, indptr[i], indptr[i+1]);
+	}
+	for (index_t i=0; i<indices.vlen; i++)
+	{
+		require(indices[i]>=0 && indices[i]<num_features,
+			"Feature index {} of entry {} exceeds [0;{}]",
+			indices[i], i, num_features-1);
+	}
+
+	sort_compressed(indptr, indices, values);
+	m_indptr=indptr;
+	m_indices=indices;
+	m_values=values;
+	sparse_feature_matrix.num_features=num_features;
+}
+
 template<class ST> SparseFeatures<ST>::SparseFeatures(const SparseFeatures & orig)
 : DotFeatures(orig), sparse_feature_matrix(orig.sparse_feature_matrix),
-	feature_cache(orig.feature_cache)
+	feature_cache(orig.feature_cache), m_indptr(orig.m_indptr),
+	m_indices(orig.m_indices), m_values(orig.m_values)
 {
 	init();
 
@@ -79,6 +193,21 @@ template<class ST> ST SparseFeatures<ST>::get_feature(int32_t num, int32_t index
 		"get_feature(num={},index={}): index exceeds [0;{}]",
 		num, index, get_num_features()-1);
 
+	if (is_compressed())
+	{
+		const index_t* indices;
+		const ST* values;
+		index_t len=get_compressed_feature_vector(num, indices, values);
+
+		ST ret=0;
+		for (index_t i=0; i<len; i++)
+		{
+			if (indices[i]==index)
+				ret+=values[i];
+		}
+		return ret;
+	}
+
 	SGSparseVector<ST> sv=get_sparse_feature_vector(num);
 	ST ret = sv.get_feature(index);
 
@@ -88,6 +217,19 @@ template<class ST> ST SparseFeatures<ST>::get_feature(int32_t num, int32_t index
 
 template<class ST> SGVector<ST> SparseFeatures<ST>::get_full_feature_vector(int32_t num)
 {
+	if (is_compressed())
+	{
+		const index_t* indices;
+		const ST* values;
+		index_t len=get_compressed_feature_vector(num, indices, values);
+
+		SGVector<ST> dense(get_num_features());
+		dense.zero();
+		for (index_t i=0; i<len; i++)
+			dense[indices[i]]+=values[i];
+		return dense;
+	}
+
 	SGSparseVector<ST> sv=get_sparse_feature_vector(num);
 	SGVector<ST> dense = sv.get_dense(get_num_features());
 	free_sparse_feature_vector(num);
@@ -96,6 +238,13 @@ template<class ST> SGVector<ST> SparseFeatures<ST>::get_full_feature_vector(int3
 
 template<class ST> int32_t SparseFeatures<ST>::get_nnz_features_for_vector(int32_t num) const
 {
+	if (is_compressed())
+	{
+		const index_t* indices;
+		const ST* values;
+		return get_compressed_feature_vector(num, indices, values);
+	}
+
 	SGSparseVector<ST> sv = get_sparse_feature_vector(num);
 	int32_t len=sv.num_feat_entries;
 	free_sparse_feature_vector(num);
@@ -109,7 +258,18 @@ template<class ST> SGSparseVector<ST> SparseFeatures<ST>::get_sparse_feature_vec
 		num, get_num_vectors()-1);
 	index_t real_num=m_subset_stack->subset_idx_conversion(num);
 
-	if (sparse_feature_matrix.sparse_matrix)
+	if (is_compressed())
+	{
+		index_t begin=m_indptr[real_num];
+		SGSparseVector<ST> result(m_indptr[real_num+1]-begin);
+		for (index_t i=0; i<result.num_feat_entries; i++)
+		{
+			result.features[i].feat_index=m_indices[begin+i];
+			result.features[i].entry=m_values[begin+i];
+		}
+		return result;
+	}
+	else if (sparse_feature_matrix.sparse_matrix)
 	{
 		return sparse_feature_matrix[real_num];
 	}
@@ -164,8 +324,39 @@ template<class ST> SGSparseVector<ST> SparseFeatures<ST>::get_sparse_feature_vec
 	}
 }
 
+template<class ST> index_t SparseFeatures<ST>::get_compressed_feature_vector(
+	int32_t num, const index_t*& indices, const ST*& values) const
+{
+	require(is_compressed(), "Features are not compressed, call compress() first");
+	require(num>=0 && num<get_num_vectors(),
+		"get_compressed_feature_vector(num={}): num exceeds [0;{}]",
+		num, get_num_vectors()-1);
+	index_t real_num=m_subset_stack->subset_idx_conversion(num);
+
+	index_t begin=m_indptr[real_num];
+	indices=m_indices.vector+begin;
+	values=m_values.vector+begin;
+	return m_indptr[real_num+1]-begin;
+}
+
 template<class ST> ST SparseFeatures<ST>::dense_dot(ST alpha, int32_t num, ST* vec, int32_t dim, ST b) const
 {
+	if (is_compressed())
+	{
+		ASSERT(vec)
+		const index_t* indices;
+		const ST* values;
+		index_t len=get_compressed_feature_vector(num, indices, values);
+
+		ST result=0;
+		for (index_t i=0; i<len; i++)
+		{
+			if (indices[i]<dim)
+				result+=vec[indices[i]]*values[i];
+		}
+		return alpha*result+b;
+	}
+
 	SGSparseVector<ST> sv=get_sparse_feature_vector(num);
 	ST result = sv.dense_dot(alpha,vec,dim,b);
 	free_sparse_feature_vector(num);
@@ -180,6 +371,25 @@ template<class ST> void SparseFeatures<ST>::add_to_dense_vec(float64_t alpha, in
 		"add_to_dense_vec(num={},dim={}): dim should contain number of features {}",
 		num, dim, get_num_features());
 
+	if (is_compressed())
+	{
+		const index_t* indices;
+		const ST* values;
+		index_t len=get_compressed_feature_vector(num, indices, values);
+
+		if (abs_val)
+		{
+			for (index_t i=0; i<len; i++)
+				vec[indices[i]]+=alpha*Math::abs(values[i]);
+		}
+		else
+		{
+			for (index_t i=0; i<len; i++)
+				vec[indices[i]]+=alpha*values[i];
+		}
+		return;
+	}
+
 	SGSparseVector<ST> sv=get_sparse_feature_vector(num);
 
 	if (sv.features)
@@ -225,6 +435,12 @@ template<class ST> SGSparseMatrix<ST> SparseFeatures<ST>::get_sparse_feature_mat
 	if (m_subset_stack->has_subsets())
 		error("Not allowed with subset");
 
+	if (is_compressed())
+	{
+		return SGSparseMatrix<ST>(
+			m_indptr, m_indices, m_values, get_num_features());
+	}
+
 	return sparse_feature_matrix;
 }
 
@@ -233,6 +449,35 @@ template<class ST> std::shared_ptr<SparseFeatures<ST>> SparseFeatures<ST>::get_t
 	if (m_subset_stack->has_subsets())
 		error("Not allowed with subset");
 
+	if (is_compressed())
+	{
+		index_t num_feat=get_num_features();
+		index_t num_vec=get_num_vectors();
+
+		// count the lengths of future feature vectors
+		SGVector<index_t> indptr(num_feat+1);
+		indptr.zero();
+		for (auto index : m_indices)
+			indptr[index+1]++;
+		for (index_t i=0; i<num_feat; i++)
+			indptr[i+1]+=indptr[i];
+
+		SGVector<index_t> indices(m_indices.vlen);
+		SGVector<ST> values(m_values.vlen);
+		SGVector<index_t> next=indptr.clone();
+		for (index_t v=0; v<num_vec; v++)
+		{
+			for (index_t i=m_indptr[v]; i<m_indptr[v+1]; i++)
+			{
+				index_t pos=next[m_indices[i]]++;
+				indices[pos]=v;
+				values[pos]=m_values[i];
+			}
+		}
+
+		return std::make_shared<SparseFeatures>(indptr, indices, values, num_vec);
+	}
+
 	return std::make_shared<SparseFeatures>(sparse_feature_matrix.get_transposed());
 }
 
@@ -241,6 +486,9 @@ template<class ST> void SparseFeatures<ST>::set_sparse_feature_matrix(SGSparseMa
 	if (m_subset_stack->has_subsets())
 		error("Not allowed with subset");
 
+	m_indptr=SGVector<index_t>();
+	m_indices=SGVector<index_t>();
+	m_values=SGVector<ST>();
 	sparse_feature_matrix=sm;
 
 	// TODO: check should be implemented in sparse matrix class
@@ -252,13 +500,46 @@ template<class ST> void SparseFeatures<ST>::set_sparse_feature_matrix(SGSparseMa
 	}
 }
 
+template<class ST> void SparseFeatures<ST>::compress()
+{
+	if (m_subset_stack->has_subsets())
+		error("Not allowed with subset");
+
+	if (is_compressed())
+		return;
+
+	require(sparse_feature_matrix.sparse_matrix || !sparse_feature_matrix.num_vectors,
+		"Requires a in-memory feature matrix");
+
+	auto num_features=get_num_features();
+	sparse_feature_matrix.to_compressed(m_indptr, m_indices, m_values);
+	sort_compressed(m_indptr, m_indices, m_values);
+	sparse_feature_matrix=SGSparseMatrix<ST>();
+	sparse_feature_matrix.num_features=num_features;
+}
+
 template<class ST> SGMatrix<ST> SparseFeatures<ST>::get_full_feature_matrix()
 {
 	SGMatrix<ST> full(get_num_features(), get_num_vectors());
 	full.zero();
 
 	io::info("converting sparse features to full feature matrix of {} x {}"
-			" entries", sparse_feature_matrix.num_vectors, get_num_features());
+			" entries", get_num_vectors(), get_num_features());
+
+	if (is_compressed())
+	{
+		for (int32_t v=0; v<full.num_cols; v++)
+		{
+			const index_t* indices;
+			const ST* values;
+			index_t len=get_compressed_feature_vector(v, indices, values);
+
+			ST* col=full.get_column_vector(v);
+			for (index_t i=0; i<len; i++)
+				col[indices[i]]=values[i];
+		}
+		return full;
+	}
 
 	for (int32_t v=0; v<full.num_cols; v++)
 	{
@@ -286,6 +567,9 @@ template<class ST> void SparseFeatures<ST>::free_sparse_features()
 template<class ST> void SparseFeatures<ST>::free_sparse_feature_matrix()
 {
 	sparse_feature_matrix=SGSparseMatrix<ST>();
+	m_indptr=SGVector<index_t>();
+	m_indices=SGVector<index_t>();
+	m_values=SGVector<ST>();
 }
 
 template<class ST> void SparseFeatures<ST>::set_full_feature_matrix(SGMatrix<ST> full)
@@ -297,7 +581,10 @@ template<class ST> void SparseFeatures<ST>::set_full_feature_matrix(SGMatrix<ST>
 
 template<class ST> int32_t  SparseFeatures<ST>::get_num_vectors() const
 {
-	return m_subset_stack->has_subsets() ? m_subset_stack->get_size() : sparse_feature_matrix.num_vectors;
+	if (m_subset_stack->has_subsets())
+		return m_subset_stack->get_size();
+
+	return is_compressed() ? m_indptr.vlen-1 : sparse_feature_matrix.num_vectors;
 }
 
 template<class ST> int32_t  SparseFeatures<ST>::get_num_features() const
@@ -330,6 +617,13 @@ template<class ST> int64_t SparseFeatures<ST>::get_num_nonzero_entries()
 {
 	int64_t num=0;
 	index_t num_vec=get_num_vectors();
+	if (is_compressed())
+	{
+		for (int32_t i=0; i<num_vec; i++)
+			num+=get_nnz_features_for_vector(i);
+		return num;
+	}
+
 	for (int32_t i=0; i<num_vec; i++)
 		num+=sparse_feature_matrix[m_subset_stack->subset_idx_conversion(i)].num_feat_entries;
 
@@ -341,6 +635,21 @@ template<class ST> float64_t* SparseFeatures<ST>::compute_squared(float64_t* sq)
 	ASSERT(sq)
 
 	index_t num_vec=get_num_vectors();
+	if (is_compressed())
+	{
+		for (int32_t i=0; i<num_vec; i++)
+		{
+			const index_t* indices;
+			const ST* values;
+			index_t len=get_compressed_feature_vector(i, indices, values);
+
+			sq[i]=0;
+			for (index_t j=0; j<len; j++)
+				sq[i]+=values[j]*values[j];
+		}
+		return sq;
+	}
+
 	for (int32_t i=0; i<num_vec; i++)
 	{
 		sq[i]=0;
@@ -369,6 +678,20 @@ template<class ST> float64_t SparseFeatures<ST>::compute_squared_norm(
 	ASSERT(lhs)
 	ASSERT(rhs)
 
+	if (lhs->is_compressed() && rhs->is_compressed())
+	{
+		const index_t* a_indices;
+		const float64_t* a_values;
+		index_t a_len=lhs->get_compressed_feature_vector(idx_a, a_indices, a_values);
+		const index_t* b_indices;
+		const float64_t* b_values;
+		index_t b_len=rhs->get_compressed_feature_vector(idx_b, b_indices, b_values);
+
+		float64_t result=sq_lhs[idx_a]+sq_rhs[idx_b]-2*compressed_sparse_dot(
+			a_indices, a_values, a_len, b_indices, b_values, b_len);
+		return Math::abs(result);
+	}
+
 	SGSparseVector<float64_t> avec=lhs->get_sparse_feature_vector(idx_a);
 	SGSparseVector<float64_t> bvec=rhs->get_sparse_feature_vector(idx_b);
 	ASSERT(avec.features)
@@ -434,6 +757,19 @@ template<class ST> float64_t SparseFeatures<ST>::dot(int32_t vec_idx1,
 	ASSERT(df->get_feature_class() == get_feature_class())
 	auto sf = std::dynamic_pointer_cast<SparseFeatures<ST>>(df);
 
+	if (is_compressed() && sf->is_compressed())
+	{
+		const index_t* a_indices;
+		const ST* a_values;
+		index_t a_len=get_compressed_feature_vector(vec_idx1, a_indices, a_values);
+		const index_t* b_indices;
+		const ST* b_values;
+		index_t b_len=sf->get_compressed_feature_vector(vec_idx2, b_indices, b_values);
+
+		return compressed_sparse_dot(
+			a_indices, a_values, a_len, b_indices, b_values, b_len);
+	}
+
 	SGSparseVector<ST> avec=get_sparse_feature_vector(vec_idx1);
 	SGSparseVector<ST> bvec=sf->get_sparse_feature_vector(vec_idx2);
 
@@ -462,6 +798,18 @@ SparseFeatures<ST>::dot(int32_t vec_idx1, const SGVector<float64_t>& vec2) const
 		vec_idx1, vec2.size(), get_num_features());
 
 	float64_t result=0;
+	if (is_compressed())
+	{
+		// feature indices have been checked on construction
+		const index_t* indices;
+		const ST* values;
+		index_t len=get_compressed_feature_vector(vec_idx1, indices, values);
+
+		for (index_t i=0; i<len; i++)
+			result+=vec2[indices[i]]*values[i];
+		return result;
+	}
+
 	SGSparseVector<ST> sv=get_sparse_feature_vector(vec_idx1);
 
 	if (sv.features)
@@ -501,7 +849,7 @@ template<class ST> void* SparseFeatures<ST>::get_feature_iterator(int32_t vector
 				"requested {})", get_num_vectors(), vector_index);
 	}
 
-	if (!sparse_feature_matrix.sparse_matrix)
+	if (!sparse_feature_matrix.sparse_matrix && !is_compressed())
 		error("Requires a in-memory feature matrix");
 
 	sparse_feature_iterator* it=new sparse_feature_iterator();
@@ -543,6 +891,30 @@ template<class ST> void SparseFeatures<ST>::free_feature_iterator(void* iterator
 
 template<class ST> std::shared_ptr<Features> SparseFeatures<ST>::copy_subset(SGVector<index_t> indices ) const
 {
+	if (is_compressed())
+	{
+		SGVector<index_t> indptr(indices.vlen+1);
+		indptr[0]=0;
+		for (index_t i=0; i<indices.vlen; ++i)
+			indptr[i+1]=indptr[i]+get_nnz_features_for_vector(indices[i]);
+
+		SGVector<index_t> feat_indices(indptr[indices.vlen]);
+		SGVector<ST> values(indptr[indices.vlen]);
+		for (index_t i=0; i<indices.vlen; ++i)
+		{
+			const index_t* current_indices;
+			const ST* current_values;
+			index_t len=get_compressed_feature_vector(
+				indices[i], current_indices, current_values);
+
+			std::copy_n(current_indices, len, feat_indices.vector+indptr[i]);
+			std::copy_n(current_values, len, values.vector+indptr[i]);
+		}
+
+		return std::make_shared<SparseFeatures>(
+			indptr, feat_indices, values, get_num_features());
+	}
+
 	SGSparseMatrix<ST> matrix_copy=SGSparseMatrix<ST>(get_dim_feature_space(),
 			indices.vlen);
 
@@ -573,6 +945,31 @@ template<class ST> SGSparseVectorEntry<ST>* SparseFeatures<ST>::compute_sparse_f
 
 template<class ST> void SparseFeatures<ST>::sort_features()
 {
+	if (is_compressed())
+	{
+		std::vector<std::pair<index_t, ST>> entries;
+		for (index_t v=0; v<m_indptr.vlen-1; v++)
+		{
+			auto begin=m_indices.vector+m_indptr[v];
+			auto end=m_indices.vector+m_indptr[v+1];
+			if (std::is_sorted(begin, end))
+				continue;
+
+			entries.clear();
+			for (index_t i=m_indptr[v]; i<m_indptr[v+1]; i++)
+				entries.emplace_back(m_indices[i], m_values[i]);
+			std::stable_sort(entries.begin(), entries.end(),
+				[](const auto& a, const auto& b) { return a.first<b.first; });
+
+			for (index_t i=m_indptr[v]; i<m_indptr[v+1]; i++)
+			{
+				m_indices[i]=entries[i-m_indptr[v]].first;
+				m_values[i]=entries[i-m_indptr[v]].second;
+			}
+		}
+		return;
+	}
+
 	sparse_feature_matrix.sort_features();
 }
 
@@ -587,6 +984,9 @@ template<class ST> void SparseFeatures<ST>::init()
 		"sparse_feature_matrix", &sparse_feature_matrix.sparse_matrix,
 		&sparse_feature_matrix.num_vectors);
 	watch_param("sparse_feature_matrix.num_features",  &sparse_feature_matrix.num_features);
+	watch_param("sparse_feature_matrix.indptr", &m_indptr);
+	watch_param("sparse_feature_matrix.indices", &m_indices);
+	watch_param("sparse_feature_matrix.values", &m_values);
 
 	/*m_parameters->add(&sparse_feature_matrix.num_features, "sparse_feature_matrix.num_features",
 			"Total number of features.");*/
@@ -634,7 +1034,7 @@ template<class ST> void SparseFeatures<ST>::save(std::shared_ptr<File> writer)
 	if (m_subset_stack->has_subsets())
 		error("Not allowed with subset");
 	ASSERT(writer)
-	sparse_feature_matrix.save(writer);
+	get_sparse_feature_matrix().save(writer);
 }
 
 template<class ST> void SparseFeatures<ST>::save_with_labels(const std::shared_ptr<File>& writer, SGVector<float64_t> labels)
@@ -642,7 +1042,7 @@ template<class ST> void SparseFeatures<ST>::save_with_labels(const std::shared_p
 	if (m_subset_stack->has_subsets())
 		error("Not allowed with subset");
 	ASSERT(writer)
-	sparse_feature_matrix.save_with_labels(writer, labels);
+	get_sparse_feature_matrix().save_with_labels(writer, labels);
 }
 
 template class SparseFeatures<bool>;
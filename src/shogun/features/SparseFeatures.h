@@ -40,6 +40,17 @@ template <class T> class Cache;
  * As this is a template class it can directly be used for different data types
  * like sparse matrices of real valued, integer, byte etc type.
  *
+ * Alternatively, after calling compress() or when constructed from compressed
+ * storage, all vectors are stored in three contiguous arrays (offsets, feature
+ * indices and values, a.k.a. CSR with vectors as rows). This avoids one heap
+ * allocation per vector and keeps indices and values in separate arrays, so
+ * that dense_dot(), add_to_dense_vec(), dot() and friends stream through
+ * memory. Subsets of compressed features are views into the same arrays.
+ * The entries of every vector are kept sorted by feature index, entries of
+ * the same feature are summed up.
+ * get_sparse_feature_vector() has to copy the entries of a vector in this
+ * mode, use get_compressed_feature_vector() instead.
+ *
  * (Partly) subset access is supported for this feature type.
  * Simple use the (inherited) add_subset(), remove_subset() functions.
  * If done, all calls that work with features are translated to the subset.
@@ -69,6 +80,21 @@ template <class ST> class SparseFeatures : public DotFeatures
 		 */
 		SparseFeatures(SGMatrix<ST> dense);
 
+		/** convenience constructor that creates sparse features from
+		 * compressed storage, i.e. vector i consists of the entries indptr[i]
+		 * to indptr[i+1]-1 of indices and values. If the entries of a vector
+		 * are not sorted by feature index, sorted copies of the arrays are
+		 * stored instead.
+		 *
+		 * @param indptr offsets of the vectors, of length num_vectors+1
+		 * @param indices feature indices of all entries
+		 * @param values values of all entries
+		 * @param num_features number of features
+		 */
+		SparseFeatures(
+			SGVector<index_t> indptr, SGVector<index_t> indices,
+			SGVector<ST> values, int32_t num_features);
+
 		/** copy constructor */
 		SparseFeatures(const SparseFeatures & orig);
 
@@ -138,6 +164,18 @@ template <class ST> class SparseFeatures : public DotFeatures
 		 */
 		SGSparseVector<ST> get_sparse_feature_vector(int32_t num) const;
 
+		/** get a view of the entries of a vector in compressed storage
+		 *
+		 * possible with subset
+		 *
+		 * @param num index of feature vector
+		 * @param indices feature indices of the entries, returned by reference
+		 * @param values values of the entries, returned by reference
+		 * @return number of entries
+		 */
+		index_t get_compressed_feature_vector(
+			int32_t num, const index_t*& indices, const ST*& values) const;
+
 		/** compute the dot product between dense weights and a sparse feature vector
 		 * alpha * sparse^T * w + b
 		 *
@@ -185,7 +223,8 @@ template <class ST> class SparseFeatures : public DotFeatures
 		 */
 		SGSparseVector<ST>* get_sparse_feature_matrix(int32_t &num_feat, int32_t &num_vec);
 
-		/** get the sparse feature matrix
+		/** get the sparse feature matrix, features in compressed storage are
+		 * copied into per vector storage
 		 *
 		 * not possible with subset
 		 *
@@ -224,6 +263,19 @@ template <class ST> class SparseFeatures : public DotFeatures
 		 */
         void set_sparse_feature_matrix(SGSparseMatrix<ST> sm);
 
+		/** convert the sparse feature matrix to compressed storage,
+		 * releasing the per vector storage
+		 *
+		 * not possible with subset
+		 */
+		void compress();
+
+		/** @return whether features are held in compressed storage */
+		bool is_compressed() const
+		{
+			return m_indptr.vlen>0;
+		}
+
 		/** gets a copy of a full feature matrix
 		 *
 		 * possible with subset
@@ -482,6 +534,16 @@ template <class ST> class SparseFeatures : public DotFeatures
 
 		/** feature cache */
 		std::shared_ptr<Cache< SGSparseVectorEntry<ST> >> feature_cache;
+
+		/** offsets of the vectors in compressed storage, of length
+		 * num_vectors+1, empty if not compressed */
+		SGVector<index_t> m_indptr;
+
+		/** feature indices of all entries in compressed storage */
+		SGVector<index_t> m_indices;
+
+		/** values of all entries in compressed storage */
+		SGVector<ST> m_values;
 };
 }
 #endif /* _SPARSEFEATURES__H__ */
@@ -48,10 +48,15 @@ template <class T> class MemoryMappedFile : public SGObject
 
 		/** constructor
 		 *
-		 * open a memory mapped file for read or read/write mode
+		 * open a memory mapped file for read, read/write or copy-on-write
+		 * mode. In copy-on-write mode 'c' the mapping is writable, but
+		 * written pages are private copies and the file is never modified.
+		 * Pages that are not written are shared with other processes
+		 * mapping the same file.
 		 *
 		 * @param fname name of file, zero terminated string
-		 * @param flag determines read or read write mode (can be 'r' or 'w')
+		 * @param flag determines read, read write or copy-on-write mode (can
+		 *   be 'r', 'w' or 'c')
 		 * @param fsize overestimate of expected file size (in bytes)
 		 *   when opened in write  mode; Underestimating the file size will
 		 *   result in an error to occur upon writing. In case the exact file
@@ -62,7 +67,7 @@ template <class T> class MemoryMappedFile : public SGObject
 		MemoryMappedFile(const char* fname, char flag='r', int64_t fsize=0)
 		: SGObject()
 		{
-			require(flag=='w' || flag=='r', "Only 'r' and 'w' flags are allowed");
+			require(flag=='w' || flag=='r' || flag=='c', "Only 'r', 'w' and 'c' flags are allowed");
 
 			last_written_byte=0;
 			rw=flag;
@@ -81,6 +86,11 @@ template <class T> class MemoryMappedFile : public SGObject
 				mmap_prot = PAGE_READWRITE;
 				mmap_flags = FILE_MAP_ALL_ACCESS;
 			}
+			else if (rw=='c')
+			{
+				mmap_prot = PAGE_WRITECOPY;
+				mmap_flags = FILE_MAP_COPY;
+			}
 
 			fd = CreateFile(fname, open_flags, share_mode, 0, create_disp, FILE_ATTRIBUTE_NORMAL, NULL);
 			if (rw=='w' && fsize)
@@ -113,6 +123,8 @@ template <class T> class MemoryMappedFile : public SGObject
 				mmap_prot=PROT_READ|PROT_WRITE;
 				mmap_flags=MAP_SHARED;
 			}
+			else if (rw=='c')
+				mmap_prot=PROT_READ|PROT_WRITE;
 
 			fd = open(fname, open_flags, S_IRWXU | S_IRWXG | S_IRWXO);
 			if (fd == -1)
@@ -197,6 +209,15 @@ template <class T> class MemoryMappedFile : public SGObject
 			return length;
 		}
 
+		/** get the mode the file was opened in
+		 *
+		 * @return 'r', 'w' or 'c'
+		 */
+		char get_mode() const
+		{
+			return rw;
+		}
+
 		/** get next line from file
 		 *
 		 * The returned line may be modfied in case the file was opened
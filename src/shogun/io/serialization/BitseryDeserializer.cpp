@@ -5,6 +5,8 @@
 
 #include <shogun/io/serialization/BitseryDeserializer.h>
 #include <shogun/io/serialization/BitseryVisitor.h>
+#include <shogun/io/stream/ByteArrayInputStream.h>
+#include <shogun/io/MemoryMappedFile.h>
 #include <shogun/io/ShogunErrc.h>
 #include <shogun/util/converters.h>
 #include <shogun/base/class_list.h>
@@ -13,6 +15,8 @@
 #include <bitsery/bitsery.h>
 #include <bitsery/traits/string.h>
 
+#include <array>
+
 using namespace bitsery;
 using namespace shogun;
 using namespace shogun::io;
@@ -49,6 +53,38 @@ public:
 		SG_DEBUG("read floatmax_t with value {}", *v);
 	}
 
+	template <typename U>
+	void on_buffer(S& s, U* v, size_t length)
+	{
+		if (m_page_aligned)
+			skip_padding(s);
+		AdapterAccess::getReader(s).template readBuffer<sizeof(U)>(v, length);
+	}
+
+	std::shared_ptr<void> on_view(size_t element_size, int64_t length) override
+	{
+		auto bytes = element_size * utils::safe_convert<size_t>(length);
+		if (!m_page_aligned || !m_mapped_file || bytes < detail::kArrayAlignment)
+			return nullptr;
+		// arrays are stored little endian, big endian systems have to swap
+		// the bytes while copying
+		if (utils::is_big_endian())
+			return nullptr;
+
+		skip_padding(this->m_s);
+		// the stream adapter does not read ahead, so the stream is
+		// positioned at the array
+		auto offset = m_stream->tell();
+		require(offset % detail::kArrayAlignment == 0,
+			"Array at offset {} is not page aligned", offset);
+		auto ec = m_stream->skip(bytes);
+		if (ec)
+			throw io::to_system_error(ec);
+		SG_DEBUG("mapping {} bytes at offset {}", bytes, offset);
+		// the views share the ownership of the mapping
+		return std::shared_ptr<void>(m_mapped_file, m_mapped_file->get_map() + offset);
+	}
+
 	void on_object(S& s, std::shared_ptr<SGObject>* v)
 	{
 		SG_DEBUG("reading SGObject: ");
@@ -73,8 +109,24 @@ public:
 	}
 
 	std::optional<float64_t> m_auto_value;
+	bool m_page_aligned = false;
+	/** stream that is read and its file, if it is memory mapped */
+	std::shared_ptr<InputStream> m_stream;
+	std::shared_ptr<MemoryMappedFile<char>> m_mapped_file;
 
 private:
+	void skip_padding(S& s)
+	{
+		uint64_t padding;
+		s.value8b(padding);
+		require(padding < detail::kArrayAlignment, "Invalid array padding of {} bytes", padding);
+		if (padding)
+		{
+			std::array<uint8_t, detail::kArrayAlignment> ignored;
+			AdapterAccess::getReader(s).template readBuffer<1>(ignored.data(), padding);
+		}
+	}
+
 	SG_DELETE_COPY_AND_ASSIGN(BitseryReaderVisitor);
 };
 
@@ -119,6 +171,11 @@ std::shared_ptr<SGObject> object_reader(Reader& reader, BitseryReaderVisitor<Rea
 {
 	size_t obj_magic;
 	reader.value8b(obj_magic);
+	if (obj_magic == detail::kPageAlignedMagic)
+	{
+		visitor->m_page_aligned = true;
+		reader.value8b(obj_magic);
+	}
 	if (obj_magic == detail::kNullObjectMagic)
 		return nullptr;
 
@@ -176,11 +233,31 @@ BitseryDeserializer::~BitseryDeserializer()
 {
 }
 
+void BitseryDeserializer::attach(std::shared_ptr<InputStream> stream)
+{
+	Deserializer::attach(std::move(stream));
+	m_mapped_file.reset();
+}
+
+void BitseryDeserializer::attach_mapped(std::shared_ptr<MemoryMappedFile<char>> file)
+{
+	require(file, "No memory mapped file given");
+	// read-only mappings fault on writes to the arrays, shared ones would
+	// write them to the file
+	require(file->get_mode() == 'c',
+		"Memory mapped file has to be opened in copy-on-write mode 'c', "
+		"not '{}'", file->get_mode());
+	attach(std::make_shared<ByteArrayInputStream>(file->get_map(), file->get_size()));
+	m_mapped_file = std::move(file);
+}
+
 std::shared_ptr<SGObject> BitseryDeserializer::read_object()
 {
 	InputStreamAdapter adapter { stream() };
 	BitseryDeser deser {std::move(adapter)};
 	BitseryReaderVisitor<BitseryDeser> reader_visitor(deser);
+	reader_visitor.m_stream = stream();
+	reader_visitor.m_mapped_file = m_mapped_file;
 	return object_reader(deser, addressof(reader_visitor));
 }
 
@@ -189,5 +266,7 @@ void BitseryDeserializer::read(std::shared_ptr<SGObject> _this)
 	InputStreamAdapter adapter { stream() };
 	BitseryDeser deser {std::move(adapter)};
 	BitseryReaderVisitor<BitseryDeser> reader_visitor(deser);
+	reader_visitor.m_stream = stream();
+	reader_visitor.m_mapped_file = m_mapped_file;
 	object_reader(deser, addressof(reader_visitor), _this);
 }
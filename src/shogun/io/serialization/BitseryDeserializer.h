@@ -9,6 +9,8 @@
 
 namespace shogun
 {
+	template <class T> class MemoryMappedFile;
+
 	namespace io
 	{
 		class BitseryDeserializer : public Deserializer
@@ -16,13 +18,34 @@ namespace shogun
 		public:
 			BitseryDeserializer();
 			~BitseryDeserializer() override;
+			void attach(std::shared_ptr<io::InputStream> stream) override;
 			std::shared_ptr<SGObject> read_object() override;
 			void read(std::shared_ptr<SGObject> _this) override;
 
+			/** Reads from a memory mapped file. Vectors and matrices that
+			 * were written with BitserySerializer::set_page_aligned_arrays
+			 * are not copied, but refer to the mapped pages, so loading
+			 * large models only touches the pages that are used. The file
+			 * has to be mapped in copy-on-write mode 'c', so that
+			 * modifying the arrays copies the modified pages only and
+			 * never changes the file.
+			 *
+			 * The mapping is kept alive by the deserializer until
+			 * another stream is attached, and by every vector and matrix
+			 * that refers to it, so the file can be released while the
+			 * objects read from it are still used.
+			 *
+			 * @param file memory mapped file
+			 */
+			void attach_mapped(std::shared_ptr<MemoryMappedFile<char>> file);
+
 			const char* get_name() const override
 			{
 				return "BitseryDeserializer";
 			}
+
+		private:
+			std::shared_ptr<MemoryMappedFile<char>> m_mapped_file;
 		};
 	}
 }
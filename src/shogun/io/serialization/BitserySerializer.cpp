@@ -12,6 +12,8 @@
 #include <bitsery/bitsery.h>
 #include <bitsery/traits/string.h>
 
+#include <array>
+
 using namespace bitsery;
 using namespace shogun;
 using namespace shogun::io;
@@ -55,6 +57,28 @@ public:
 		writer.value8b(lsb);
 	}
 
+	template <typename U>
+	void on_buffer(Writer& writer, U* v, size_t length)
+	{
+		auto& adapter = AdapterAccess::getWriter(writer);
+		if (m_page_aligned)
+		{
+			// padding length followed by the padding itself
+			static const std::array<uint8_t, detail::kArrayAlignment> zeros{};
+			uint64_t padding = 0;
+			if (sizeof(U) * length >= detail::kArrayAlignment)
+			{
+				auto offset = adapter.writtenBytesCount() + sizeof(padding);
+				padding = (detail::kArrayAlignment - offset % detail::kArrayAlignment) %
+				          detail::kArrayAlignment;
+			}
+			writer.value8b(padding);
+			if (padding)
+				adapter.template writeBuffer<1>(zeros.data(), padding);
+		}
+		adapter.template writeBuffer<sizeof(U)>(v, length);
+	}
+
 	void on_object(Writer& writer, shared_ptr<SGObject>* v)
 	{
 		if (*v)
@@ -74,6 +98,7 @@ public:
 	}
 
 	std::optional<float64_t> m_auto_value;
+	bool m_page_aligned = false;
 };
 
 struct OutputStreamAdapter
@@ -131,7 +156,7 @@ void write_object(Writer& writer, BitseryWriterVisitor<Writer>* visitor, const s
 using OutputAdapter = AdapterWriter<OutputStreamAdapter, bitsery::DefaultConfig>;
 using BitserySer = BasicSerializer<OutputAdapter>;
 
-BitserySerializer::BitserySerializer() : Serializer()
+BitserySerializer::BitserySerializer() : Serializer(), m_page_aligned_arrays(false)
 {
 }
 
@@ -139,10 +164,25 @@ BitserySerializer::~BitserySerializer()
 {
 }
 
+void BitserySerializer::set_page_aligned_arrays(bool page_aligned_arrays)
+{
+	m_page_aligned_arrays = page_aligned_arrays;
+}
+
+bool BitserySerializer::get_page_aligned_arrays() const
+{
+	return m_page_aligned_arrays;
+}
+
 void BitserySerializer::write(const shared_ptr<SGObject>& object) noexcept(false)
 {
 	OutputStreamAdapter adapter { stream() };
  	BitserySer serializer {std::move(adapter)};
  	BitseryWriterVisitor<BitserySer> writer_visitor(serializer);
+	if (m_page_aligned_arrays)
+	{
+		serializer.value8b(detail::kPageAlignedMagic);
+		writer_visitor.m_page_aligned = true;
+	}
  	write_object(serializer, addressof(writer_visitor), object);
 }
@@ -18,10 +18,27 @@ namespace shogun
 			~BitserySerializer() override;
 			void write(const std::shared_ptr<SGObject>& object) override;
 
+			/** Start vectors and matrices of at least 4096 bytes at
+			 * offsets of the stream that are a multiple of 4096. Such
+			 * streams can be read by BitseryDeserializer as usual, but
+			 * also directly from a memory mapped file, which lets the
+			 * arrays refer to the mapped pages instead of being copied.
+			 * The stream has to be written from its beginning.
+			 *
+			 * @param page_aligned_arrays whether to align arrays
+			 */
+			void set_page_aligned_arrays(bool page_aligned_arrays);
+
+			/** @return whether arrays are page aligned */
+			bool get_page_aligned_arrays() const;
+
 			const char* get_name() const override
 			{
 				return "BitserySerializer";
 			}
+
+		private:
+			bool m_page_aligned_arrays;
 		};
 	}
 }
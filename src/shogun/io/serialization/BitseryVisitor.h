@@ -7,6 +7,7 @@
 
 #include <shogun/lib/any.h>
 #include <shogun/io/SGIO.h>
+#include <shogun/util/converters.h>
 
 namespace shogun
 {
@@ -15,6 +16,12 @@ namespace shogun
 		namespace detail
 		{
 			static const size_t kNullObjectMagic = std::numeric_limits<size_t>::max();
+			/** written before the root object of page aligned streams */
+			static const size_t kPageAlignedMagic = std::numeric_limits<size_t>::max() - 1;
+			/** arrays of at least this many bytes start at a multiple of
+			 * it in page aligned streams
+			 */
+			static const size_t kArrayAlignment = 4096;
 
 			template <class S, class T>
 			class BitseryVisitor : public AnyVisitor
@@ -119,6 +126,51 @@ namespace shogun
 				{
 				}
 
+				bool on_array(char* v, int64_t length) override
+				{
+					return visit_buffer<uint8_t>(v, length);
+				}
+				bool on_array(int8_t* v, int64_t length) override
+				{
+					return visit_buffer<uint8_t>(v, length);
+				}
+				bool on_array(uint8_t* v, int64_t length) override
+				{
+					return visit_buffer<uint8_t>(v, length);
+				}
+				bool on_array(int16_t* v, int64_t length) override
+				{
+					return visit_buffer<uint16_t>(v, length);
+				}
+				bool on_array(uint16_t* v, int64_t length) override
+				{
+					return visit_buffer<uint16_t>(v, length);
+				}
+				bool on_array(int32_t* v, int64_t length) override
+				{
+					return visit_buffer<uint32_t>(v, length);
+				}
+				bool on_array(uint32_t* v, int64_t length) override
+				{
+					return visit_buffer<uint32_t>(v, length);
+				}
+				bool on_array(int64_t* v, int64_t length) override
+				{
+					return visit_buffer<uint64_t>(v, length);
+				}
+				bool on_array(uint64_t* v, int64_t length) override
+				{
+					return visit_buffer<uint64_t>(v, length);
+				}
+				bool on_array(float32_t* v, int64_t length) override
+				{
+					return visit_buffer<uint32_t>(v, length);
+				}
+				bool on_array(float64_t* v, int64_t length) override
+				{
+					return visit_buffer<uint64_t>(v, length);
+				}
+
 				void on(std::shared_ptr<SGObject>* v) override
 				{
 					static_cast<T*>(this)->on_object(m_s, v);
@@ -132,8 +184,23 @@ namespace shogun
 				void exit_map(size_t* size) override {}
 
 			private:
-				S& m_s;
+				/** Arrays are stored as their elements would be one by
+				 * one, but with a single (endianness aware) buffer copy.
+				 */
+				template <typename U, typename V>
+				bool visit_buffer(V* v, int64_t length)
+				{
+					static_assert(sizeof(U) == sizeof(V));
+					static_cast<T*>(this)->on_buffer(
+					    m_s, reinterpret_cast<U*>(v),
+					    utils::safe_convert<size_t>(length));
+					return true;
+				}
+
 				SG_DELETE_COPY_AND_ASSIGN(BitseryVisitor);
+
+			protected:
+				S& m_s;
 			};
 		} // namespace detail
 	} // namespace io
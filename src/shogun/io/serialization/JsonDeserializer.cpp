@@ -4,6 +4,7 @@
  */
 
 #include <memory>
+#include <optional>
 #include <stack>
 #include <utility>
 
@@ -11,6 +12,7 @@
 #include <shogun/base/macros.h>
 #include <shogun/io/serialization/JsonDeserializer.h>
 #include <shogun/io/ShogunErrc.h>
+#include <shogun/util/base64.h>
 #include <shogun/util/converters.h>
 #include <shogun/util/system.h>
 
@@ -31,6 +33,8 @@ std::shared_ptr<SGObject> object_reader(V& v, JSONReaderVisitor<V>* visitor);
 extern const char* const kNameKey;
 extern const char* const kGenericKey;
 extern const char* const kParametersKey;
+extern const char* const kShapeKey;
+extern const char* const kBase64Key;
 
 template<class ValueType>
 class JSONReaderVisitor: public AnyVisitor
@@ -153,6 +157,13 @@ public:
 	}
 	void enter_matrix(index_t* rows, index_t* cols) override
 	{
+		if (auto shape = read_base64_shape(2))
+		{
+			*rows = utils::safe_convert<index_t>((*shape)[0].GetInt64());
+			*cols = utils::safe_convert<index_t>((*shape)[1].GetInt64());
+			SG_DEBUG("reading base64 matrix of size: {} x {}", *rows, *cols);
+			return;
+		}
 		auto json_array = m_value_stack.top()->GetArray();
 		m_value_stack.pop();
 		*cols = json_array.Size();
@@ -206,6 +217,51 @@ public:
 		m_value_stack.emplace(v);
 	}
 
+	bool on_array(char* v, int64_t length) override
+	{
+		return read_base64_array(v, length);
+	}
+	bool on_array(int8_t* v, int64_t length) override
+	{
+		return read_base64_array(v, length);
+	}
+	bool on_array(uint8_t* v, int64_t length) override
+	{
+		return read_base64_array(v, length);
+	}
+	bool on_array(int16_t* v, int64_t length) override
+	{
+		return read_base64_array(v, length);
+	}
+	bool on_array(uint16_t* v, int64_t length) override
+	{
+		return read_base64_array(v, length);
+	}
+	bool on_array(int32_t* v, int64_t length) override
+	{
+		return read_base64_array(v, length);
+	}
+	bool on_array(uint32_t* v, int64_t length) override
+	{
+		return read_base64_array(v, length);
+	}
+	bool on_array(int64_t* v, int64_t length) override
+	{
+		return read_base64_array(v, length);
+	}
+	bool on_array(uint64_t* v, int64_t length) override
+	{
+		return read_base64_array(v, length);
+	}
+	bool on_array(float32_t* v, int64_t length) override
+	{
+		return read_base64_array(v, length);
+	}
+	bool on_array(float64_t* v, int64_t length) override
+	{
+		return read_base64_array(v, length);
+	}
+
 	void enter_matrix_row(index_t *rows, index_t *cols) override {}
 	void exit_matrix_row(index_t *rows, index_t *cols) override {}
 	void exit_matrix(index_t* rows, index_t* cols) override {}
@@ -226,9 +282,47 @@ private:
 		return r;
 	}
 
+	/** Pops a {"shape": [...], "base64": "..."} container of numbers
+	 * and keeps its payload for on_array, returns its shape
+	 */
+	std::optional<typename ValueType::ConstArray> read_base64_shape(size_t dims)
+	{
+		const ValueType* value = m_value_stack.top();
+		if (!value->IsObject() || !value->HasMember(kBase64Key))
+			return std::nullopt;
+		require(value->HasMember(kShapeKey), "base64 array without a shape!");
+		auto shape = (*value)[kShapeKey].GetArray();
+		require(shape.Size() == dims, "base64 array has {} dimensions, expected {}", shape.Size(), dims);
+		m_value_stack.pop();
+		m_base64_array = &(*value)[kBase64Key];
+		return shape;
+	}
+
+	template <typename T>
+	bool read_base64_array(T* v, int64_t length)
+	{
+		if (m_base64_array == nullptr)
+			return false;
+		require(!utils::is_big_endian(), "base64 arrays are only supported on little endian systems");
+		const char* text = m_base64_array->GetString();
+		size_t text_size = m_base64_array->GetStringLength();
+		m_base64_array = nullptr;
+		require(utils::base64_decoded_size(text, text_size) == sizeof(T) * length,
+			"base64 array does not hold {} elements", length);
+		require(utils::base64_decode(text, text_size, v) >= 0, "Invalid base64 array");
+		SG_DEBUG("read {} numbers from base64", length);
+		return true;
+	}
+
 	template<class T>
 	void read_array(T* size, const std::string& type)
 	{
+		if (auto shape = read_base64_shape(1))
+		{
+			*size = utils::safe_convert<T>((*shape)[0].GetInt64());
+			SG_DEBUG("reading base64 '{}' of size: {}", type.c_str(), *size);
+			return;
+		}
 		auto json_array = m_value_stack.top()->GetArray();
 		m_value_stack.pop();
 		*size = utils::safe_convert<T>(json_array.Size());
@@ -246,6 +340,7 @@ private:
 
 private:
 	stack<const ValueType*> m_value_stack;
+	const ValueType* m_base64_array = nullptr;
 	SG_DELETE_COPY_AND_ASSIGN(JSONReaderVisitor);
 };
 
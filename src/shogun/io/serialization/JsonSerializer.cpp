@@ -8,6 +8,7 @@
 
 #include <shogun/io/ShogunErrc.h>
 #include <shogun/io/serialization/JsonSerializer.h>
+#include <shogun/util/base64.h>
 #include <shogun/util/converters.h>
 #include <shogun/util/system.h>
 
@@ -24,6 +25,10 @@ extern const char* const kGenericKey;
 const char* const kGenericKey = "generic";
 extern const char* const kParametersKey;
 const char* const kParametersKey = "parameters";
+extern const char* const kShapeKey;
+const char* const kShapeKey = "shape";
+extern const char* const kBase64Key;
+const char* const kBase64Key = "base64";
 
 struct OutputStreamAdapter
 {
@@ -49,91 +54,105 @@ class JSONWriterVisitor : public AnyVisitor
 {
 	const int64_t in_object = -1;
 public:
-	JSONWriterVisitor(Writer& jw):
-		AnyVisitor(), m_json_writer(jw) {}
+	JSONWriterVisitor(Writer& jw, bool base64_arrays = false):
+		AnyVisitor(), m_json_writer(jw), m_base64_arrays(base64_arrays) {}
 
 	~JSONWriterVisitor() override {}
 
 	void on(bool* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing bool with value {}", *v);
 		m_json_writer.Bool(*v);
 		close_container();
 	}
 	void on(std::vector<bool>::reference* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing bool with value {}", *v);
 		m_json_writer.Bool(*v);
 		close_container();
 	}
 	void on(char* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing char with value {}", *v);
 		m_json_writer.Int(*v);
 		close_container();
 	}
 	void on(int8_t* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing int8_t with value {}", *v);
 		m_json_writer.Int(*v);
 		close_container();
 	}
 	void on(uint8_t* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing uint8_t with value {}", *v);
 		m_json_writer.Uint(*v);
 		close_container();
 	}
 	void on(int16_t* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing int16_t with value {}", *v);
 		m_json_writer.Int(*v);
 		close_container();
 	}
 	void on(uint16_t* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing uint16_t with value {}", *v);
 		m_json_writer.Uint(*v);
 		close_container();
 	}
 	void on(int32_t* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing int32_t with value {}", *v);
 		m_json_writer.Int(*v);
 		close_container();
 	}
 	void on(uint32_t* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing uint32_t with value {}", *v);
 		m_json_writer.Uint(*v);
 		close_container();
 	}
 	void on(int64_t* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing int64_t with value {}", *v);
 		m_json_writer.Int64(*v);
 		close_container();
 	}
 	void on(uint64_t* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing uint64_t with value {}", *v);
 		m_json_writer.Uint64(*v);
 		close_container();
 	}
 	void on(float* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing float with value {}", *v);
 		m_json_writer.Double(*v);
 		close_container();
 	}
 	void on(float64_t* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing double with value {}", *v);
 		m_json_writer.Double(*v);
 		close_container();
 	}
 	void on(floatmax_t* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing floatmax_t with value {}", *v);
 		uint64_t msb, lsb;
 		m_json_writer.StartArray();
@@ -161,6 +180,7 @@ public:
 	}
 	void on(complex128_t* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing complex128_t with value ({}, {})", v->real(), v->imag());
 		m_json_writer.StartArray();
 		m_json_writer.Double(v->real());
@@ -170,16 +190,19 @@ public:
 	}
 	void on(string* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing std::string with value {}", v->c_str());
 		m_json_writer.String(v->c_str());
 	}
 	void on(AutoValueEmpty* v) override
 	{
+		flush_pending_array();
 		SG_DEBUG("writing empty auto value");
 		m_json_writer.String("auto");
 	}
 	void on(shared_ptr<SGObject>* v) override
 	{
+		flush_pending_array();
 		if (*v)
 		{
 			SG_DEBUG("writing SGObject: {}", (*v)->get_name());
@@ -195,6 +218,9 @@ public:
 	void enter_matrix(index_t* rows, index_t* cols) override
 	{
 		SG_DEBUG("writing matrix of size: {} x {}", *rows, *cols);
+		flush_pending_array();
+		if (defer_array({*rows, *cols}))
+			return;
 		m_json_writer.StartArray();
 		if (*cols == 0 || *rows == 0)
 		{
@@ -210,6 +236,9 @@ public:
 	void enter_vector(index_t* size) override
 	{
 		SG_DEBUG("writing vector of size: {}", *size);
+		flush_pending_array();
+		if (defer_array({*size}))
+			return;
 		m_json_writer.StartArray();
 		if (*size == 0)
 			m_json_writer.EndArray();
@@ -219,6 +248,9 @@ public:
 	void enter_std_vector(size_t* size) override
 	{
 		SG_DEBUG("writing std::vector of size: {}", *size);
+		flush_pending_array();
+		if (defer_array({utils::safe_convert<int64_t>(*size)}))
+			return;
 		m_json_writer.StartArray();
 		if (*size == 0)
 			m_json_writer.EndArray();
@@ -228,6 +260,7 @@ public:
 	void enter_map(size_t* size) override
 	{
 		SG_DEBUG("writing map of size: {}", *size);
+		flush_pending_array();
 		m_json_writer.StartArray();
 		if (*size == 0)
 		{
@@ -250,6 +283,51 @@ public:
 		m_remaining.pop();
 	}
 
+	bool on_array(char* v, int64_t length) override
+	{
+		return write_array(v, length);
+	}
+	bool on_array(int8_t* v, int64_t length) override
+	{
+		return write_array(v, length);
+	}
+	bool on_array(uint8_t* v, int64_t length) override
+	{
+		return write_array(v, length);
+	}
+	bool on_array(int16_t* v, int64_t length) override
+	{
+		return write_array(v, length);
+	}
+	bool on_array(uint16_t* v, int64_t length) override
+	{
+		return write_array(v, length);
+	}
+	bool on_array(int32_t* v, int64_t length) override
+	{
+		return write_array(v, length);
+	}
+	bool on_array(uint32_t* v, int64_t length) override
+	{
+		return write_array(v, length);
+	}
+	bool on_array(int64_t* v, int64_t length) override
+	{
+		return write_array(v, length);
+	}
+	bool on_array(uint64_t* v, int64_t length) override
+	{
+		return write_array(v, length);
+	}
+	bool on_array(float32_t* v, int64_t length) override
+	{
+		return write_array(v, length);
+	}
+	bool on_array(float64_t* v, int64_t length) override
+	{
+		return write_array(v, length);
+	}
+
 	void enter_matrix_row(index_t *rows, index_t *cols) override {}
 	void enter_auto_value(bool*) override {}
 	void exit_matrix_row(index_t *rows, index_t *cols) override {}
@@ -258,6 +336,67 @@ public:
 	void exit_std_vector(size_t* size) override {}
 	void exit_map(size_t* size) override {}
 private:
+	/** With base64 arrays, whether a container is written as array of
+	 * numbers is only known when its elements are visited. Non empty
+	 * containers are hence started lazily.
+	 */
+	bool defer_array(std::vector<int64_t> shape)
+	{
+		if (!m_base64_arrays)
+			return false;
+		for (auto extent: shape)
+		{
+			if (extent == 0)
+				return false;
+		}
+		m_pending_shape = std::move(shape);
+		return true;
+	}
+
+	/** Starts a deferred container as an array of JSON values */
+	void flush_pending_array()
+	{
+		if (m_pending_shape.empty())
+			return;
+		auto shape = std::move(m_pending_shape);
+		m_pending_shape.clear();
+		m_json_writer.StartArray();
+		if (shape.size() == 2)
+		{
+			m_remaining.emplace(shape[0], shape[1]);
+			m_remaining.emplace(shape[0], 0LL);
+			m_json_writer.StartArray();
+		}
+		else
+		{
+			m_remaining.emplace(shape[0], 0LL);
+		}
+	}
+
+	/** Writes a deferred container of numbers as
+	 * {"shape": [...], "base64": "..."} with little endian elements
+	 */
+	template <typename T>
+	bool write_array(T* v, int64_t length)
+	{
+		if (m_pending_shape.empty() || utils::is_big_endian())
+			return false;
+		SG_DEBUG("writing {} numbers as base64", length);
+		m_json_writer.StartObject();
+		m_json_writer.Key(kShapeKey);
+		m_json_writer.StartArray();
+		for (auto extent: m_pending_shape)
+			m_json_writer.Int64(extent);
+		m_json_writer.EndArray();
+		m_json_writer.Key(kBase64Key);
+		auto encoded = utils::base64_encode(v, sizeof(T) * length);
+		m_json_writer.String(encoded.c_str(), utils::safe_convert<SizeType>(encoded.size()));
+		m_json_writer.EndObject();
+		m_pending_shape.clear();
+		close_container();
+		return true;
+	}
+
 	inline void close_container()
 	{
 		if (m_remaining.empty() || get<0>(m_remaining.top()) == in_object)
@@ -292,6 +431,8 @@ private:
 private:
 	Writer& m_json_writer;
 	stack<tuple<int64_t, int64_t>> m_remaining;
+	bool m_base64_arrays;
+	std::vector<int64_t> m_pending_shape;
 	SG_DELETE_COPY_AND_ASSIGN(JSONWriterVisitor);
 };
 
@@ -327,8 +468,18 @@ void write_object(Writer& writer, JSONWriterVisitor<Writer>* visitor, const shar
 
 using JsonWriter = Writer<OutputStreamAdapter, UTF8<>, UTF8<>, CrtAllocator, kWriteNanAndInfFlag>;
 
-JsonSerializer::JsonSerializer() : Serializer()
+JsonSerializer::JsonSerializer() : Serializer(), m_base64_arrays(false)
+{
+}
+
+void JsonSerializer::set_base64_arrays(bool base64_arrays)
+{
+	m_base64_arrays = base64_arrays;
+}
+
+bool JsonSerializer::get_base64_arrays() const
 {
+	return m_base64_arrays;
 }
 
 JsonSerializer::~JsonSerializer()
@@ -340,6 +491,6 @@ void JsonSerializer::write(const shared_ptr<SGObject>& object) noexcept(false)
 	OutputStreamAdapter adapter { stream() };
 	JsonWriter writer(adapter);
 	auto writer_visitor =
-		make_unique<JSONWriterVisitor<JsonWriter>>(writer);
+		make_unique<JSONWriterVisitor<JsonWriter>>(writer, m_base64_arrays);
 	write_object(writer, writer_visitor.get(), object);
 }
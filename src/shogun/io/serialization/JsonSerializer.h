@@ -18,10 +18,25 @@ namespace shogun
 			~JsonSerializer() override;
 			void write(const std::shared_ptr<SGObject>& object) override;
 
+			/** Write vectors and matrices of numbers as base64 encoded
+			 * binary instead of arrays of JSON numbers. It is much
+			 * faster and smaller, but not human readable. Reading
+			 * supports both.
+			 *
+			 * @param base64_arrays whether to encode arrays as base64
+			 */
+			void set_base64_arrays(bool base64_arrays);
+
+			/** @return whether arrays are encoded as base64 */
+			bool get_base64_arrays() const;
+
 			const char* get_name() const override
 			{
 				return "JsonSerializer";
 			}
+
+		private:
+			bool m_base64_arrays;
 		};
 	}
 }
@@ -15,6 +15,8 @@
 #include <shogun/kernel/CustomKernel.h>
 #include <shogun/features/CombinedFeatures.h>
 #include <string.h>
+#include <algorithm>
+#include <unordered_map>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/eigen3.h>
 
@@ -183,6 +185,8 @@ bool CombinedKernel::init(std::shared_ptr<Features> l, std::shared_ptr<Features>
 		init_subkernel_weights();
 	}
 
+	clear_subkernel_cache();
+
 	if (!l)
 		error("LHS features are NULL");
 	if (!r)
@@ -254,6 +258,7 @@ bool CombinedKernel::init(std::shared_ptr<Features> l, std::shared_ptr<Features>
 
 void CombinedKernel::remove_lhs()
 {
+	clear_subkernel_cache();
 	delete_optimization();
 
 	for (index_t k_idx=0; k_idx<get_num_kernels(); k_idx++)
@@ -271,6 +276,7 @@ void CombinedKernel::remove_lhs()
 
 void CombinedKernel::remove_rhs()
 {
+	clear_subkernel_cache();
 	delete_optimization();
 
 	for (index_t k_idx=0; k_idx<get_num_kernels(); k_idx++)
@@ -288,6 +294,7 @@ void CombinedKernel::remove_rhs()
 
 void CombinedKernel::remove_lhs_and_rhs()
 {
+	clear_subkernel_cache();
 	delete_optimization();
 
 	for (index_t k_idx=0; k_idx<get_num_kernels(); k_idx++)
@@ -307,6 +314,7 @@ void CombinedKernel::remove_lhs_and_rhs()
 
 void CombinedKernel::cleanup()
 {
+	clear_subkernel_cache();
 	for (index_t k_idx=0; k_idx<get_num_kernels(); k_idx++)
 	{
 		auto k = get_kernel(k_idx);
@@ -436,6 +444,8 @@ void CombinedKernel::compute_batch(
 	//make sure we start cleanly
 	delete_optimization();
 
+	// subkernels without batch evaluation and linadd are evaluated together
+	std::vector<std::shared_ptr<Kernel>> tiled_kernels;
 	for (index_t k_idx=0; k_idx<get_num_kernels(); k_idx++)
 	{
 		auto k = get_kernel(k_idx);
@@ -444,12 +454,15 @@ void CombinedKernel::compute_batch(
 			if (k->get_combined_kernel_weight()!=0)
 				k->compute_batch(num_vec, vec_idx, result, num_suppvec, IDX, weights, k->get_combined_kernel_weight());
 		}
-		else
+		else if (k->has_property(KP_LINADD))
 			emulate_compute_batch(k, num_vec, vec_idx, result, num_suppvec, IDX, weights);
-
-
+		else if (k->get_combined_kernel_weight()!=0)
+			tiled_kernels.push_back(k);
 	}
 
+	if (!tiled_kernels.empty())
+		compute_batch_tiled(tiled_kernels, num_vec, vec_idx, result, num_suppvec, IDX, weights);
+
 	//clean up
 	delete_optimization();
 }
@@ -494,6 +507,246 @@ void CombinedKernel::emulate_compute_batch(
 	}
 }
 
+void CombinedKernel::compute_batch_tiled(
+	const std::vector<std::shared_ptr<Kernel>>& kernels, int32_t num_vec,
+	int32_t* vec_idx, float64_t* result, int32_t num_suppvec, int32_t* IDX,
+	float64_t* weights)
+{
+	ASSERT(IDX!=NULL || num_suppvec==0)
+	ASSERT(weights!=NULL || num_suppvec==0)
+
+	const auto tile = subkernel_tile_size;
+
+	#pragma omp parallel for schedule(dynamic)
+	for (int32_t start=0; start<num_vec; start+=tile)
+	{
+		auto end = std::min(start+tile, (index_t)num_vec);
+		SGVector<index_t> idx_vec(vec_idx+start, end-start, false);
+		VectorXd sub_result(end-start);
+
+		for (const auto& k : kernels)
+		{
+			sub_result.setZero();
+
+			for (int32_t sv_start=0; sv_start<num_suppvec; sv_start+=tile)
+			{
+				auto sv_end = std::min(sv_start+tile, (index_t)num_suppvec);
+				SGVector<index_t> idx_sv(IDX+sv_start, sv_end-sv_start, false);
+				SGMatrix<float64_t> block(sv_end-sv_start, end-start);
+				k->compute_kernel_block(idx_sv, idx_vec, block);
+
+				Map<MatrixXd> K(block.matrix, block.num_rows, block.num_cols);
+				Map<VectorXd> w(weights+sv_start, sv_end-sv_start);
+				sub_result.noalias() += K.transpose()*w;
+			}
+
+			auto w = k->get_combined_kernel_weight();
+			for (int32_t i=start; i<end; i++)
+				result[i] += w*sub_result[i-start];
+		}
+	}
+}
+
+std::vector<SGMatrix<float64_t>> CombinedKernel::get_subkernel_matrices(
+	const SGVector<index_t>& idx_a, const SGVector<index_t>& idx_b)
+{
+	require(get_num_kernels() > 0, "No subkernels");
+	require(lhs && rhs, "Kernel not initialized");
+
+	const auto num_kernels = get_num_kernels();
+	std::vector<SGMatrix<float64_t>> matrices(num_kernels);
+	for (auto& m : matrices)
+		m = SGMatrix<float64_t>(idx_a.vlen, idx_b.vlen);
+
+	const auto tile = subkernel_tile_size;
+
+	#pragma omp parallel for schedule(dynamic)
+	for (index_t start=0; start<idx_a.vlen; start+=tile)
+	{
+		auto end = std::min(start+tile, idx_a.vlen);
+		SGVector<index_t> idx_rows(idx_a.vector+start, end-start, false);
+		SGMatrix<float64_t> block(end-start, idx_b.vlen);
+		for (index_t k_idx=0; k_idx<num_kernels; k_idx++)
+		{
+			kernel_array[k_idx]->compute_kernel_block(idx_rows, idx_b, block);
+			auto& m = matrices[k_idx];
+			for (index_t j=0; j<idx_b.vlen; j++)
+			{
+				for (index_t i=start; i<end; i++)
+					m(i, j) = block(i-start, j);
+			}
+		}
+	}
+
+	return matrices;
+}
+
+SGVector<float64_t> CombinedKernel::compute_subkernel_quadratic_forms(
+	const SGVector<index_t>& idx, const SGVector<float64_t>& weights)
+{
+	require(get_num_kernels() > 0, "No subkernels");
+	require(lhs && rhs, "Kernel not initialized");
+	require(
+	    idx.vlen == weights.vlen,
+	    "Number of indices ({}) and weights ({}) must match", idx.vlen,
+	    weights.vlen);
+
+	const auto num_kernels = get_num_kernels();
+	const auto n = idx.vlen;
+
+	// without enough memory for the cache, the subkernels are evaluated
+	// again on every call
+	int64_t cache_bytes = int64_t(num_kernels)*n*n*sizeof(float64_t);
+	if (cache_bytes > int64_t(subkernel_cache_size)*1024*1024)
+	{
+		clear_subkernel_cache();
+		return compute_subkernel_quadratic_forms_uncached(idx, weights);
+	}
+
+	if (subkernel_cache.size() != (size_t)num_kernels)
+		clear_subkernel_cache();
+
+	// position of every index in the previous index set, -1 if new
+	std::unordered_map<index_t, index_t> previous;
+	for (index_t i=0; i<subkernel_cache_idx.vlen; i++)
+		previous.emplace(subkernel_cache_idx[i], i);
+
+	SGVector<index_t> position(n);
+	bool unchanged = n == subkernel_cache_idx.vlen;
+	for (index_t i=0; i<n; i++)
+	{
+		auto it = previous.find(idx[i]);
+		position[i] = it != previous.end() ? it->second : -1;
+		unchanged &= position[i] == i;
+	}
+
+	if (!unchanged)
+	{
+		std::vector<SGMatrix<float64_t>> cache(num_kernels);
+		for (auto& m : cache)
+			m = SGMatrix<float64_t>(n, n);
+
+		const auto tile = subkernel_tile_size;
+		const auto num_tiles = (n+tile-1)/tile;
+
+		// whether all vectors of a tile are in the cache
+		std::vector<char> tile_cached(num_tiles, true);
+		for (index_t i=0; i<n; i++)
+			tile_cached[i/tile] &= position[i] >= 0;
+
+		// kernels are symmetric, tiles of rows fill the upper triangle
+		#pragma omp parallel for schedule(dynamic)
+		for (index_t t=0; t<num_tiles; t++)
+		{
+			auto start = t*tile;
+			auto end = std::min(start+tile, n);
+			SGVector<index_t> idx_rows(idx.vector+start, end-start, false);
+			for (index_t u=t; u<num_tiles; u++)
+			{
+				auto col_start = u*tile;
+				auto col_end = std::min(col_start+tile, n);
+				SGVector<index_t> idx_cols(
+				    idx.vector+col_start, col_end-col_start, false);
+				bool cached = tile_cached[t] && tile_cached[u];
+				SGMatrix<float64_t> block;
+				if (!cached)
+					block = SGMatrix<float64_t>(end-start, col_end-col_start);
+
+				for (index_t k_idx=0; k_idx<num_kernels; k_idx++)
+				{
+					const auto& old_m = subkernel_cache[k_idx];
+					auto& m = cache[k_idx];
+					if (!cached)
+					{
+						kernel_array[k_idx]->compute_kernel_block(
+						    idx_rows, idx_cols, block);
+					}
+					for (index_t j=col_start; j<col_end; j++)
+					{
+						for (index_t i=start; i<end; i++)
+						{
+							auto value = cached
+							                 ? old_m(position[i], position[j])
+							                 : block(i-start, j-col_start);
+							m(i, j) = value;
+							m(j, i) = value;
+						}
+					}
+				}
+			}
+		}
+
+		subkernel_cache = std::move(cache);
+		subkernel_cache_idx = idx.clone();
+	}
+
+	SGVector<float64_t> result(num_kernels);
+	Map<VectorXd> w(weights.vector, n);
+	for (index_t k_idx=0; k_idx<num_kernels; k_idx++)
+	{
+		Map<MatrixXd> m(subkernel_cache[k_idx].matrix, n, n);
+		result[k_idx] = w.dot(m * w);
+	}
+
+	return result;
+}
+
+SGVector<float64_t> CombinedKernel::compute_subkernel_quadratic_forms_uncached(
+	const SGVector<index_t>& idx, const SGVector<float64_t>& weights)
+{
+	const auto num_kernels = get_num_kernels();
+	const auto n = idx.vlen;
+	const auto tile = subkernel_tile_size;
+	const auto num_tiles = (n+tile-1)/tile;
+
+	// contribution of every tile of rows, summed up in order afterwards
+	SGMatrix<float64_t> partial(num_kernels, num_tiles);
+	partial.zero();
+
+	// kernels are symmetric, off-diagonal tiles count twice
+	#pragma omp parallel for schedule(dynamic)
+	for (index_t t=0; t<num_tiles; t++)
+	{
+		auto start = t*tile;
+		auto end = std::min(start+tile, n);
+		SGVector<index_t> idx_rows(idx.vector+start, end-start, false);
+		Map<VectorXd> w_rows(weights.vector+start, end-start);
+		for (index_t u=t; u<num_tiles; u++)
+		{
+			auto col_start = u*tile;
+			auto col_end = std::min(col_start+tile, n);
+			SGVector<index_t> idx_cols(
+			    idx.vector+col_start, col_end-col_start, false);
+			Map<VectorXd> w_cols(weights.vector+col_start, col_end-col_start);
+			SGMatrix<float64_t> block(end-start, col_end-col_start);
+			Map<MatrixXd> K(block.matrix, block.num_rows, block.num_cols);
+
+			for (index_t k_idx=0; k_idx<num_kernels; k_idx++)
+			{
+				kernel_array[k_idx]->compute_kernel_block(
+				    idx_rows, idx_cols, block);
+				partial(k_idx, t) += (u==t ? 1.0 : 2.0)*w_rows.dot(K*w_cols);
+			}
+		}
+	}
+
+	SGVector<float64_t> result(num_kernels);
+	result.zero();
+	for (index_t t=0; t<num_tiles; t++)
+	{
+		for (index_t k_idx=0; k_idx<num_kernels; k_idx++)
+			result[k_idx] += partial(k_idx, t);
+	}
+
+	return result;
+}
+
+void CombinedKernel::clear_subkernel_cache()
+{
+	subkernel_cache_idx = SGVector<index_t>();
+	subkernel_cache.clear();
+}
+
 float64_t CombinedKernel::compute_optimized(int32_t idx)
 {
 	if (!get_is_initialized())
@@ -758,6 +1011,10 @@ void CombinedKernel::init()
 	weight_update = false;
 	SG_ADD(&weight_update, "weight_update",
 	    "weight update");
+
+	subkernel_cache_size = 128;
+	SG_ADD(&subkernel_cache_size, "subkernel_cache_size",
+	    "Memory budget in MB of cached subkernel quadratic forms.");
 }
 
 void CombinedKernel::enable_subkernel_weight_learning()
@@ -162,6 +162,7 @@ class CombinedKernel : public Kernel
 				unset_property(KP_LINADD);
 
 			kernel_array.insert(kernel_array.begin() + idx, k);
+			clear_subkernel_cache();
 			return true;
 		}
 
@@ -206,6 +207,7 @@ class CombinedKernel : public Kernel
 
 			int n = get_num_kernels();
 			kernel_array.push_back(k);
+			clear_subkernel_cache();
 
 			if(enable_subkernel_weight_opt && n+1==get_num_kernels())
 				enable_subkernel_weight_learning();
@@ -227,6 +229,7 @@ class CombinedKernel : public Kernel
 			    kernel_array.size());
 
 			kernel_array.erase(kernel_array.begin() + idx);
+			clear_subkernel_cache();
 
 			if (get_num_kernels()==0)
 			{
@@ -440,6 +443,43 @@ class CombinedKernel : public Kernel
 		 */
 		virtual void enable_subkernel_weight_learning();
 
+		/** Computes the kernel matrices of all subkernels between the lhs
+		 * vectors idx_a and the rhs vectors idx_b. Rows are evaluated in
+		 * parallel tiles and all subkernels are evaluated within a tile, so
+		 * that the feature vectors of a tile are shared between subkernels.
+		 * Subkernel weights are not applied.
+		 *
+		 * @param idx_a lhs vector indices
+		 * @param idx_b rhs vector indices
+		 * @return one idx_a.vlen x idx_b.vlen matrix per subkernel
+		 */
+		std::vector<SGMatrix<float64_t>> get_subkernel_matrices(
+		    const SGVector<index_t>& idx_a, const SGVector<index_t>& idx_b);
+
+		/** Computes the quadratic forms
+		 * \f$\sum_{i,j} w_i w_j k_m(x_{idx_i}, x_{idx_j})\f$ of every
+		 * subkernel \f$k_m\f$, ignoring the subkernel weights.
+		 *
+		 * The subkernel values between the vectors idx are cached, so that
+		 * repeated calls with a partially changed index set (e.g. the support
+		 * vectors of consecutive MKL iterations) only evaluate the subkernels
+		 * on new pairs of vectors, while changed weights cost a weighted sum.
+		 * Lhs and rhs have to be the same features. The cache is dropped when
+		 * the kernel is re-initialized or cleaned up. If the cache would
+		 * exceed subkernel_cache_size MB, the subkernels are evaluated again
+		 * on every call instead.
+		 *
+		 * @param idx vector indices
+		 * @param weights weight of each vector
+		 * @return quadratic form of each subkernel
+		 */
+		SGVector<float64_t> compute_subkernel_quadratic_forms(
+		    const SGVector<index_t>& idx, const SGVector<float64_t>& weights);
+
+		/** drop the cached subkernel values of
+		 * compute_subkernel_quadratic_forms */
+		void clear_subkernel_cache();
+
 	protected:
 		virtual void init_subkernel_weights();
 
@@ -513,6 +553,19 @@ class CombinedKernel : public Kernel
 		    const std::shared_ptr<Features>& lhs, const std::shared_ptr<Features>& rhs, const SGVector<index_t>& lhs_subset,
 		    const SGVector<index_t>& rhs_subset);
 
+		/** evaluate the support vector expansion of several subkernels at
+		 * once, in blocks of vectors and support vectors
+		 */
+		void compute_batch_tiled(
+		    const std::vector<std::shared_ptr<Kernel>>& kernels, int32_t num_vec,
+		    int32_t* vec_idx, float64_t* result, int32_t num_suppvec,
+		    int32_t* IDX, float64_t* weights);
+
+		/** compute_subkernel_quadratic_forms without the cache, in tiles of
+		 * the symmetric subkernel matrices */
+		SGVector<float64_t> compute_subkernel_quadratic_forms_uncached(
+		    const SGVector<index_t>& idx, const SGVector<float64_t>& weights);
+
 	protected:
 		/** list of kernels */
 		std::vector<std::shared_ptr<Kernel>> kernel_array;
@@ -536,6 +589,17 @@ class CombinedKernel : public Kernel
 		bool enable_subkernel_weight_opt;
 		/** update the weight for subkernels */
 		bool weight_update;
+
+		/** vector indices of the cached subkernel values */
+		SGVector<index_t> subkernel_cache_idx;
+		/** cached subkernel matrices between subkernel_cache_idx */
+		std::vector<SGMatrix<float64_t>> subkernel_cache;
+		/** memory budget of subkernel_cache in MB */
+		int32_t subkernel_cache_size;
+
+		/** number of vectors evaluated together in tiled subkernel
+		 * evaluation */
+		static constexpr index_t subkernel_tile_size = 64;
 };
 }
 #endif /* _COMBINEDKERNEL_H__ */
@@ -7,13 +7,20 @@
  */
 
 #include <shogun/distance/EuclideanDistance.h>
+#include <shogun/features/DenseFeatures.h>
 #include <shogun/features/DotFeatures.h>
 #include <shogun/kernel/GaussianKernel.h>
+#include <shogun/kernel/normalizer/IdentityKernelNormalizer.h>
 #include <shogun/lib/auto_initialiser.h>
 #include <shogun/lib/common.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/eigen3.h>
+
+#include <algorithm>
+#include <typeinfo>
 
 using namespace shogun;
+using namespace Eigen;
 
 GaussianKernel::GaussianKernel() : ShiftInvariantKernel()
 {
@@ -106,6 +113,62 @@ SGMatrix<float64_t> GaussianKernel::get_parameter_gradient(Parameters::const_ref
 	}
 }
 
+void GaussianKernel::compute_kernel_block(
+	const SGVector<index_t>& idx_a, const SGVector<index_t>& idx_b,
+	SGMatrix<float64_t>& block)
+{
+	// subclasses such as GaussianShiftKernel override compute() with a
+	// different function, which the fast path does not know of
+	if (typeid(*this)!=typeid(GaussianKernel))
+	{
+		Kernel::compute_kernel_block(idx_a, idx_b, block);
+		return;
+	}
+
+	auto dist=std::dynamic_pointer_cast<EuclideanDistance>(m_distance);
+	bool is_dense=lhs && rhs && lhs->get_feature_class()==C_DENSE &&
+		lhs->get_feature_type()==F_DREAL && rhs->get_feature_class()==C_DENSE &&
+		rhs->get_feature_type()==F_DREAL;
+	if (!is_dense || !dist || has_precomputed_distance())
+	{
+		Kernel::compute_kernel_block(idx_a, idx_b, block);
+		return;
+	}
+
+	require(block.num_rows==idx_a.vlen && block.num_cols==idx_b.vlen,
+			"Block ({} x {}) does not match the number of indices ({} x {})!",
+			block.num_rows, block.num_cols, idx_a.vlen, idx_b.vlen);
+
+	auto lhs_dense=std::static_pointer_cast<DenseFeatures<float64_t>>(lhs);
+	auto rhs_dense=std::static_pointer_cast<DenseFeatures<float64_t>>(rhs);
+	auto lhs_norms=dist->get_lhs_squared_norms();
+	auto rhs_norms=dist->get_rhs_squared_norms();
+	const auto dim=lhs_dense->get_num_features();
+
+	MatrixXd a(dim, idx_a.vlen);
+	for (index_t i=0; i<idx_a.vlen; ++i)
+		a.col(i)=Map<VectorXd>(lhs_dense->get_feature_vector(idx_a[i]).vector, dim);
+	MatrixXd b(dim, idx_b.vlen);
+	for (index_t j=0; j<idx_b.vlen; ++j)
+		b.col(j)=Map<VectorXd>(rhs_dense->get_feature_vector(idx_b[j]).vector, dim);
+
+	Map<MatrixXd> result(block.matrix, block.num_rows, block.num_cols);
+	result.noalias()=-2*a.transpose()*b;
+
+	const auto width=get_width();
+	const bool identity=std::dynamic_pointer_cast<IdentityKernelNormalizer>(normalizer)!=nullptr;
+	for (index_t j=0; j<idx_b.vlen; ++j)
+	{
+		for (index_t i=0; i<idx_a.vlen; ++i)
+		{
+			auto sq_dist=std::max(0.0, result(i, j)+lhs_norms[idx_a[i]]+rhs_norms[idx_b[j]]);
+			result(i, j)=std::exp(-sq_dist/width);
+			if (!identity)
+				result(i, j)=normalizer->normalize(result(i, j), idx_a[i], idx_b[j]);
+		}
+	}
+}
+
 float64_t GaussianKernel::compute(int32_t idx_a, int32_t idx_b)
 {
     float64_t result=distance(idx_a, idx_b);
@@ -136,6 +136,19 @@ public:
 	 */
 	SGMatrix<float64_t> get_parameter_gradient(Parameters::const_reference param, index_t index=-1) override;
 
+	/** Computes the kernel values between the lhs vectors idx_a and the rhs
+	 * vectors idx_b. For dense real valued features, the squared distances
+	 * are computed from the precomputed squared norms and a single matrix
+	 * product of the feature vectors. Subclasses use the generic evaluation.
+	 *
+	 * @param idx_a lhs vector indices
+	 * @param idx_b rhs vector indices
+	 * @param block preallocated idx_a.vlen x idx_b.vlen result matrix
+	 */
+	void compute_kernel_block(
+		const SGVector<index_t>& idx_a, const SGVector<index_t>& idx_b,
+		SGMatrix<float64_t>& block) override;
+
 	/** Can (optionally) be overridden to post-initialize some member
 	 * variables which are not PARAMETER::ADD'ed. Make sure that at first
 	 * the overridden method BASE_CLASS::LOAD_SERIALIZABLE_POST is called.
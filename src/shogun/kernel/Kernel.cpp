@@ -998,6 +998,22 @@ template <class T> struct K_THREAD_PARAM
 };
 }
 
+void Kernel::compute_kernel_block(
+	const SGVector<index_t>& idx_a, const SGVector<index_t>& idx_b,
+	SGMatrix<float64_t>& block)
+{
+	require(has_features(), "No features assigned to kernel");
+	require(block.num_rows==idx_a.vlen && block.num_cols==idx_b.vlen,
+			"Block ({} x {}) does not match the number of indices ({} x {})!",
+			block.num_rows, block.num_cols, idx_a.vlen, idx_b.vlen);
+
+	for (index_t j=0; j<idx_b.vlen; ++j)
+	{
+		for (index_t i=0; i<idx_a.vlen; ++i)
+			block(i, j)=kernel(idx_a[i], idx_b[j]);
+	}
+}
+
 float64_t Kernel::sum_symmetric_block(index_t block_begin, index_t block_size,
 		bool no_diag)
 {
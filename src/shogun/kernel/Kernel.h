@@ -273,6 +273,20 @@ class Kernel : public SGObject
 			return row;
 		}
 
+		/** Computes the kernel values between the lhs vectors idx_a and the
+		 * rhs vectors idx_b. Kernels on dense features may override this to
+		 * evaluate the whole block with a matrix product instead of single
+		 * kernel evaluations. It is not parallelized itself, so that it can
+		 * be called from within parallel regions.
+		 *
+		 * @param idx_a lhs vector indices
+		 * @param idx_b rhs vector indices
+		 * @param block preallocated idx_a.vlen x idx_b.vlen result matrix
+		 */
+		virtual void compute_kernel_block(
+			const SGVector<index_t>& idx_a, const SGVector<index_t>& idx_b,
+			SGMatrix<float64_t>& block);
+
 		/**
 		 * Computes sum from a symmetric part of the kernel matrix that always
 		 * is supposed to contain the main upper diagonal.
@@ -53,6 +53,17 @@ SGMatrix<T>::SGMatrix(T* m, index_t nrows, index_t ncols, index_t offset)
 #endif
 }
 
+template <class T>
+SGMatrix<T>::SGMatrix(T* m, index_t nrows, index_t ncols, std::shared_ptr<const void> owner)
+	: SGReferencedData(false), matrix(m),
+	num_rows(nrows), num_cols(ncols), gpu_ptr(nullptr),
+	memory_owner(std::move(owner))
+{
+#ifdef HAVE_VIENNACL
+    m_on_gpu.store(false, std::memory_order_release);
+#endif
+}
+
 template <class T>
 SGMatrix<T>::SGMatrix(index_t nrows, index_t ncols, bool ref_counting)
 	: SGReferencedData(ref_counting), num_rows(nrows), num_cols(ncols), gpu_ptr(nullptr)
@@ -73,6 +84,7 @@ SGMatrix<T>::SGMatrix(SGVector<T> vec) : SGReferencedData(vec)
 	num_rows=vec.vlen;
 	num_cols=1;
 	gpu_ptr = vec.gpu_ptr;
+	memory_owner = vec.memory_owner;
 #ifdef HAVE_VIENNACL
     m_on_gpu.store(vec.on_gpu(), std::memory_order_release);
 #endif
@@ -93,6 +105,7 @@ SGMatrix<T>::SGMatrix(SGVector<T> vec, index_t nrows, index_t ncols)
 	num_rows=nrows;
 	num_cols=ncols;
 	gpu_ptr = vec.gpu_ptr;
+	memory_owner = vec.memory_owner;
 #ifdef HAVE_VIENNACL
     m_on_gpu.store(vec.on_gpu(), std::memory_order_release);
 #endif
@@ -120,7 +133,8 @@ SGMatrix<T>::SGMatrix(SGMatrix&& orig) noexcept
 	  matrix{std::exchange(orig.matrix ,nullptr)},
 	  num_rows{std::exchange(orig.num_rows, 0)},
 	  num_cols{std::exchange(orig.num_cols, 0)},
-	  gpu_ptr(std::move(orig.gpu_ptr))
+	  gpu_ptr(std::move(orig.gpu_ptr)),
+	  memory_owner(std::move(orig.memory_owner))
 {
 #ifdef HAVE_VIENNACL
 	m_on_gpu.store(orig.m_on_gpu.load(
@@ -934,6 +948,7 @@ void SGMatrix<T>::copy_data(const SGReferencedData &orig)
 	matrix=((SGMatrix*)(&orig))->matrix;
 	num_rows=((SGMatrix*)(&orig))->num_rows;
 	num_cols=((SGMatrix*)(&orig))->num_cols;
+	memory_owner=((SGMatrix*)(&orig))->memory_owner;
 #ifdef HAVE_VIENNACL
     m_on_gpu.store(((SGMatrix*)(&orig))->m_on_gpu.load(
 		std::memory_order_acquire), std::memory_order_release);
@@ -947,6 +962,7 @@ void SGMatrix<T>::init_data()
 	num_rows=0;
 	num_cols=0;
 	gpu_ptr=nullptr;
+	memory_owner=nullptr;
 #ifdef HAVE_VIENNACL
 	m_on_gpu.store(false, std::memory_order_release);
 #endif
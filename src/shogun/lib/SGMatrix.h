@@ -70,6 +70,19 @@ template<class T> class SGMatrix : public SGReferencedData
 		/** Wraps a matrix around an existing memory segment with an offset */
 		SGMatrix(T* m, index_t nrows, index_t ncols, index_t offset);
 
+#ifndef SWIG
+		/** Wraps a matrix around memory that is owned by another object,
+		 * e.g. a memory mapped file. The owner is kept alive as long as
+		 * the matrix or any of its copies exists.
+		 *
+		 * @param m memory of the matrix
+		 * @param nrows number of rows
+		 * @param ncols number of columns
+		 * @param owner owner of the memory
+		 */
+		SGMatrix(T* m, index_t nrows, index_t ncols, std::shared_ptr<const void> owner);
+#endif
+
 		/** Constructor to create new matrix in memory */
 		SGMatrix(index_t nrows, index_t ncols, bool ref_counting=true);
 
@@ -557,6 +570,12 @@ template<class T> class SGMatrix : public SGReferencedData
 		index_t num_cols;
 		/** GPU Matrix structure. Stores pointer to the data on GPU. */
 		std::shared_ptr<GPUMemoryBase<T>> gpu_ptr;
+#ifndef SWIG
+		/** Owner of the memory of views of memory owned by other objects,
+		 * nullptr otherwise
+		 */
+		std::shared_ptr<const void> memory_owner;
+#endif
 };
 #ifndef SWIG 
     template<typename T>
@@ -37,6 +37,35 @@ SGSparseMatrix<T>::SGSparseMatrix(SGMatrix<T> dense) : SGReferencedData()
 	from_dense(dense);
 }
 
+template <class T>
+SGSparseMatrix<T>::SGSparseMatrix(
+	SGVector<index_t> indptr, SGVector<index_t> indices, SGVector<T> values,
+	index_t num_feat)
+	: SGReferencedData()
+{
+	require(indptr.vlen>0, "Offsets of compressed storage must not be empty");
+	require(indptr[0]==0 && indptr[indptr.vlen-1]==indices.vlen,
+		"Offsets of compressed storage must range from 0 to {}", indices.vlen);
+	require(indices.vlen==values.vlen,
+		"Number of indices ({}) and values ({}) must match",
+		indices.vlen, values.vlen);
+
+	num_features=num_feat;
+	num_vectors=indptr.vlen-1;
+	sparse_matrix=SG_MALLOC(SGSparseVector<T>, num_vectors);
+
+	for (index_t i=0; i<num_vectors; i++)
+	{
+		index_t begin=indptr[i];
+		sparse_matrix[i]=SGSparseVector<T>(indptr[i+1]-begin);
+		for (index_t j=0; j<sparse_matrix[i].num_feat_entries; j++)
+		{
+			sparse_matrix[i].features[j].feat_index=indices[begin+j];
+			sparse_matrix[i].features[j].entry=values[begin+j];
+		}
+	}
+}
+
 template <class T>
 SGSparseMatrix<T>::SGSparseMatrix(const SGSparseMatrix &orig) : SGReferencedData(orig)
 {
@@ -234,6 +263,28 @@ template<class T> void SGSparseMatrix<T>::sort_features()
 	}
 }
 
+template<class T> void SGSparseMatrix<T>::to_compressed(
+	SGVector<index_t>& indptr, SGVector<index_t>& indices,
+	SGVector<T>& values) const
+{
+	indptr=SGVector<index_t>(num_vectors+1);
+	indptr[0]=0;
+	for (index_t i=0; i<num_vectors; i++)
+		indptr[i+1]=indptr[i]+sparse_matrix[i].num_feat_entries;
+
+	indices=SGVector<index_t>(indptr[num_vectors]);
+	values=SGVector<T>(indptr[num_vectors]);
+	for (index_t i=0; i<num_vectors; i++)
+	{
+		const SGSparseVector<T>& sv=sparse_matrix[i];
+		for (index_t j=0; j<sv.num_feat_entries; j++)
+		{
+			indices[indptr[i]+j]=sv.features[j].feat_index;
+			values[indptr[i]+j]=sv.features[j].entry;
+		}
+	}
+}
+
 template<class T> void SGSparseMatrix<T>::from_dense(SGMatrix<T> full)
 {
 	T* src=full.matrix;
@@ -45,6 +45,19 @@ template <class T> class SGSparseMatrix : public SGReferencedData
 		 */
 		SGSparseMatrix(SGMatrix<T> dense);
 
+		/** constructor to create a sparse matrix from compressed storage,
+		 * i.e. vector i consists of the entries indptr[i] to indptr[i+1]-1
+		 * of indices and values
+		 *
+		 * @param indptr offsets of the vectors, of length num_vec+1
+		 * @param indices feature indices of all entries
+		 * @param values values of all entries
+		 * @param num_feat number of features
+		 */
+		SGSparseMatrix(
+			SGVector<index_t> indptr, SGVector<index_t> indices,
+			SGVector<T> values, index_t num_feat);
+
 		/** copy constructor */
 		SGSparseMatrix(const SGSparseMatrix &orig);
 
@@ -183,6 +196,18 @@ template <class T> class SGSparseMatrix : public SGReferencedData
 		/** sort the indices of the sparse matrix such that they are in ascending order */
 		void sort_features();
 
+		/** convert to compressed storage, i.e. three contiguous arrays in
+		 * which vector i consists of the entries indptr[i] to indptr[i+1]-1
+		 * of indices and values
+		 *
+		 * @param indptr offsets of the vectors, of length num_vectors+1
+		 * @param indices feature indices of all entries
+		 * @param values values of all entries
+		 */
+		void to_compressed(
+			SGVector<index_t>& indptr, SGVector<index_t>& indices,
+			SGVector<T>& values) const;
+
 		/** Pointer identify comparison.
 		 *  @return true iff number of vectors and features and pointer are
 		 * equal
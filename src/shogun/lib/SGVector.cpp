@@ -88,6 +88,16 @@ SGVector<T>::SGVector(T* m, index_t len, index_t offset)
 #endif
 }
 
+template<class T>
+SGVector<T>::SGVector(T* v, index_t len, std::shared_ptr<const void> owner)
+: SGReferencedData(false), vector(v), vlen(len), gpu_ptr(NULL),
+  memory_owner(std::move(owner))
+{
+#ifdef HAVE_VIENNACL
+	m_on_gpu.store(false, std::memory_order_release);
+#endif
+}
+
 template<class T>
 SGVector<T>::SGVector(index_t len, bool ref_counting)
 : SGReferencedData(ref_counting), vlen(len), gpu_ptr(NULL)
@@ -106,6 +116,7 @@ SGVector<T>::SGVector(SGMatrix<T> matrix)
 {
 	ASSERT(!matrix.on_gpu())
 	vector = matrix.data();
+	memory_owner = matrix.memory_owner;
 #ifdef HAVE_VIENNACL
 	m_on_gpu.store(false, std::memory_order_release);
 #endif
@@ -138,7 +149,8 @@ SGVector<T>::SGVector(SGVector&& orig) noexcept
 	: SGReferencedData(std::move(orig)),
 	  vector{std::exchange(orig.vector, nullptr)},
 	  vlen{std::exchange(orig.vlen, 0)},
-	  gpu_ptr(std::move(orig.gpu_ptr))
+	  gpu_ptr(std::move(orig.gpu_ptr)),
+	  memory_owner(std::move(orig.memory_owner))
 {
 #ifdef HAVE_VIENNACL
 	m_on_gpu.store(
@@ -328,7 +340,15 @@ template<class T>
 void SGVector<T>::resize_vector(int32_t n)
 {
 	assert_on_cpu();
-	vector=SG_REALLOC(T, vector, vlen, n);
+	if (memory_owner)
+	{
+		// the memory cannot be reallocated, e.g. it is memory mapped
+		T* resized = SG_MALLOC(T, n);
+		sg_memcpy(resized, vector, sizeof(T)*std::min(vlen, n));
+		*this = SGVector<T>(resized, vlen);
+	}
+	else
+		vector=SG_REALLOC(T, vector, vlen, n);
 
 	if (n > vlen)
 		memset(&vector[vlen], 0, (n-vlen)*sizeof(T));
@@ -381,6 +401,7 @@ void SGVector<T>::copy_data(const SGReferencedData &orig)
 	gpu_ptr=std::shared_ptr<GPUMemoryBase<T>>(((SGVector*)(&orig))->gpu_ptr);
 	vector=((SGVector*)(&orig))->vector;
 	vlen=((SGVector*)(&orig))->vlen;
+	memory_owner=((SGVector*)(&orig))->memory_owner;
 #ifdef HAVE_VIENNACL
     m_on_gpu.store(((SGVector*)(&orig))->m_on_gpu.load(
 		std::memory_order_acquire), std::memory_order_release);
@@ -393,6 +414,7 @@ void SGVector<T>::init_data()
 	vector=NULL;
 	vlen=0;
 	gpu_ptr=NULL;
+	memory_owner=nullptr;
 #ifdef HAVE_VIENNACL
     m_on_gpu.store(false, std::memory_order_release);
 #endif
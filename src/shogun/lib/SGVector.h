@@ -65,6 +65,18 @@ template<class T> class SGVector : public SGReferencedData
 		/** Wraps a vector around an existing memory segment with an offset */
 		SGVector(T* m, index_t len, index_t offset);
 
+#ifndef SWIG
+		/** Wraps a vector around memory that is owned by another object,
+		 * e.g. a memory mapped file. The owner is kept alive as long as
+		 * the vector or any of its copies exists.
+		 *
+		 * @param v memory of the vector
+		 * @param len length of the vector
+		 * @param owner owner of the memory
+		 */
+		SGVector(T* v, index_t len, std::shared_ptr<const void> owner);
+#endif
+
 		/** Constructor to create new vector in memory */
 		SGVector(index_t len, bool ref_counting=true);
 
@@ -275,7 +287,9 @@ template<class T> class SGVector : public SGReferencedData
 		}
 
 #ifndef SWIG // SWIG should skip this part
-		/** Resize vector, with zero padding
+		/** Resize vector, with zero padding. Views of memory owned by
+		 * another object are copied into memory owned by this vector,
+		 * other copies of the view are not changed.
 		 *
 		 * @param n new size
 		 */
@@ -612,6 +626,12 @@ template<class T> class SGVector : public SGReferencedData
 		index_t vlen;
 		/** GPU Vector structure. Stores pointer to the data on GPU. */
 		std::shared_ptr<GPUMemoryBase<T>> gpu_ptr;
+#ifndef SWIG
+		/** Owner of the memory of views of memory owned by other objects,
+		 * nullptr otherwise
+		 */
+		std::shared_ptr<const void> memory_owner;
+#endif
 };
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
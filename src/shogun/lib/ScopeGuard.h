@@ -0,0 +1,66 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+#ifndef __SCOPEGUARD_H__
+#define __SCOPEGUARD_H__
+
+#include <shogun/lib/config.h>
+
+#include <utility>
+
+namespace shogun
+{
+/** @brief Calls a function when leaving the scope, also when leaving it by
+ * an exception, unless the guard has been dismissed. Used to restore state
+ * that is modified temporarily.
+ *
+ * @code
+ * auto guard = make_scope_guard([&]() { kernel->init(lhs, rhs); });
+ * @endcode
+ */
+template <class F>
+class ScopeGuard
+{
+public:
+	/** constructor
+	 * @param function function to call when leaving the scope, must not throw
+	 */
+	explicit ScopeGuard(F function)
+	    : m_function(std::move(function)), m_active(true)
+	{
+	}
+
+	ScopeGuard(ScopeGuard&& other)
+	    : m_function(std::move(other.m_function)), m_active(other.m_active)
+	{
+		other.m_active = false;
+	}
+
+	ScopeGuard(const ScopeGuard&) = delete;
+	ScopeGuard& operator=(const ScopeGuard&) = delete;
+
+	~ScopeGuard()
+	{
+		if (m_active)
+			m_function();
+	}
+
+	/** do not call the function when leaving the scope */
+	void dismiss()
+	{
+		m_active = false;
+	}
+
+private:
+	F m_function;
+	bool m_active;
+};
+
+/** @return guard that calls the function when leaving the scope */
+template <class F>
+ScopeGuard<F> make_scope_guard(F function)
+{
+	return ScopeGuard<F>(std::move(function));
+}
+}
+#endif // __SCOPEGUARD_H__
@@ -0,0 +1,75 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/lib/ScratchArena.h>
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace shogun;
+
+namespace
+{
+	constexpr size_t kAlignment = 64;
+	constexpr size_t kMinBlockSize = size_t(1) << 16;
+
+	size_t align_up(size_t value)
+	{
+		return (value + kAlignment - 1) & ~(kAlignment - 1);
+	}
+} // namespace
+
+ScratchArena& ScratchArena::thread_local_arena()
+{
+	thread_local ScratchArena arena;
+	return arena;
+}
+
+size_t ScratchArena::capacity() const
+{
+	size_t result = 0;
+	for (const auto& block : m_blocks)
+		result += block.size;
+	return result;
+}
+
+void* ScratchArena::allocate_bytes(size_t bytes)
+{
+	bytes = std::max(bytes, size_t(1));
+
+	// offsets are relative to the aligned start of a block
+	if (m_block < m_blocks.size() &&
+	    align_up(m_offset) + bytes <= m_blocks[m_block].size)
+	{
+		m_offset = align_up(m_offset);
+	}
+	else
+	{
+		// move on to the next block, the first one stays the current one
+		// as long as it is empty
+		if (m_block < m_blocks.size() && m_offset > 0)
+			++m_block;
+
+		// blocks after the current one are unused, so one that is too
+		// small is replaced together with all blocks after it
+		if (m_block < m_blocks.size() && m_blocks[m_block].size < bytes)
+			m_blocks.resize(m_block);
+
+		if (m_block == m_blocks.size())
+		{
+			auto size = std::max(
+			    {kMinBlockSize, align_up(bytes),
+			     m_blocks.empty() ? 0 : 2 * m_blocks.back().size});
+			m_blocks.push_back(
+			    {std::unique_ptr<char[]>(new char[size + kAlignment]), size});
+		}
+		m_offset = 0;
+	}
+
+	auto base = reinterpret_cast<uintptr_t>(m_blocks[m_block].data.get());
+	auto aligned = (base + kAlignment - 1) & ~uintptr_t(kAlignment - 1);
+	auto result = reinterpret_cast<char*>(aligned) + m_offset;
+	m_offset += bytes;
+	return result;
+}
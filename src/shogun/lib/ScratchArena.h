@@ -0,0 +1,142 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+#ifndef __SCRATCHARENA_H__
+#define __SCRATCHARENA_H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/lib/common.h>
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace shogun
+{
+/** @brief Stack allocator for temporary buffers of a thread.
+ *
+ * Memory is handed out from a list of large blocks by bumping an offset
+ * and released in LIFO order by resetting the offset to a marker, so
+ * that after warm-up no temporary costs a heap allocation. Blocks are
+ * kept between uses and only grow.
+ *
+ * Buffers are obtained through a ScratchArena::Scope, which releases
+ * everything allocated through it when it goes out of scope. They are
+ * returned as non-owning SGVector/SGMatrix views (no reference counting),
+ * so they must neither outlive the scope nor be resized; clone() them
+ * if they have to be kept.
+ *
+ * \code
+ * ScratchArena::Scope scratch;
+ * auto feats = scratch.vector<float64_t>(num_vecs);
+ * \endcode
+ */
+class ScratchArena
+{
+public:
+	/** position in the arena to release to */
+	struct Marker
+	{
+		size_t block;
+		size_t offset;
+	};
+
+	/** @brief Allocation scope, releases its buffers on destruction.
+	 * Scopes of one arena have to be nested.
+	 */
+	class Scope
+	{
+	public:
+		/** constructor
+		 * @param arena arena to allocate from, the calling thread's
+		 * arena by default
+		 */
+		explicit Scope(ScratchArena& arena = ScratchArena::thread_local_arena())
+		    : m_arena(arena), m_marker(arena.mark())
+		{
+		}
+
+		~Scope()
+		{
+			m_arena.release(m_marker);
+		}
+
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+
+		/** @return uninitialised non-owning vector of given length */
+		template <typename T>
+		SGVector<T> vector(index_t len)
+		{
+			return SGVector<T>(m_arena.allocate<T>(len), len, false);
+		}
+
+		/** @return uninitialised non-owning matrix of given size */
+		template <typename T>
+		SGMatrix<T> matrix(index_t num_rows, index_t num_cols)
+		{
+			return SGMatrix<T>(
+			    m_arena.allocate<T>(int64_t(num_rows) * num_cols), num_rows,
+			    num_cols, false);
+		}
+
+	private:
+		ScratchArena& m_arena;
+		Marker m_marker;
+	};
+
+	ScratchArena() = default;
+	ScratchArena(const ScratchArena&) = delete;
+	ScratchArena& operator=(const ScratchArena&) = delete;
+
+	/** @return arena of the calling thread */
+	static ScratchArena& thread_local_arena();
+
+	/** @return uninitialised memory for len elements of type T */
+	template <typename T>
+	T* allocate(int64_t len)
+	{
+		static_assert(
+		    std::is_trivially_destructible<T>::value,
+		    "scratch buffers are never destructed");
+		return static_cast<T*>(allocate_bytes(len * sizeof(T)));
+	}
+
+	/** @return current position, to be passed to release */
+	Marker mark() const
+	{
+		return {m_block, m_offset};
+	}
+
+	/** frees everything allocated since marker was taken */
+	void release(const Marker& marker)
+	{
+		m_block = marker.block;
+		m_offset = marker.offset;
+	}
+
+	/** @return total number of bytes held by the arena */
+	size_t capacity() const;
+
+private:
+	/** @return cache line aligned memory of given size */
+	void* allocate_bytes(size_t bytes);
+
+	struct Block
+	{
+		std::unique_ptr<char[]> data;
+		size_t size;
+	};
+
+	/** allocated blocks, those after m_block are unused */
+	std::vector<Block> m_blocks;
+	/** index of block allocations are made from */
+	size_t m_block = 0;
+	/** first free byte in the current block */
+	size_t m_offset = 0;
+};
+} // namespace shogun
+#endif // __SCRATCHARENA_H__
@@ -13,6 +13,7 @@
 #include <functional>
 #include <limits>
 #include <map>
+#include <memory>
 #include <stdexcept>
 #include <string.h>
 #include <string>
@@ -200,6 +201,75 @@ namespace shogun
 		virtual void exit_std_vector(size_t* size) = 0;
 		virtual void exit_map(size_t* size) = 0;
 
+		/** Visits a contiguous array of numbers at once, called between
+		 * entering and exiting a vector or matrix. Visitors that return
+		 * false are called for every element instead.
+		 *
+		 * @param data first element
+		 * @param length number of elements
+		 * @return whether the array was visited
+		 */
+		virtual bool on_array(char* data, int64_t length)
+		{
+			return false;
+		}
+		virtual bool on_array(int8_t* data, int64_t length)
+		{
+			return false;
+		}
+		virtual bool on_array(uint8_t* data, int64_t length)
+		{
+			return false;
+		}
+		virtual bool on_array(int16_t* data, int64_t length)
+		{
+			return false;
+		}
+		virtual bool on_array(uint16_t* data, int64_t length)
+		{
+			return false;
+		}
+		virtual bool on_array(int32_t* data, int64_t length)
+		{
+			return false;
+		}
+		virtual bool on_array(uint32_t* data, int64_t length)
+		{
+			return false;
+		}
+		virtual bool on_array(int64_t* data, int64_t length)
+		{
+			return false;
+		}
+		virtual bool on_array(uint64_t* data, int64_t length)
+		{
+			return false;
+		}
+		virtual bool on_array(float32_t* data, int64_t length)
+		{
+			return false;
+		}
+		virtual bool on_array(float64_t* data, int64_t length)
+		{
+			return false;
+		}
+
+		/** Called after entering a non empty SGVector or SGMatrix of
+		 * numbers, before on_array. Visitors that can provide the elements
+		 * in place, e.g. from a memory mapped file, return a pointer to
+		 * them that shares ownership of that memory. The container then
+		 * becomes a view of the memory, which keeps it alive, and on_array
+		 * is not called.
+		 *
+		 * @param element_size size of an element in bytes
+		 * @param length number of elements
+		 * @return elements or nullptr
+		 */
+		virtual std::shared_ptr<void> on_view(size_t element_size, int64_t length)
+		{
+			return nullptr;
+		}
+
 		template <typename T>
 		void on(std::atomic<T>* val)
 		{
@@ -242,10 +312,19 @@ namespace shogun
 		{
 			auto size = _v->vlen;
 			enter_vector(std::addressof(size));
+			if (auto view = try_view_array<T>(size))
+			{
+				*_v = SGVector<T>(view.get(), size, view);
+				exit_vector(std::addressof(size));
+				return;
+			}
 			if (size != _v->vlen)
 				_v->resize_vector(size);
-			for (auto&& _value : *_v)
-				on(std::addressof(_value));
+			if (!try_on_array(_v->vector, size))
+			{
+				for (auto&& _value : *_v)
+					on(std::addressof(_value));
+			}
 			exit_vector(std::addressof(size));
 		}
 
@@ -289,8 +368,11 @@ namespace shogun
 					*_v->ptr() = SG_CALLOC(T, size);
 			}
 			auto ptr = *(_v->ptr());
-			for (S i = 0; i < size; ++i)
-				on(std::addressof(ptr[i]));
+			if (!try_on_array(ptr, size))
+			{
+				for (S i = 0; i < size; ++i)
+					on(std::addressof(ptr[i]));
+			}
 			exit_vector(std::addressof(size));
 		}
 
@@ -310,8 +392,11 @@ namespace shogun
 					*_v->ptr() = SG_MALLOC(T, length);
 			}
 			auto ptr = *(_v->ptr());
-			for (int64_t i = 0; i < length; ++i)
-				on(std::addressof(ptr[i]));
+			if (!try_on_array(ptr, length))
+			{
+				for (int64_t i = 0; i < length; ++i)
+					on(std::addressof(ptr[i]));
+			}
 			exit_matrix(shape.first, shape.second);
 		}
 
@@ -321,12 +406,22 @@ namespace shogun
 			auto rows = _matrix->num_rows;
 			auto cols = _matrix->num_cols;
 			enter_matrix(std::addressof(rows), std::addressof(cols));
+			if (auto view = try_view_array<T>(int64_t(rows) * cols))
+			{
+				*_matrix = SGMatrix<T>(view.get(), rows, cols, view);
+				exit_matrix(std::addressof(rows), std::addressof(cols));
+				return;
+			}
 			if ((rows != _matrix->num_rows) || (cols != _matrix->num_cols))
 				*_matrix = SGMatrix<T>(rows, cols);
-			for (auto index = 0; index < cols; index++)
+			if (!try_on_array(_matrix->matrix, int64_t(rows) * cols))
 			{
-				on_matrix_row(
-				    std::addressof(rows), std::addressof(index), _matrix);
+				for (auto index = 0; index < cols; index++)
+				{
+					on_matrix_row(
+					    std::addressof(rows), std::addressof(index),
+					    _matrix);
+				}
 			}
 			exit_matrix(std::addressof(rows), std::addressof(cols));
 		}
@@ -338,8 +433,14 @@ namespace shogun
 			enter_std_vector(std::addressof(size));
 			if (size != _v->size())
 				_v->resize(size);
-			for (auto&& _value : *_v)
-				on(std::addressof(_value));
+			bool visited = false;
+			if constexpr (!std::is_same_v<T, bool>)
+				visited = try_on_array(_v->data(), size);
+			if (!visited)
+			{
+				for (auto&& _value : *_v)
+					on(std::addressof(_value));
+			}
 			exit_std_vector(std::addressof(size));
 		}
 
@@ -396,6 +497,36 @@ namespace shogun
 		void on(...)
 		{
 		}
+
+	private:
+		/** whether arrays of T are visited with on_array and on_view */
+		template <typename T>
+		static constexpr bool is_array_visitable = std::disjunction_v<
+		    std::is_same<T, char>, std::is_same<T, int8_t>,
+		    std::is_same<T, uint8_t>, std::is_same<T, int16_t>,
+		    std::is_same<T, uint16_t>, std::is_same<T, int32_t>,
+		    std::is_same<T, uint32_t>, std::is_same<T, int64_t>,
+		    std::is_same<T, uint64_t>, std::is_same<T, float32_t>,
+		    std::is_same<T, float64_t>>;
+
+		template <typename T>
+		bool try_on_array(T* data, int64_t length)
+		{
+			if constexpr (is_array_visitable<T>)
+				return length > 0 && on_array(data, length);
+			return false;
+		}
+
+		template <typename T>
+		std::shared_ptr<T> try_view_array(int64_t length)
+		{
+			if constexpr (is_array_visitable<T>)
+			{
+				if (length > 0)
+					return std::static_pointer_cast<T>(on_view(sizeof(T), length));
+			}
+			return nullptr;
+		}
 	};
 
 	namespace any_detail
@@ -89,6 +89,41 @@ namespace tapkee
 		const stichwort::ParameterKeyword<NeighborsMethod>
 			neighbors_method("nearest neighbors method", default_neighbors_method);
 
+		/** The keyword for the value that stores the maximal number
+		 * of iterations of the @ref tapkee::NNDescent neighbors method.
+		 *
+		 * Default value is 10.
+		 *
+		 * The corresponding value should have type @ref tapkee::IndexType.
+		 */
+		const stichwort::ParameterKeyword<IndexType>
+			nndescent_max_iteration("NN-descent maximal iteration", 10);
+
+		/** The keyword for the value that stores the fraction of the
+		 * neighbors of an object used as new candidates in an iteration
+		 * of the @ref tapkee::NNDescent neighbors method. Lower values
+		 * are faster, higher ones give a better recall.
+		 *
+		 * Default value is 0.5.
+		 *
+		 * The corresponding value should have type @ref tapkee::ScalarType
+		 * and be in the (0,1] range.
+		 */
+		const stichwort::ParameterKeyword<ScalarType>
+			nndescent_sample_rate("NN-descent sample rate", 0.5);
+
+		/** The keyword for the value that stores the early termination
+		 * threshold of the @ref tapkee::NNDescent neighbors method, which
+		 * stops once fewer than the given fraction of all neighbors
+		 * changed in an iteration.
+		 *
+		 * Default value is 0.001.
+		 *
+		 * The corresponding value should have type @ref tapkee::ScalarType.
+		 */
+		const stichwort::ParameterKeyword<ScalarType>
+			nndescent_tolerance("NN-descent tolerance", 0.001);
+
 		/** The keyword for the value that stores the number of neighbors.
 		 *
 		 * Used by all local methods such as:
@@ -353,6 +388,20 @@ namespace tapkee
 		 */
 		const stichwort::ParameterKeyword<ScalarType> sne_theta("SNE theta", 0.5);
 
+		/** The keyword for the value that stores whether t-SNE should
+		 * compute repulsive forces by FFT accelerated interpolation
+		 * instead of the Barnes-Hut approximation. Supports 2 and 3
+		 * target dimensions.
+		 *
+		 * Used by @ref tapkee::tDistributedStochasticNeighborEmbedding.
+		 *
+		 * Default value is false.
+		 *
+		 * The corresponding value should have type bool.
+		 */
+		const stichwort::ParameterKeyword<bool>
+			sne_interpolation("SNE interpolation", false);
+
 		/** The keyword for the value that stores the squishingRate
 		 * parameter of the Manifold Sculpting algorithm.
 		 *
@@ -137,6 +137,9 @@ namespace tapkee
 	static const NeighborsMethod Brute("Brute-force");
 	//! Vantage point tree -based method.
 	static const NeighborsMethod VpTree("Vantage point tree");
+	//! Approximate NN-descent method with parallel construction,
+	//! recommended for large numbers of objects.
+	static const NeighborsMethod NNDescent("NN-descent");
 #ifdef TAPKEE_USE_LGPL_COVERTREE
 	//! Covertree-based method with approximate \f$ O(\log N) \f$ time complexity.
 	//! Recommended to be used as a default method.
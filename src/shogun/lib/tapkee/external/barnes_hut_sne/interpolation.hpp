@@ -0,0 +1,308 @@
+/* This software is distributed under BSD 3-clause license (see LICENSE file).
+ *
+ * Repulsive t-SNE forces by polynomial interpolation on a regular grid,
+ * following Linderman, G. C., et al. (2019). Fast interpolation-based t-SNE
+ * for improved visualization of single-cell RNA-seq data. Nature Methods.
+ */
+
+#ifndef INTERPOLATION_H
+#define INTERPOLATION_H
+
+/* Tapkee includes */
+#include <shogun/lib/tapkee/defines.hpp>
+/* End of Tapkee includes */
+
+#include <algorithm>
+#include <float.h>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+namespace tsne
+{
+
+using tapkee::ScalarType;
+
+//! Computes the non-edge (repulsive) forces of t-SNE for all points at once.
+//!
+//! The embedding is covered with a regular grid of boxes holding a few
+//! equispaced interpolation nodes each. The charges \f$ 1, y, |y|^2 \f$ of the
+//! points are spread to the nodes with Lagrange polynomials, convolved with the
+//! squared Cauchy kernel \f$ (1 + |y_i - y_j|^2)^{-2} \f$ via FFT and
+//! interpolated back. Costs O(N) plus the FFT of the grid, for 2-D and 3-D
+//! embeddings.
+class Interpolation
+{
+	// Interpolation nodes per box and dimension
+	static const int NODES_PER_BOX = 3;
+
+	typedef std::complex<ScalarType> Complex;
+
+public:
+
+	Interpolation(int no_dims) :
+		no_dims(no_dims), n_boxes(0), n_grid(0), n_fft(0), y_min(.0), box_width(.0)
+	{
+	}
+
+	// Computes unnormalized repulsive forces into neg_f and returns the normalization sum_Q
+	ScalarType computeNonEdgeForces(const ScalarType* Y, int N, ScalarType* neg_f)
+	{
+		setupGrid(Y, N);
+
+		const int n_terms = no_dims + 2;
+		const int n_lattice = ipow(NODES_PER_BOX, no_dims);
+		const int grid_size = ipow(n_grid, no_dims);
+
+		// Interpolation weights of all points along all dimensions
+		std::vector<int> first(N * no_dims);
+		std::vector<ScalarType> weights(N * no_dims * NODES_PER_BOX);
+#pragma omp parallel for
+		for(int i = 0; i < N; i++) {
+			for(int d = 0; d < no_dims; d++)
+				lagrangeWeights(Y[i * no_dims + d], first[i * no_dims + d], &weights[(i * no_dims + d) * NODES_PER_BOX]);
+		}
+
+		// Spread the charges to the grid, one term per thread
+		std::vector<ScalarType> potentials(n_terms * grid_size, .0);
+#pragma omp parallel for
+		for(int t = 0; t < n_terms; t++) {
+			ScalarType* grid = &potentials[t * grid_size];
+			for(int i = 0; i < N; i++) {
+				ScalarType q = charge(Y + i * no_dims, t);
+				for(int l = 0; l < n_lattice; l++) {
+					int node; ScalarType w;
+					latticeNode(first, weights, i, l, node, w);
+					grid[node] += w * q;
+				}
+			}
+		}
+
+		// Convolve charges with the kernel, two real terms per complex transform
+		computeKernel();
+		for(int t = 0; t < n_terms; t += 2)
+			convolve(&potentials[t * grid_size], t + 1 < n_terms ? &potentials[(t + 1) * grid_size] : NULL);
+
+		// Interpolate potentials back to the points
+		ScalarType sum_Q = .0;
+#pragma omp parallel for reduction(+:sum_Q)
+		for(int i = 0; i < N; i++) {
+			ScalarType phi[5] = {.0, .0, .0, .0, .0};
+			for(int l = 0; l < n_lattice; l++) {
+				int node; ScalarType w;
+				latticeNode(first, weights, i, l, node, w);
+				for(int t = 0; t < n_terms; t++) phi[t] += w * potentials[t * grid_size + node];
+			}
+
+			const ScalarType* y = Y + i * no_dims;
+			ScalarType y_sq = .0, y_phi = .0;
+			for(int d = 0; d < no_dims; d++) {
+				y_sq += y[d] * y[d];
+				y_phi += y[d] * phi[d + 1];
+				neg_f[i * no_dims + d] = y[d] * phi[0] - phi[d + 1];
+			}
+			sum_Q += (1.0 + y_sq) * phi[0] - 2.0 * y_phi + phi[no_dims + 1];
+		}
+
+		// Remove self interactions
+		return sum_Q - N;
+	}
+
+private:
+
+	static int ipow(int base, int exp)
+	{
+		int result = 1;
+		for(int i = 0; i < exp; i++) result *= base;
+		return result;
+	}
+
+	// Chooses boxes of roughly unit width covering all points. The number of
+	// boxes fills a power of two FFT, which is at least 64 and at most 1024
+	// (2-D) or 128 (3-D) large along each dimension.
+	void setupGrid(const ScalarType* Y, int N)
+	{
+		const int min_fft = 64;
+		const int max_fft = (no_dims == 2) ? 1024 : 128;
+
+		ScalarType y_max = -DBL_MAX;
+		y_min = DBL_MAX;
+		for(int i = 0; i < N * no_dims; i++) {
+			y_min = std::min(y_min, Y[i]);
+			y_max = std::max(y_max, Y[i]);
+		}
+		ScalarType range = std::max(y_max - y_min, 1e-10);
+
+		// Circulant embedding of the kernel needs 2 * n_grid entries, take
+		// the power of two closest to that for unit boxes
+		int size = min_fft;
+		while(size < max_fft && 2 * NODES_PER_BOX * range > 1.5 * size) size <<= 1;
+		n_boxes = size / (2 * NODES_PER_BOX);
+		box_width = range / n_boxes;
+		n_grid = n_boxes * NODES_PER_BOX;
+
+		if(size != n_fft) {
+			n_fft = size;
+			twiddles.resize(n_fft / 2);
+			for(int k = 0; k < n_fft / 2; k++)
+				twiddles[k] = std::polar(1.0, -2.0 * M_PI * k / n_fft);
+		}
+	}
+
+	// Lagrange polynomials of the nodes of the box containing y
+	void lagrangeWeights(ScalarType y, int& first_node, ScalarType* w) const
+	{
+		ScalarType t = (y - y_min) / box_width;
+		int box = std::min(std::max((int) t, 0), n_boxes - 1);
+		ScalarType u = t - box;
+		for(int k = 0; k < NODES_PER_BOX; k++) {
+			ScalarType x_k = (k + .5) / NODES_PER_BOX;
+			w[k] = 1.0;
+			for(int m = 0; m < NODES_PER_BOX; m++) {
+				if(m == k) continue;
+				ScalarType x_m = (m + .5) / NODES_PER_BOX;
+				w[k] *= (u - x_m) / (x_k - x_m);
+			}
+		}
+		first_node = box * NODES_PER_BOX;
+	}
+
+	// Grid node and weight of the l-th interpolation node of point i
+	void latticeNode(const std::vector<int>& first, const std::vector<ScalarType>& weights, int i, int l, int& node, ScalarType& w) const
+	{
+		node = 0; w = 1.0;
+		for(int d = 0, stride = 1; d < no_dims; d++, stride *= n_grid) {
+			int k = l % NODES_PER_BOX;
+			l /= NODES_PER_BOX;
+			node += (first[i * no_dims + d] + k) * stride;
+			w *= weights[(i * no_dims + d) * NODES_PER_BOX + k];
+		}
+	}
+
+	ScalarType charge(const ScalarType* y, int term) const
+	{
+		if(term == 0) return 1.0;
+		if(term <= no_dims) return y[term - 1];
+		ScalarType y_sq = .0;
+		for(int d = 0; d < no_dims; d++) y_sq += y[d] * y[d];
+		return y_sq;
+	}
+
+	// Index of a grid node in the zero padded FFT array
+	int paddedIndex(int node) const
+	{
+		int index = 0;
+		for(int d = 0, stride = 1; d < no_dims; d++, stride *= n_fft) {
+			index += (node % n_grid) * stride;
+			node /= n_grid;
+		}
+		return index;
+	}
+
+	// Fourier transform of the kernel sampled at all node offsets
+	void computeKernel()
+	{
+		const int fft_size = ipow(n_fft, no_dims);
+		const ScalarType h = box_width / NODES_PER_BOX;
+		kernel.assign(fft_size, Complex(.0));
+#pragma omp parallel for
+		for(int index = 0; index < fft_size; index++) {
+			ScalarType D = .0;
+			bool inside = true;
+			for(int d = 0, rest = index; d < no_dims; d++, rest /= n_fft) {
+				int offset = rest % n_fft;
+				if(offset >= n_grid) offset -= n_fft;
+				if(offset <= -n_grid) inside = false;
+				D += h * h * offset * offset;
+			}
+			if(inside) kernel[index] = 1.0 / ((1.0 + D) * (1.0 + D));
+		}
+		transform(kernel, false, n_fft);
+	}
+
+	// Replaces real grids a and b (if given) by their convolutions with the kernel
+	void convolve(ScalarType* a, ScalarType* b)
+	{
+		const int fft_size = ipow(n_fft, no_dims);
+		const int grid_size = ipow(n_grid, no_dims);
+		work.assign(fft_size, Complex(.0));
+		for(int node = 0; node < grid_size; node++)
+			work[paddedIndex(node)] = Complex(a[node], b ? b[node] : .0);
+
+		// The kernel is real and even, so is its transform and the real and
+		// imaginary parts do not mix
+		transform(work, false, n_grid);
+		for(int index = 0; index < fft_size; index++) work[index] *= kernel[index].real();
+		transform(work, true, n_grid);
+
+		for(int node = 0; node < grid_size; node++) {
+			Complex value = work[paddedIndex(node)] / (ScalarType) fft_size;
+			a[node] = value.real();
+			if(b) b[node] = value.imag();
+		}
+	}
+
+	// Multidimensional FFT as 1-D transforms along every axis. Only the first
+	// extent entries along every axis are nonzero in the input of a forward
+	// and needed from the output of an inverse transform, other lines are
+	// skipped.
+	void transform(std::vector<Complex>& data, bool inverse, int extent) const
+	{
+		for(int i = 0; i < no_dims; i++) {
+			const int d = inverse ? no_dims - 1 - i : i;
+			const int stride = ipow(n_fft, d);
+			const int n_lines = stride * ipow(extent, no_dims - 1 - d);
+#pragma omp parallel
+			{
+				std::vector<Complex> line(n_fft);
+#pragma omp for
+				for(int l = 0; l < n_lines; l++) {
+					int start = l % stride;
+					for(int rest = l / stride, s = stride * n_fft; rest > 0; rest /= extent, s *= n_fft)
+						start += (rest % extent) * s;
+					for(int k = 0; k < n_fft; k++) line[k] = data[start + k * stride];
+					fft(line.data(), inverse);
+					for(int k = 0; k < n_fft; k++) data[start + k * stride] = line[k];
+				}
+			}
+		}
+	}
+
+	// In-place iterative radix-2 FFT of n_fft values
+	void fft(Complex* x, bool inverse) const
+	{
+		const int n = n_fft;
+		for(int i = 1, j = 0; i < n; i++) {
+			int bit = n >> 1;
+			for(; j & bit; bit >>= 1) j ^= bit;
+			j ^= bit;
+			if(i < j) std::swap(x[i], x[j]);
+		}
+		for(int len = 2; len <= n; len <<= 1) {
+			int step = n / len;
+			for(int i = 0; i < n; i += len) {
+				for(int k = 0; k < len / 2; k++) {
+					Complex w = inverse ? std::conj(twiddles[k * step]) : twiddles[k * step];
+					Complex u = x[i + k];
+					Complex v = x[i + k + len / 2] * w;
+					x[i + k] = u + v;
+					x[i + k + len / 2] = u - v;
+				}
+			}
+		}
+	}
+
+	int no_dims;
+	int n_boxes;
+	int n_grid;
+	int n_fft;
+	ScalarType y_min;
+	ScalarType box_width;
+	std::vector<Complex> twiddles;
+	std::vector<Complex> kernel;
+	std::vector<Complex> work;
+};
+
+}
+
+#endif
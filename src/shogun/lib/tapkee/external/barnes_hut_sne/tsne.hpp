@@ -35,6 +35,7 @@
 /* Tapkee includes */
 #include <shogun/lib/tapkee/utils/logging.hpp>
 #include <shogun/lib/tapkee/utils/time.hpp>
+#include <shogun/lib/tapkee/external/barnes_hut_sne/interpolation.hpp>
 #include <shogun/lib/tapkee/external/barnes_hut_sne/quadtree.hpp>
 #include <shogun/lib/tapkee/external/barnes_hut_sne/vptree.hpp>
 /* End of Tapkee includes */
@@ -58,12 +59,14 @@ static inline ScalarType sign(ScalarType x) { return (x == .0 ? .0 : (x < .0 ? -
 class TSNE
 {
 public:
-	void run(tapkee::DenseMatrix& X, int N, int D, ScalarType* Y, int no_dims, ScalarType perplexity, ScalarType theta)
+	void run(tapkee::DenseMatrix& X, int N, int D, ScalarType* Y, int no_dims, ScalarType perplexity, ScalarType theta, bool interpolate = false)
 	{
 		// Determine whether we are using an exact algorithm
-		bool exact = (theta == .0) ? true : false;
+		bool exact = (theta == .0 && !interpolate) ? true : false;
 		if (exact)
 			tapkee::LoggingSingleton::instance().message_info("Using exact t-SNE algorithm");
+		else if (interpolate)
+			tapkee::LoggingSingleton::instance().message_info("Using FFT-interpolated t-SNE algorithm");
 		else
 			tapkee::LoggingSingleton::instance().message_info("Using Barnes-Hut-SNE algorithm");
 
@@ -76,6 +79,7 @@ public:
 		tapkee::DenseMatrix uY(N, no_dims);
 		tapkee::DenseMatrix gains(N, no_dims);
 		tapkee::DenseMatrix P;
+		Interpolation interpolation(no_dims);
 		uY.setZero();
 		gains.setConstant(1.0);
 
@@ -134,6 +138,7 @@ public:
 
 				// Compute (approximate) gradient
 				if(exact) computeExactGradient(P.data(), Y, N, no_dims, dY.data());
+				else if(interpolate) computeInterpolatedGradient(interpolation, row_P, col_P, val_P, Y, N, no_dims, dY.data());
 				else computeGradient(P.data(), row_P, col_P, val_P, Y, N, no_dims, dY.data(), theta);
 
 				// Update gains
@@ -161,8 +166,8 @@ public:
 				// Print out progress
 				if((iter > 0) && ((iter % 50 == 0) || (iter == max_iter - 1))) {
 					ScalarType C = .0;
-					if(exact) C = evaluateError(P.data(), Y, N);
-					else      C = evaluateError(row_P, col_P, val_P, Y, N, theta);  // doing approximate computation here!
+					if(exact) C = evaluateError(P.data(), Y, N, no_dims);
+					else      C = evaluateError(row_P, col_P, val_P, Y, N, no_dims, theta, interpolate ? &interpolation : NULL);  // doing approximate computation here!
 					tapkee::LoggingSingleton::instance().message_info(
 							formatting::format("Iteration {}: error is {}\n", iter, C));
 				}
@@ -275,8 +280,13 @@ private:
 		ScalarType* pos_f = (ScalarType*) calloc(N * D, sizeof(ScalarType));
 		ScalarType* neg_f = (ScalarType*) calloc(N * D, sizeof(ScalarType));
 		if(pos_f == NULL || neg_f == NULL) { printf("Memory allocation failed!\n"); exit(1); }
-		tree->computeEdgeForces(inp_row_P, inp_col_P, inp_val_P, N, pos_f);
-		for(int n = 0; n < N; n++) tree->computeNonEdgeForces(n, theta, neg_f + n * D, &sum_Q);
+		computeEdgeForces(inp_row_P, inp_col_P, inp_val_P, Y, N, D, pos_f);
+#pragma omp parallel for reduction(+:sum_Q)
+		for(int n = 0; n < N; n++) {
+			ScalarType point_Q = .0;
+			tree->computeNonEdgeForces(n, theta, neg_f + n * D, &point_Q);
+			sum_Q += point_Q;
+		}
 
 		// Compute final t-SNE gradient
 		for(int i = 0; i < N * D; i++) {
@@ -287,6 +297,41 @@ private:
 		delete tree;
 	}
 
+	void computeInterpolatedGradient(Interpolation& interpolation, int* inp_row_P, int* inp_col_P, ScalarType* inp_val_P, ScalarType* Y, int N, int D, ScalarType* dC)
+	{
+		// Compute all terms required for t-SNE gradient
+		ScalarType* pos_f = (ScalarType*) calloc(N * D, sizeof(ScalarType));
+		ScalarType* neg_f = (ScalarType*) calloc(N * D, sizeof(ScalarType));
+		if(pos_f == NULL || neg_f == NULL) { printf("Memory allocation failed!\n"); exit(1); }
+		computeEdgeForces(inp_row_P, inp_col_P, inp_val_P, Y, N, D, pos_f);
+		ScalarType sum_Q = interpolation.computeNonEdgeForces(Y, N, neg_f);
+
+		// Compute final t-SNE gradient
+		for(int i = 0; i < N * D; i++) {
+			dC[i] = pos_f[i] - (neg_f[i] / sum_Q);
+		}
+		free(pos_f);
+		free(neg_f);
+	}
+
+	// Computes attractive forces along the edges of the input similarity graph
+	void computeEdgeForces(int* row_P, int* col_P, ScalarType* val_P, ScalarType* Y, int N, int D, ScalarType* pos_f)
+	{
+#pragma omp parallel for
+		for(int n = 0; n < N; n++) {
+			for(int i = row_P[n]; i < row_P[n + 1]; i++) {
+
+				// Compute pairwise distance and Q-value
+				ScalarType Q = .0;
+				for(int d = 0; d < D; d++) Q += (Y[n * D + d] - Y[col_P[i] * D + d]) * (Y[n * D + d] - Y[col_P[i] * D + d]);
+				Q = val_P[i] / (1.0 + Q);
+
+				// Sum positive force
+				for(int d = 0; d < D; d++) pos_f[n * D + d] += Q * (Y[n * D + d] - Y[col_P[i] * D + d]);
+			}
+		}
+	}
+
 	void computeExactGradient(ScalarType* P, ScalarType* Y, int N, int D, ScalarType* dC)
 	{
 		// Make sure the current gradient contains zeros
@@ -301,6 +346,7 @@ private:
 		ScalarType* Q    = (ScalarType*) malloc(N * N * sizeof(ScalarType));
 		if(Q == NULL) { printf("Memory allocation failed!\n"); exit(1); }
 		ScalarType sum_Q = .0;
+#pragma omp parallel for reduction(+:sum_Q)
 		for(int n = 0; n < N; n++) {
 			for(int m = 0; m < N; m++) {
 				if(n != m) {
@@ -311,6 +357,7 @@ private:
 		}
 
 		// Perform the computation of the gradient
+#pragma omp parallel for
 		for(int n = 0; n < N; n++) {
 			for(int m = 0; m < N; m++) {
 				if(n != m) {
@@ -327,13 +374,13 @@ private:
 		free(Q);  Q  = NULL;
 	}
 
-	ScalarType evaluateError(ScalarType* P, ScalarType* Y, int N)
+	ScalarType evaluateError(ScalarType* P, ScalarType* Y, int N, int D)
 	{
 		// Compute the squared Euclidean distance matrix
 		ScalarType* DD = (ScalarType*) malloc(N * N * sizeof(ScalarType));
 		ScalarType* Q = (ScalarType*) malloc(N * N * sizeof(ScalarType));
 		if(DD == NULL || Q == NULL) { printf("Memory allocation failed!\n"); exit(1); }
-		computeSquaredEuclideanDistance(Y, N, 2, DD);
+		computeSquaredEuclideanDistance(Y, N, D, DD);
 
 		// Compute Q-matrix and normalization sum
 		ScalarType sum_Q = DBL_MIN;
@@ -362,26 +409,35 @@ private:
 		return C;
 	}
 
-	ScalarType evaluateError(int* row_P, int* col_P, ScalarType* val_P, ScalarType* Y, int N, ScalarType theta)
+	ScalarType evaluateError(int* row_P, int* col_P, ScalarType* val_P, ScalarType* Y, int N, int D, ScalarType theta, Interpolation* interpolation)
 	{
 		// Get estimate of normalization term
-		const int QT_NO_DIMS = 2;
-		QuadTree* tree = new QuadTree(Y, N);
-		ScalarType buff[QT_NO_DIMS] = {.0, .0};
 		ScalarType sum_Q = .0;
-		for(int n = 0; n < N; n++) tree->computeNonEdgeForces(n, theta, buff, &sum_Q);
+		if(interpolation) {
+			ScalarType* neg_f = (ScalarType*) malloc(N * D * sizeof(ScalarType));
+			if(neg_f == NULL) { printf("Memory allocation failed!\n"); exit(1); }
+			sum_Q = interpolation->computeNonEdgeForces(Y, N, neg_f);
+			free(neg_f);
+		}
+		else {
+			QuadTree* tree = new QuadTree(Y, N);
+#pragma omp parallel for reduction(+:sum_Q)
+			for(int n = 0; n < N; n++) {
+				ScalarType buff[2] = {.0, .0};
+				ScalarType point_Q = .0;
+				tree->computeNonEdgeForces(n, theta, buff, &point_Q);
+				sum_Q += point_Q;
+			}
+			delete tree;
+		}
 
 		// Loop over all edges to compute t-SNE error
-		int ind1, ind2;
-		ScalarType C = .0, Q;
+		ScalarType C = .0;
+#pragma omp parallel for reduction(+:C)
 		for(int n = 0; n < N; n++) {
-			ind1 = n * QT_NO_DIMS;
 			for(int i = row_P[n]; i < row_P[n + 1]; i++) {
-				Q = .0;
-				ind2 = col_P[i] * QT_NO_DIMS;
-				for(int d = 0; d < QT_NO_DIMS; d++) buff[d]  = Y[ind1 + d];
-				for(int d = 0; d < QT_NO_DIMS; d++) buff[d] -= Y[ind2 + d];
-				for(int d = 0; d < QT_NO_DIMS; d++) Q += buff[d] * buff[d];
+				ScalarType Q = .0;
+				for(int d = 0; d < D; d++) Q += (Y[n * D + d] - Y[col_P[i] * D + d]) * (Y[n * D + d] - Y[col_P[i] * D + d]);
 				Q = (1.0 / (1.0 + Q)) / sum_Q;
 				C += val_P[i] * log((val_P[i] + FLT_MIN) / (Q + FLT_MIN));
 			}
@@ -420,6 +476,7 @@ private:
 		computeSquaredEuclideanDistance(X, N, D, DD);
 
 		// Compute the Gaussian kernel row by row
+#pragma omp parallel for
 		for(int n = 0; n < N; n++) {
 
 			// Initialize some variables
@@ -491,8 +548,6 @@ private:
 		int* row_P = *_row_P;
 		int* col_P = *_col_P;
 		ScalarType* val_P = *_val_P;
-		ScalarType* cur_P = (ScalarType*) malloc((N - 1) * sizeof(ScalarType));
-		if(cur_P == NULL) { printf("Memory allocation failed!\n"); exit(1); }
 		row_P[0] = 0;
 		for(int n = 0; n < N; n++) row_P[n + 1] = row_P[n] + K;
 
@@ -502,77 +557,79 @@ private:
 		for(int n = 0; n < N; n++) obj_X[n] = DataPoint(D, n, X + n * D);
 		tree->create(obj_X);
 
-		// Loop over all points to find nearest neighbors
-		//printf("Building tree...\n");
-		std::vector<DataPoint> indices;
-		std::vector<ScalarType> distances;
-		for(int n = 0; n < N; n++) {
-
-			//if(n % 10000 == 0) printf(" - point %d of %d\n", n, N);
-
-			// Find nearest neighbors
-			indices.clear();
-			distances.clear();
-			tree->search(obj_X[n], K + 1, &indices, &distances);
-
-			// Initialize some variables for binary search
-			bool found = false;
-			ScalarType beta = 1.0;
-			ScalarType min_beta = -DBL_MAX;
-			ScalarType max_beta =  DBL_MAX;
-			ScalarType tol = 1e-5;
-
-			// Iterate until we found a good perplexity
-			int iter = 0; ScalarType sum_P;
-			while(!found && iter < 200) {
-
-				// Compute Gaussian kernel row
-				for(int m = 0; m < K; m++) cur_P[m] = exp(-beta * distances[m + 1]);
-
-				// Compute entropy of current row
-				sum_P = DBL_MIN;
-				for(int m = 0; m < K; m++) sum_P += cur_P[m];
-				ScalarType H = .0;
-				for(int m = 0; m < K; m++) H += beta * (distances[m + 1] * cur_P[m]);
-				H = (H / sum_P) + log(sum_P);
-
-				// Evaluate whether the entropy is within the tolerance level
-				ScalarType Hdiff = H - log(perplexity);
-				if(Hdiff < tol && -Hdiff < tol) {
-					found = true;
-				}
-				else {
-					if(Hdiff > 0) {
-						min_beta = beta;
-						if(max_beta == DBL_MAX || max_beta == -DBL_MAX)
-							beta *= 2.0;
-						else
-							beta = (beta + max_beta) / 2.0;
+		// Loop over all points to find nearest neighbors and calibrate their
+		// bandwidths, every thread with its own buffers
+#pragma omp parallel
+		{
+			std::vector<ScalarType> cur_P(K);
+			std::vector<DataPoint> indices;
+			std::vector<ScalarType> distances;
+#pragma omp for
+			for(int n = 0; n < N; n++) {
+
+				// Find nearest neighbors
+				indices.clear();
+				distances.clear();
+				tree->search(obj_X[n], K + 1, &indices, &distances);
+
+				// Initialize some variables for binary search
+				bool found = false;
+				ScalarType beta = 1.0;
+				ScalarType min_beta = -DBL_MAX;
+				ScalarType max_beta =  DBL_MAX;
+				ScalarType tol = 1e-5;
+
+				// Iterate until we found a good perplexity
+				int iter = 0; ScalarType sum_P;
+				while(!found && iter < 200) {
+
+					// Compute Gaussian kernel row
+					for(int m = 0; m < K; m++) cur_P[m] = exp(-beta * distances[m + 1]);
+
+					// Compute entropy of current row
+					sum_P = DBL_MIN;
+					for(int m = 0; m < K; m++) sum_P += cur_P[m];
+					ScalarType H = .0;
+					for(int m = 0; m < K; m++) H += beta * (distances[m + 1] * cur_P[m]);
+					H = (H / sum_P) + log(sum_P);
+
+					// Evaluate whether the entropy is within the tolerance level
+					ScalarType Hdiff = H - log(perplexity);
+					if(Hdiff < tol && -Hdiff < tol) {
+						found = true;
 					}
 					else {
-						max_beta = beta;
-						if(min_beta == -DBL_MAX || min_beta == DBL_MAX)
-							beta /= 2.0;
-						else
-							beta = (beta + min_beta) / 2.0;
+						if(Hdiff > 0) {
+							min_beta = beta;
+							if(max_beta == DBL_MAX || max_beta == -DBL_MAX)
+								beta *= 2.0;
+							else
+								beta = (beta + max_beta) / 2.0;
+						}
+						else {
+							max_beta = beta;
+							if(min_beta == -DBL_MAX || min_beta == DBL_MAX)
+								beta /= 2.0;
+							else
+								beta = (beta + min_beta) / 2.0;
+						}
 					}
-				}
 
-				// Update iteration counter
-				iter++;
-			}
+					// Update iteration counter
+					iter++;
+				}
 
-			// Row-normalize current row of P and store in matrix
-			for(int m = 0; m < K; m++) cur_P[m] /= sum_P;
-			for(int m = 0; m < K; m++) {
-				col_P[row_P[n] + m] = indices[m + 1].index();
-				val_P[row_P[n] + m] = cur_P[m];
+				// Row-normalize current row of P and store in matrix
+				for(int m = 0; m < K; m++) cur_P[m] /= sum_P;
+				for(int m = 0; m < K; m++) {
+					col_P[row_P[n] + m] = indices[m + 1].index();
+					val_P[row_P[n] + m] = cur_P[m];
+				}
 			}
 		}
 
 		// Clean up memory
 		obj_X.clear();
-		free(cur_P);
 		delete tree;
 	}
 
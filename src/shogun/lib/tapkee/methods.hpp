@@ -107,10 +107,11 @@ public:
 		plain_distance(PlainDistance<RandomAccessIterator,DistanceCallback>(distance)),
 		kernel_distance(KernelDistance<RandomAccessIterator,KernelCallback>(kernel)),
 		begin(b), end(e), p_computation_strategy(),
-		p_eigen_method(), p_neighbors_method(), p_eigenshift(), p_traceshift(),
+		p_eigen_method(), p_neighbors_method(), p_nndescent_max_iteration(),
+		p_nndescent_sample_rate(), p_nndescent_tolerance(), p_eigenshift(), p_traceshift(),
 		p_check_connectivity(), p_n_neighbors(), p_width(), p_timesteps(),
 		p_ratio(), p_max_iteration(), p_tolerance(), p_n_updates(), p_perplexity(),
-		p_theta(), p_squishing_rate(), p_global_strategy(), p_epsilon(), p_target_dimension(),
+		p_theta(), p_interpolation(), p_squishing_rate(), p_global_strategy(), p_epsilon(), p_target_dimension(),
 		n_vectors(0), current_dimension(0)
 	{
 		n_vectors = (end-begin);
@@ -130,6 +131,9 @@ public:
 		p_computation_strategy = parameters[computation_strategy];
 		p_eigen_method = parameters[eigen_method];
 		p_neighbors_method = parameters[neighbors_method];
+		p_nndescent_max_iteration = parameters[nndescent_max_iteration].checked().satisfies(NonNegativity<IndexType>());
+		p_nndescent_sample_rate = parameters[nndescent_sample_rate].checked().satisfies(InClosedRange<ScalarType>(0.0,1.0));
+		p_nndescent_tolerance = parameters[nndescent_tolerance].checked().satisfies(NonNegativity<ScalarType>());
 		p_check_connectivity = parameters[check_connectivity];
 		p_width = parameters[gaussian_kernel_width].checked().satisfies(Positivity<ScalarType>());
 		p_timesteps = parameters[diffusion_map_timesteps].checked().satisfies(Positivity<IndexType>());
@@ -139,6 +143,7 @@ public:
 		p_tolerance = parameters[spe_tolerance].checked().satisfies(Positivity<ScalarType>());
 		p_n_updates = parameters[spe_num_updates].checked().satisfies(Positivity<IndexType>());
 		p_theta = parameters[sne_theta].checked().satisfies(NonNegativity<ScalarType>());
+		p_interpolation = parameters[sne_interpolation];
 		p_squishing_rate = parameters[squishing_rate];
 		p_global_strategy = parameters[spe_global_strategy];
 		p_epsilon = parameters[fa_epsilon].checked().satisfies(NonNegativity<ScalarType>());
@@ -215,6 +220,9 @@ private:
 	Parameter p_computation_strategy;
 	Parameter p_eigen_method;
 	Parameter p_neighbors_method;
+	Parameter p_nndescent_max_iteration;
+	Parameter p_nndescent_sample_rate;
+	Parameter p_nndescent_tolerance;
 	Parameter p_eigenshift;
 	Parameter p_traceshift;
 	Parameter p_check_connectivity;
@@ -227,6 +235,7 @@ private:
 	Parameter p_n_updates;
 	Parameter p_perplexity;
 	Parameter p_theta;
+	Parameter p_interpolation;
 	Parameter p_squishing_rate;
 	Parameter p_global_strategy;
 	Parameter p_epsilon;
@@ -238,7 +247,8 @@ private:
 	template<class Distance>
 	Neighbors findNeighborsWith(Distance d)
 	{
-		return find_neighbors(p_neighbors_method,begin,end,d,p_n_neighbors,p_check_connectivity);
+		return find_neighbors(p_neighbors_method,begin,end,d,p_n_neighbors,p_check_connectivity,
+		                      p_nndescent_max_iteration,p_nndescent_sample_rate,p_nndescent_tolerance);
 	}
 
 	static tapkee::ProjectingFunction unimplementedProjectingFunction()
@@ -359,33 +369,27 @@ private:
 			compute_shortest_distances_matrix(begin,end,landmarks,neighbors,distance);
 		distance_matrix = distance_matrix.array().square();
 
-		DenseVector col_means = distance_matrix.colwise().mean();
-		DenseVector row_means = distance_matrix.rowwise().mean();
-		ScalarType grand_mean = distance_matrix.mean();
-		distance_matrix.array() += grand_mean;
-		distance_matrix.colwise() -= row_means;
-		distance_matrix.rowwise() -= col_means.transpose();
-		distance_matrix.array() *= -0.5;
-
-		EigendecompositionResult landmarks_embedding;
-
-		if (p_eigen_method.is(Dense))
-		{
-			DenseMatrix distance_matrix_sym = distance_matrix*distance_matrix.transpose();
-			landmarks_embedding = eigendecomposition(p_eigen_method,p_computation_strategy,
-					LargestEigenvalues,distance_matrix_sym,p_target_dimension);
-		}
-		else
+		// classical scaling of the landmarks only, shortest paths
+		// of the directed neighbors graph are symmetrized
+		const IndexType n_landmarks = landmarks.size();
+		DenseSymmetricMatrix landmarks_distance_matrix(n_landmarks,n_landmarks);
+		for (IndexType i=0; i<n_landmarks; i++)
 		{
-			landmarks_embedding = eigendecomposition(p_eigen_method,p_computation_strategy,
-					SquaredLargestEigenvalues,distance_matrix,p_target_dimension);
+			for (IndexType j=0; j<n_landmarks; j++)
+				landmarks_distance_matrix(i,j) = 0.5*(distance_matrix(i,landmarks[j]) + distance_matrix(j,landmarks[i]));
 		}
+		DenseVector landmark_distances_squared = landmarks_distance_matrix.colwise().mean();
+		centerMatrix(landmarks_distance_matrix);
+		landmarks_distance_matrix.array() *= -0.5;
 
-		DenseMatrix embedding = distance_matrix.transpose()*landmarks_embedding.first;
-
+		EigendecompositionResult landmarks_embedding =
+			eigendecomposition(p_eigen_method,p_computation_strategy,LargestEigenvalues,
+					landmarks_distance_matrix,p_target_dimension);
 		for (IndexType i=0; i<static_cast<IndexType>(p_target_dimension); i++)
-			embedding.col(i).array() /= sqrt(sqrt(landmarks_embedding.second(i)));
-		return TapkeeOutput(embedding,unimplementedProjectingFunction());
+			landmarks_embedding.first.col(i).array() *= sqrt(landmarks_embedding.second(i));
+
+		return TapkeeOutput(triangulate(distance_matrix,landmarks,landmark_distances_squared,
+			landmarks_embedding,p_target_dimension),unimplementedProjectingFunction());
 	}
 
 	TapkeeOutput embedNeighborhoodPreservingEmbedding()
@@ -524,13 +528,18 @@ private:
 	TapkeeOutput embedtDistributedStochasticNeighborEmbedding()
 	{
 		p_perplexity.checked().satisfies(InClosedRange<ScalarType>(0.0,(n_vectors-1)/3.0));
+		// Barnes-Hut works with quadtrees, interpolation with 2-D or 3-D grids
+		if (p_interpolation.is(true))
+			p_target_dimension.checked().satisfies(InClosedRange<IndexType>(2,3));
+		else if (!p_theta.is(0.0))
+			p_target_dimension.checked().satisfies(InClosedRange<IndexType>(2,2));
 
 		DenseMatrix data =
 			dense_matrix_from_features(features, current_dimension, begin, end);
 
 		DenseMatrix embedding(static_cast<IndexType>(p_target_dimension),n_vectors);
 		tsne::TSNE tsne;
-		tsne.run(data,data.cols(),data.rows(),embedding.data(),p_target_dimension,p_perplexity,p_theta);
+		tsne.run(data,data.cols(),data.rows(),embedding.data(),p_target_dimension,p_perplexity,p_theta,p_interpolation);
 
 		return TapkeeOutput(embedding.transpose(), unimplementedProjectingFunction());
 	}
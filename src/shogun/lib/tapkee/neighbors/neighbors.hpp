@@ -12,6 +12,7 @@
 	#include <shogun/lib/tapkee/neighbors/covertree.hpp>
 #endif
 #include <shogun/lib/tapkee/neighbors/connected.hpp>
+#include <shogun/lib/tapkee/neighbors/nndescent.hpp>
 #include <shogun/lib/tapkee/neighbors/vptree.hpp>
 /* End of Tapkee includes */
 
@@ -172,7 +173,8 @@ Neighbors find_neighbors_vptree_impl(const RandomAccessIterator& begin, const Ra
 template <class RandomAccessIterator, class Callback>
 Neighbors find_neighbors(NeighborsMethod method, const RandomAccessIterator& begin,
                          const RandomAccessIterator& end, const Callback& callback,
-                         IndexType k, bool check_connectivity)
+                         IndexType k, bool check_connectivity, IndexType nndescent_max_iteration=10,
+                         ScalarType nndescent_sample_rate=0.5, ScalarType nndescent_tolerance=0.001)
 {
 	if (k > static_cast<IndexType>(end-begin-1))
 	{
@@ -187,6 +189,9 @@ Neighbors find_neighbors(NeighborsMethod method, const RandomAccessIterator& beg
 		neighbors = find_neighbors_bruteforce_impl(begin,end,callback,k);
 	if (method.is(VpTree))
 		neighbors = find_neighbors_vptree_impl(begin,end,callback,k);
+	if (method.is(NNDescent))
+		neighbors = find_neighbors_nndescent_impl(begin,end,callback,k,nndescent_max_iteration,
+		                                          nndescent_sample_rate,nndescent_tolerance);
 #ifdef TAPKEE_USE_LGPL_COVERTREE
 	if (method.is(CoverTree))
 		neighbors = find_neighbors_covertree_impl(begin,end,callback,k);
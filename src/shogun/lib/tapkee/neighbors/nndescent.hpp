@@ -0,0 +1,290 @@
+/* This software is distributed under BSD 3-clause license (see LICENSE file).
+ *
+ * Approximate k nearest neighbors graph construction following
+ * Dong, W., Moses, C., Li, K. (2011). Efficient k-nearest neighbor graph
+ * construction for generic similarity measures. WWW.
+ */
+
+#ifndef TAPKEE_NNDESCENT_H_
+#define TAPKEE_NNDESCENT_H_
+
+/* Tapkee includes */
+#include <shogun/lib/tapkee/defines.hpp>
+#include <shogun/lib/tapkee/utils/time.hpp>
+/* End of Tapkee includes */
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <random>
+
+namespace tapkee
+{
+namespace tapkee_internal
+{
+
+//! Current k nearest neighbors of all objects, kept as bounded max-heaps
+//! that can be updated concurrently
+class NNDescentGraph
+{
+public:
+	NNDescentGraph(IndexType n, IndexType k) :
+		N(n), K(k), indices(n*k,-1),
+		distances(n*k,std::numeric_limits<ScalarType>::max()),
+		is_new(n*k,0), locks(n)
+	{
+	}
+
+	//! Sets the initial neighbors of i, all distinct and different from i.
+	//! Unlike push it accepts any distance, infinite or NaN ones are kept
+	//! as infinite so that every finite candidate replaces them later.
+	void seed(IndexType i, const LocalNeighbors& neighbors, const std::vector<ScalarType>& neighbor_distances)
+	{
+		std::vector<std::pair<ScalarType,IndexType> > sorted;
+		sorted.reserve(neighbors.size());
+		for (size_t t=0; t<neighbors.size(); t++)
+		{
+			ScalarType distance = neighbor_distances[t];
+			if (std::isnan(distance))
+				distance = std::numeric_limits<ScalarType>::infinity();
+			sorted.push_back(std::make_pair(distance,neighbors[t]));
+		}
+		// in descending order the neighbors already form a max-heap
+		std::sort(sorted.rbegin(),sorted.rend());
+		std::lock_guard<std::mutex> lock(locks[i]);
+		for (size_t t=0; t<sorted.size(); t++)
+		{
+			indices[i*K+t] = sorted[t].second;
+			distances[i*K+t] = sorted[t].first;
+			is_new[i*K+t] = true;
+		}
+	}
+
+	//! Tries to add j as a neighbor of i, returns true if it was added
+	bool push(IndexType i, IndexType j, ScalarType distance)
+	{
+		std::lock_guard<std::mutex> lock(locks[i]);
+		IndexType* idx = &indices[i*K];
+		ScalarType* dist = &distances[i*K];
+		if (!(distance < dist[0]))
+			return false;
+		for (IndexType t=0; t<K; t++)
+		{
+			if (idx[t] == j)
+				return false;
+		}
+
+		// replace the farthest neighbor and restore the heap
+		IndexType pos = 0;
+		while (true)
+		{
+			IndexType largest = pos;
+			ScalarType largest_distance = distance;
+			for (IndexType child=2*pos+1; child<std::min(2*pos+3,K); child++)
+			{
+				if (dist[child] > largest_distance)
+				{
+					largest = child;
+					largest_distance = dist[child];
+				}
+			}
+			if (largest == pos)
+				break;
+			idx[pos] = idx[largest];
+			dist[pos] = dist[largest];
+			is_new[i*K+pos] = is_new[i*K+largest];
+			pos = largest;
+		}
+		idx[pos] = j;
+		dist[pos] = distance;
+		is_new[i*K+pos] = true;
+		return true;
+	}
+
+	//! Collects all old neighbors of i and up to n_samples random new ones,
+	//! which are marked old. Not safe to be called concurrently with push.
+	template <class PRNG>
+	void sample(IndexType i, IndexType n_samples, PRNG& prng,
+	            LocalNeighbors& new_candidates, LocalNeighbors& old_candidates)
+	{
+		new_candidates.clear();
+		old_candidates.clear();
+		LocalNeighbors fresh;
+		for (IndexType t=0; t<K; t++)
+		{
+			if (indices[i*K+t] < 0)
+				continue;
+			if (is_new[i*K+t])
+				fresh.push_back(t);
+			else
+				old_candidates.push_back(indices[i*K+t]);
+		}
+		for (IndexType s=0; s<std::min<IndexType>(n_samples,fresh.size()); s++)
+		{
+			std::swap(fresh[s],fresh[s+prng()%(fresh.size()-s)]);
+			is_new[i*K+fresh[s]] = false;
+			new_candidates.push_back(indices[i*K+fresh[s]]);
+		}
+	}
+
+	//! Returns neighbors of all objects ordered by distance
+	Neighbors neighbors() const
+	{
+		Neighbors result(N);
+#pragma omp parallel for
+		for (IndexType i=0; i<N; i++)
+		{
+			std::vector<std::pair<ScalarType,IndexType> > sorted;
+			for (IndexType t=0; t<K; t++)
+			{
+				if (indices[i*K+t] >= 0)
+					sorted.push_back(std::make_pair(distances[i*K+t],indices[i*K+t]));
+			}
+			std::sort(sorted.begin(),sorted.end());
+			result[i].reserve(sorted.size());
+			for (size_t t=0; t<sorted.size(); t++)
+				result[i].push_back(sorted[t].second);
+		}
+		return result;
+	}
+
+private:
+	IndexType N;
+	IndexType K;
+	std::vector<IndexType> indices;
+	std::vector<ScalarType> distances;
+	std::vector<char> is_new;
+	std::vector<std::mutex> locks;
+};
+
+//! Approximate k nearest neighbors by NN-descent: starting from random
+//! neighbors, neighbors of neighbors are compared until fewer than
+//! tolerance*N*k neighbors change in an iteration or max_iteration
+//! iterations are done. Every iteration considers at most
+//! sample_rate*k new candidates per object, lower rates trade recall
+//! for speed. Distances are computed in parallel.
+template <class RandomAccessIterator, class Callback>
+Neighbors find_neighbors_nndescent_impl(const RandomAccessIterator& begin, const RandomAccessIterator& end,
+                                        Callback callback, IndexType k, IndexType max_iteration,
+                                        ScalarType sample_rate, ScalarType tolerance)
+{
+	timed_context context("NN-descent based neighbors search");
+
+	const IndexType N = end-begin;
+	const IndexType n_samples = std::max<IndexType>(1,static_cast<IndexType>(sample_rate*k));
+	const IndexType seed = uniform_random_index();
+	NNDescentGraph graph(N,k);
+
+	// start with k distinct random neighbors, drawn by Floyd's algorithm
+	// from the N-1 other objects so that exactly k draws are needed
+#pragma omp parallel for
+	for (IndexType i=0; i<N; i++)
+	{
+		std::minstd_rand prng(seed+i);
+		LocalNeighbors initial;
+		initial.reserve(k);
+		for (IndexType m=N-1-k; m<N-1; m++)
+		{
+			IndexType j = prng()%(m+1);
+			if (std::find(initial.begin(),initial.end(),j) != initial.end())
+				j = m;
+			initial.push_back(j);
+		}
+		std::vector<ScalarType> initial_distances(k);
+		for (IndexType t=0; t<k; t++)
+		{
+			// skip i itself
+			if (initial[t] >= i)
+				initial[t]++;
+			initial_distances[t] = callback.distance(begin+i,begin+initial[t]);
+		}
+		graph.seed(i,initial,initial_distances);
+	}
+
+	std::vector<LocalNeighbors> new_candidates(N), old_candidates(N);
+	for (IndexType iteration=0; iteration<max_iteration; iteration++)
+	{
+#pragma omp parallel for
+		for (IndexType i=0; i<N; i++)
+		{
+			std::minstd_rand prng(seed+(iteration+1)*N+i);
+			graph.sample(i,n_samples,prng,new_candidates[i],old_candidates[i]);
+		}
+
+		// objects that have i as a neighbor are candidates of i as well,
+		// at most n_samples of each kind chosen by reservoir sampling
+		std::vector<LocalNeighbors> new_reverse(N), old_reverse(N);
+		std::vector<IndexType> new_seen(N,0), old_seen(N,0);
+		std::minstd_rand prng(seed+iteration);
+		for (IndexType i=0; i<N; i++)
+		{
+			for (size_t t=0; t<new_candidates[i].size(); t++)
+			{
+				IndexType j = new_candidates[i][t];
+				IndexType slot = prng()%(new_seen[j]+1);
+				if (new_reverse[j].size() < static_cast<size_t>(n_samples))
+					new_reverse[j].push_back(i);
+				else if (slot < n_samples)
+					new_reverse[j][slot] = i;
+				new_seen[j]++;
+			}
+			for (size_t t=0; t<old_candidates[i].size(); t++)
+			{
+				IndexType j = old_candidates[i][t];
+				IndexType slot = prng()%(old_seen[j]+1);
+				if (old_reverse[j].size() < static_cast<size_t>(n_samples))
+					old_reverse[j].push_back(i);
+				else if (slot < n_samples)
+					old_reverse[j][slot] = i;
+				old_seen[j]++;
+			}
+		}
+
+		// compare pairs of candidates of every object, at least one new
+		IndexType updates = 0;
+#pragma omp parallel for schedule(dynamic,64) reduction(+:updates)
+		for (IndexType i=0; i<N; i++)
+		{
+			LocalNeighbors& fresh = new_candidates[i];
+			LocalNeighbors& old = old_candidates[i];
+			fresh.insert(fresh.end(),new_reverse[i].begin(),new_reverse[i].end());
+			old.insert(old.end(),old_reverse[i].begin(),old_reverse[i].end());
+			std::sort(fresh.begin(),fresh.end());
+			fresh.erase(std::unique(fresh.begin(),fresh.end()),fresh.end());
+			std::sort(old.begin(),old.end());
+			old.erase(std::unique(old.begin(),old.end()),old.end());
+
+			for (size_t a=0; a<fresh.size(); a++)
+			{
+				for (size_t b=a+1; b<fresh.size(); b++)
+				{
+					ScalarType d = callback.distance(begin+fresh[a],begin+fresh[b]);
+					updates += graph.push(fresh[a],fresh[b],d);
+					updates += graph.push(fresh[b],fresh[a],d);
+				}
+				for (size_t b=0; b<old.size(); b++)
+				{
+					if (old[b] == fresh[a])
+						continue;
+					ScalarType d = callback.distance(begin+fresh[a],begin+old[b]);
+					updates += graph.push(fresh[a],old[b],d);
+					updates += graph.push(old[b],fresh[a],d);
+				}
+			}
+		}
+
+		LoggingSingleton::instance().message_debug(
+			formatting::format("NN-descent iteration {}: {} updates", iteration, updates));
+		if (updates <= tolerance*N*k)
+			break;
+	}
+
+	return graph.neighbors();
+}
+
+} // End of namespace tapkee_internal
+} // End of namespace tapkee
+
+#endif
@@ -33,7 +33,11 @@ const stichwort::ParametersSet defaults = (
 	tapkee::cancel_function = stichwort::by_default,
 	tapkee::sne_perplexity = stichwort::by_default,
 	tapkee::squishing_rate = stichwort::by_default,
-	tapkee::sne_theta = stichwort::by_default);
+	tapkee::sne_theta = stichwort::by_default,
+	tapkee::sne_interpolation = stichwort::by_default,
+	tapkee::nndescent_max_iteration = stichwort::by_default,
+	tapkee::nndescent_sample_rate = stichwort::by_default,
+	tapkee::nndescent_tolerance = stichwort::by_default);
 }
 
 }
@@ -116,6 +116,47 @@ DenseMatrix triangulate(RandomAccessIterator begin, RandomAccessIterator end, Pa
 	return embedding;
 }
 
+//! Triangulates all vectors given their squared distances to the landmarks
+//! stored column-wise in a landmarks x vectors matrix, e.g. geodesic
+//! distances of landmark Isomap. Needs no other pairwise distances.
+inline DenseMatrix triangulate(const DenseMatrix& distances_squared, Landmarks& landmarks,
+                               DenseVector& landmark_distances_squared,
+                               EigendecompositionResult& landmarks_embedding, IndexType target_dimension)
+{
+	timed_context context("Landmark triangulation");
+
+	const IndexType n_vectors = distances_squared.cols();
+	const IndexType n_landmarks = landmarks.size();
+
+	std::vector<bool> to_process(n_vectors,true);
+	DenseMatrix embedding(n_vectors,target_dimension);
+
+	for (IndexType index_iter=0; index_iter<n_landmarks; ++index_iter)
+	{
+		to_process[landmarks[index_iter]] = false;
+		embedding.row(landmarks[index_iter]).noalias() = landmarks_embedding.first.row(index_iter);
+	}
+
+	for (IndexType i=0; i<target_dimension; ++i)
+		landmarks_embedding.first.col(i).array() /= landmarks_embedding.second(i);
+
+#pragma omp parallel
+	{
+		DenseVector distances_to_landmarks(n_landmarks);
+#pragma omp for nowait
+		for (IndexType index_iter=0; index_iter<n_vectors; ++index_iter)
+		{
+			if (!to_process[index_iter])
+				continue;
+
+			distances_to_landmarks = distances_squared.col(index_iter) - landmark_distances_squared;
+			embedding.row(index_iter).noalias() = -0.5*landmarks_embedding.first.transpose()*distances_to_landmarks;
+		}
+	}
+
+	return embedding;
+}
+
 template <class RandomAccessIterator, class PairwiseCallback>
 DenseSymmetricMatrix compute_distance_matrix(RandomAccessIterator begin, RandomAccessIterator end,
                                              PairwiseCallback callback)
@@ -87,6 +87,8 @@ std::shared_ptr<DenseFeatures<float64_t>> shogun::tapkee_embed(const shogun::TAP
 #else
 	tapkee::NeighborsMethod neighbors_method = tapkee::VpTree;
 #endif
+	if (parameters.neighbors_method == NEIGHBORS_NN_DESCENT)
+		neighbors_method = tapkee::NNDescent;
 	size_t N = 0;
 
 	switch (parameters.method)
@@ -179,6 +181,9 @@ std::shared_ptr<DenseFeatures<float64_t>> shogun::tapkee_embed(const shogun::TAP
 		 tapkee::fa_epsilon = parameters.fa_epsilon,
 		 tapkee::sne_perplexity = parameters.sne_perplexity,
 		 tapkee::sne_theta = parameters.sne_theta,
+		 tapkee::sne_interpolation = parameters.sne_interpolation,
+		 tapkee::nndescent_max_iteration = parameters.nndescent_max_iteration,
+		 tapkee::nndescent_sample_rate = parameters.nndescent_sample_rate,
 		 tapkee::squishing_rate = parameters.squishing_rate
 		 );
 
@@ -13,6 +13,7 @@
 #include <shogun/kernel/Kernel.h>
 #include <shogun/distance/Distance.h>
 #include <shogun/features/DenseFeatures.h>
+#include <shogun/converter/EmbeddingConverter.h>
 
 using namespace shogun;
 
@@ -50,8 +51,9 @@ struct TAPKEE_PARAMETERS_FOR_SHOGUN
 		gaussian_kernel_width(1.0), spe_tolerance(1e-5),
 		spe_global_strategy(false), max_iteration(100),
 		fa_epsilon(1e-5), sne_theta(0.5),
-		sne_perplexity(30.0), squishing_rate(0.99),
-		kernel(NULL), distance(NULL), features(NULL)
+		sne_perplexity(30.0), sne_interpolation(false), squishing_rate(0.99),
+		neighbors_method(NEIGHBORS_EXACT), nndescent_max_iteration(10),
+		nndescent_sample_rate(0.5), kernel(NULL), distance(NULL), features(NULL)
 	{
 	}
 	TAPKEE_METHODS_FOR_SHOGUN method;
@@ -68,7 +70,11 @@ struct TAPKEE_PARAMETERS_FOR_SHOGUN
 	float64_t fa_epsilon;
 	float64_t sne_theta;
 	float64_t sne_perplexity;
+	bool sne_interpolation;
 	float64_t squishing_rate;
+	ENeighborsMethod neighbors_method;
+	uint32_t nndescent_max_iteration;
+	float64_t nndescent_sample_rate;
 	Kernel* kernel;
 	Distance* distance;
 	DotFeatures* features;
@@ -143,6 +143,7 @@ bool BaggingMachine::train_machine(std::shared_ptr<Features> data)
 
 	// clear the array, if previously trained
 	m_bags.clear();
+	m_bags.resize(m_num_bags);
 
 	// reset the oob index vector
 	m_all_oob_idx = SGVector<bool>(m_features->get_num_vectors());
@@ -150,9 +151,13 @@ bool BaggingMachine::train_machine(std::shared_ptr<Features> data)
 
 
 	m_oob_indices.clear();
+	m_oob_indices.resize(m_num_bags);
 
 	SGMatrix<index_t> rnd_indicies(m_bag_size, m_num_bags);
 	random::fill_array(rnd_indicies, 0, m_bag_size - 1, m_prng);
+	// clones share the state of the prototype's generator, so bag i is
+	// seeded from substream i to give every bag its own randomness
+	auto bag_prng = counter_prng();
 
 	auto pb = SG_PROGRESS(range(m_num_bags));
 #pragma omp parallel for
@@ -160,6 +165,7 @@ bool BaggingMachine::train_machine(std::shared_ptr<Features> data)
 	{
 		auto c=std::dynamic_pointer_cast<Machine>(m_machine->clone());
 		ASSERT(c != NULL);
+		random::seed(c, bag_prng.substream(i));
 		SGVector<index_t> idx(
 		    rnd_indicies.get_column_vector(i), m_bag_size, false);
 
@@ -204,13 +210,13 @@ bool BaggingMachine::train_machine(std::shared_ptr<Features> data)
 #pragma omp critical
 		{
 		// get out of bag indexes
-		auto oob = get_oob_indices(idx);
-		m_oob_indices.push_back(oob);
-
-		// add trained machine to bag array
-		m_bags.push_back(c);
+		m_oob_indices[i] = get_oob_indices(idx);
 		}
 
+		// add trained machine to bag array, in bag order rather than in
+		// the order the threads finish
+		m_bags[i] = c;
+
 		pb.print_progress();
 	}
 	pb.complete();
@@ -0,0 +1,577 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/base/progress.h>
+#include <shogun/labels/DenseLabels.h>
+#include <shogun/labels/RegressionLabels.h>
+#include <shogun/machine/HistogramGBMachine.h>
+#include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/mathematics/linalg/LinalgNamespace.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+using namespace shogun;
+
+namespace
+{
+	/** min number of (vector, feature) pairs to build a histogram or to
+	 * search a split in parallel
+	 */
+	constexpr int64_t kMinParallelWork = 1 << 14;
+
+	/** gradient statistics of a histogram bin or a node */
+	struct GradientSums
+	{
+		float64_t g = 0;
+		float64_t h = 0;
+		index_t count = 0;
+
+		GradientSums& operator+=(const GradientSums& other)
+		{
+			g += other.g;
+			h += other.h;
+			count += other.count;
+			return *this;
+		}
+
+		GradientSums& operator-=(const GradientSums& other)
+		{
+			g -= other.g;
+			h -= other.h;
+			count -= other.count;
+			return *this;
+		}
+	};
+
+	/** best split of a leaf */
+	struct Split
+	{
+		float64_t gain = std::numeric_limits<float64_t>::lowest();
+		index_t feature = -1;
+		index_t bin = -1;
+		/** statistics of the left child */
+		GradientSums left;
+	};
+
+	/** leaf of a tree that is being grown */
+	struct Leaf
+	{
+		/** index of the tree node */
+		index_t node;
+		/** rows of the leaf are rows[begin, end) */
+		index_t begin;
+		index_t end;
+		int32_t depth;
+		GradientSums sums;
+		/** histogram of every feature, max_bins bins each */
+		std::vector<GradientSums> histogram;
+		Split split;
+	};
+
+	/** flat storage of the nodes of all trees */
+	struct Nodes
+	{
+		std::vector<int32_t> feature;
+		std::vector<int32_t> bin;
+		std::vector<float64_t> threshold;
+		std::vector<int32_t> left;
+		std::vector<int32_t> right;
+		std::vector<float64_t> value;
+
+		index_t add()
+		{
+			feature.push_back(-1);
+			bin.push_back(-1);
+			threshold.push_back(0);
+			left.push_back(-1);
+			right.push_back(-1);
+			value.push_back(0);
+			return feature.size() - 1;
+		}
+	};
+
+	/** grows one leaf-wise tree on binned features */
+	class TreeBuilder
+	{
+	public:
+		TreeBuilder(
+		    const std::vector<uint8_t>& bins,
+		    const std::vector<SGVector<float64_t>>& edges, index_t num_vecs,
+		    index_t stride, const SGVector<float64_t>& g,
+		    const SGVector<float64_t>& h, std::vector<index_t> features,
+		    int32_t max_leaves, int32_t max_depth, int32_t min_samples_leaf,
+		    float64_t lambda, float64_t min_split_gain,
+		    float64_t learning_rate)
+		    : m_bins(bins), m_edges(edges), m_num_vecs(num_vecs),
+		      m_stride(stride), m_g(g), m_h(h), m_features(std::move(features)),
+		      m_max_leaves(max_leaves), m_max_depth(max_depth),
+		      m_min_samples_leaf(min_samples_leaf), m_lambda(lambda),
+		      m_min_split_gain(min_split_gain), m_learning_rate(learning_rate)
+		{
+		}
+
+		/** @return root of the tree grown on given rows */
+		index_t grow(std::vector<index_t> rows, Nodes& nodes)
+		{
+			m_rows = std::move(rows);
+
+			std::vector<Leaf> leaves(1);
+			auto& root = leaves[0];
+			root.node = nodes.add();
+			root.begin = 0;
+			root.end = m_rows.size();
+			root.depth = 0;
+			for (auto row : m_rows)
+				root.sums += {m_g[row], m_h[row], 1};
+			build_histogram(root);
+			find_split(root);
+			auto root_node = root.node;
+
+			while (leaves.size() < (size_t)m_max_leaves)
+			{
+				// leaf-wise growth: split the leaf with the largest gain
+				index_t best = -1;
+				for (index_t i = 0; i < (index_t)leaves.size(); ++i)
+				{
+					if (leaves[i].split.feature >= 0 &&
+					    (best == -1 ||
+					     leaves[i].split.gain > leaves[best].split.gain))
+						best = i;
+				}
+				if (best == -1)
+					break;
+
+				auto parent = std::move(leaves[best]);
+				leaves.erase(leaves.begin() + best);
+				auto children = split_leaf(parent, nodes);
+				leaves.push_back(std::move(children.first));
+				leaves.push_back(std::move(children.second));
+			}
+
+			for (const auto& leaf : leaves)
+			{
+				nodes.value[leaf.node] = -m_learning_rate * leaf.sums.g /
+				                         (leaf.sums.h + m_lambda);
+			}
+			return root_node;
+		}
+
+	private:
+		void build_histogram(Leaf& leaf) const
+		{
+			leaf.histogram.assign(m_edges.size() * m_stride, GradientSums());
+			const index_t num_features = m_features.size();
+			const bool parallel =
+			    int64_t(leaf.end - leaf.begin) * num_features >=
+			    kMinParallelWork;
+
+#pragma omp parallel for schedule(dynamic) if (parallel)
+			for (index_t k = 0; k < num_features; ++k)
+			{
+				auto f = m_features[k];
+				auto hist = leaf.histogram.data() + f * m_stride;
+				auto feature_bins = m_bins.data() + int64_t(f) * m_num_vecs;
+				for (index_t r = leaf.begin; r < leaf.end; ++r)
+				{
+					auto row = m_rows[r];
+					auto& bin = hist[feature_bins[row]];
+					bin.g += m_g[row];
+					bin.h += m_h[row];
+					++bin.count;
+				}
+			}
+		}
+
+		float64_t score(const GradientSums& sums) const
+		{
+			return sums.g * sums.g / (sums.h + m_lambda);
+		}
+
+		void find_split(Leaf& leaf) const
+		{
+			leaf.split = Split();
+			if (m_max_depth > 0 && leaf.depth >= m_max_depth)
+				return;
+			if (leaf.sums.count < 2 * m_min_samples_leaf)
+				return;
+
+			// best split of each feature, reduced in feature order
+			const index_t num_features = m_features.size();
+			std::vector<Split> splits(num_features);
+			const float64_t parent_score = score(leaf.sums);
+			const bool parallel =
+			    int64_t(num_features) * m_stride >= kMinParallelWork;
+
+#pragma omp parallel for schedule(dynamic) if (parallel)
+			for (index_t k = 0; k < num_features; ++k)
+			{
+				auto f = m_features[k];
+				auto hist = leaf.histogram.data() + f * m_stride;
+				const index_t num_bins = m_edges[f].vlen;
+				GradientSums left;
+				for (index_t b = 0; b < num_bins - 1; ++b)
+				{
+					left += hist[b];
+					if (left.count < m_min_samples_leaf)
+						continue;
+					auto right = leaf.sums;
+					right -= left;
+					if (right.count < m_min_samples_leaf)
+						break;
+
+					auto gain = score(left) + score(right) - parent_score;
+					if (gain > splits[k].gain)
+					{
+						splits[k].gain = gain;
+						splits[k].feature = f;
+						splits[k].bin = b;
+						splits[k].left = left;
+					}
+				}
+			}
+
+			for (const auto& split : splits)
+			{
+				if (split.feature >= 0 && split.gain > m_min_split_gain &&
+				    split.gain > leaf.split.gain)
+					leaf.split = split;
+			}
+		}
+
+		std::pair<Leaf, Leaf> split_leaf(Leaf& parent, Nodes& nodes)
+		{
+			const auto& split = parent.split;
+			auto feature_bins =
+			    m_bins.data() + int64_t(split.feature) * m_num_vecs;
+			auto mid = std::stable_partition(
+			    m_rows.begin() + parent.begin, m_rows.begin() + parent.end,
+			    [&](index_t row) { return feature_bins[row] <= split.bin; });
+
+			Leaf left, right;
+			left.node = nodes.add();
+			right.node = nodes.add();
+			left.begin = parent.begin;
+			left.end = right.begin = mid - m_rows.begin();
+			right.end = parent.end;
+			left.depth = right.depth = parent.depth + 1;
+			left.sums = split.left;
+			right.sums = parent.sums;
+			right.sums -= split.left;
+
+			nodes.feature[parent.node] = split.feature;
+			nodes.bin[parent.node] = split.bin;
+			nodes.threshold[parent.node] = m_edges[split.feature][split.bin];
+			nodes.left[parent.node] = left.node;
+			nodes.right[parent.node] = right.node;
+
+			// histogram of the larger child is the parent's minus the
+			// smaller child's
+			auto& small = left.sums.count <= right.sums.count ? left : right;
+			auto& large = left.sums.count <= right.sums.count ? right : left;
+			build_histogram(small);
+			large.histogram = std::move(parent.histogram);
+			for (size_t i = 0; i < large.histogram.size(); ++i)
+				large.histogram[i] -= small.histogram[i];
+
+			find_split(left);
+			find_split(right);
+			return {std::move(left), std::move(right)};
+		}
+
+		const std::vector<uint8_t>& m_bins;
+		const std::vector<SGVector<float64_t>>& m_edges;
+		const index_t m_num_vecs;
+		const index_t m_stride;
+		const SGVector<float64_t>& m_g;
+		const SGVector<float64_t>& m_h;
+		const std::vector<index_t> m_features;
+		const int32_t m_max_leaves;
+		const int32_t m_max_depth;
+		const int32_t m_min_samples_leaf;
+		const float64_t m_lambda;
+		const float64_t m_min_split_gain;
+		const float64_t m_learning_rate;
+		std::vector<index_t> m_rows;
+	};
+
+	/** @return sorted random subset of 0..n-1 */
+	template <typename PRNG>
+	std::vector<index_t> sample_indices(index_t n, float64_t fraction, PRNG& prng)
+	{
+		std::vector<index_t> indices(n);
+		std::iota(indices.begin(), indices.end(), 0);
+		if (fraction >= 1.0)
+			return indices;
+
+		random::shuffle(indices, prng);
+		indices.resize(std::max<index_t>(1, std::ceil(fraction * n)));
+		std::sort(indices.begin(), indices.end());
+		return indices;
+	}
+} // namespace
+
+HistogramGBMachine::HistogramGBMachine(
+    const std::shared_ptr<LossFunction>& loss, int32_t num_iterations,
+    float64_t learning_rate, float64_t subset_fraction)
+    : StochasticGBMachine(
+          nullptr, loss, num_iterations, learning_rate, subset_fraction)
+{
+	init();
+}
+
+HistogramGBMachine::~HistogramGBMachine()
+{
+}
+
+void HistogramGBMachine::init()
+{
+	m_max_bins = 255;
+	m_max_leaves = 31;
+	m_max_depth = 0;
+	m_min_samples_leaf = 20;
+	m_l2_regularization = 1.0;
+	m_min_split_gain = 0;
+	m_feature_fraction = 1.0;
+	m_base_score = 0;
+
+	SG_ADD(&m_max_bins, kMaxBins, "max number of bins per feature");
+	SG_ADD(&m_max_leaves, kMaxLeaves, "max number of leaves per tree");
+	SG_ADD(&m_max_depth, kMaxDepth, "max depth of trees, 0 for no limit");
+	SG_ADD(
+	    &m_min_samples_leaf, kMinSamplesLeaf,
+	    "min number of vectors in a leaf");
+	SG_ADD(
+	    &m_l2_regularization, kL2Regularization,
+	    "L2 regularization of leaf values");
+	SG_ADD(&m_min_split_gain, kMinSplitGain, "min gain of a split");
+	SG_ADD(
+	    &m_feature_fraction, kFeatureFraction,
+	    "fraction of features considered by each tree");
+	SG_ADD(
+	    &m_base_score, "base_score", "initial prediction",
+	    ParameterProperties::MODEL);
+	SG_ADD(
+	    &m_tree_roots, "tree_roots", "first node of each tree",
+	    ParameterProperties::MODEL);
+	SG_ADD(
+	    &m_split_feature, "split_feature", "split feature of each node",
+	    ParameterProperties::MODEL);
+	SG_ADD(
+	    &m_split_threshold, "split_threshold", "split threshold of each node",
+	    ParameterProperties::MODEL);
+	SG_ADD(
+	    &m_left_child, "left_child", "left child of each node",
+	    ParameterProperties::MODEL);
+	SG_ADD(
+	    &m_right_child, "right_child", "right child of each node",
+	    ParameterProperties::MODEL);
+	SG_ADD(
+	    &m_leaf_value, "leaf_value", "output of each leaf",
+	    ParameterProperties::MODEL);
+}
+
+std::vector<SGVector<float64_t>>
+HistogramGBMachine::compute_bin_edges(const SGMatrix<float64_t>& mat) const
+{
+	const index_t num_feats = mat.num_rows;
+	const index_t num_vecs = mat.num_cols;
+	std::vector<SGVector<float64_t>> edges(num_feats);
+
+#pragma omp parallel for schedule(dynamic)
+	for (index_t f = 0; f < num_feats; ++f)
+	{
+		std::vector<float64_t> values(num_vecs);
+		for (index_t i = 0; i < num_vecs; ++i)
+			values[i] = mat(f, i);
+		std::sort(values.begin(), values.end());
+
+		std::vector<float64_t> cuts;
+		auto unique = values;
+		unique.erase(std::unique(unique.begin(), unique.end()), unique.end());
+		if (unique.size() <= (size_t)m_max_bins)
+		{
+			// one bin per value
+			for (size_t j = 0; j + 1 < unique.size(); ++j)
+				cuts.push_back((unique[j] + unique[j + 1]) / 2);
+		}
+		else
+		{
+			// quantiles, values equal to a cut go to the lower bin
+			for (int32_t b = 1; b < m_max_bins; ++b)
+			{
+				auto cut = values[int64_t(b) * num_vecs / m_max_bins];
+				if (cut < values.back() && (cuts.empty() || cut > cuts.back()))
+					cuts.push_back(cut);
+			}
+		}
+		cuts.push_back(std::numeric_limits<float64_t>::infinity());
+
+		edges[f] = SGVector<float64_t>(cuts.size());
+		std::copy(cuts.begin(), cuts.end(), edges[f].begin());
+	}
+	return edges;
+}
+
+std::vector<uint8_t> HistogramGBMachine::bin_features(
+    const SGMatrix<float64_t>& mat,
+    const std::vector<SGVector<float64_t>>& edges) const
+{
+	const index_t num_feats = mat.num_rows;
+	const index_t num_vecs = mat.num_cols;
+	std::vector<uint8_t> bins(int64_t(num_feats) * num_vecs);
+
+#pragma omp parallel for
+	for (index_t i = 0; i < num_vecs; ++i)
+	{
+		for (index_t f = 0; f < num_feats; ++f)
+		{
+			const auto& e = edges[f];
+			bins[int64_t(f) * num_vecs + i] =
+			    std::lower_bound(e.begin(), e.end(), mat(f, i)) - e.begin();
+		}
+	}
+	return bins;
+}
+
+bool HistogramGBMachine::train_machine(std::shared_ptr<Features> data)
+{
+	require(data, "training data not supplied!");
+	require(m_loss, "loss function not specified");
+	require(m_labels, "labels not specified");
+	require(
+	    m_max_bins >= 2 && m_max_bins <= 256,
+	    "max_bins should lie between 2 and 256. Supplied value is {}",
+	    m_max_bins);
+	require(
+	    m_max_leaves >= 2, "max_leaves should be at least 2. Supplied value "
+	                       "is {}",
+	    m_max_leaves);
+	require(
+	    m_min_samples_leaf >= 1,
+	    "min_samples_leaf should be at least 1. Supplied value is {}",
+	    m_min_samples_leaf);
+	require(
+	    m_feature_fraction > 0 && m_feature_fraction <= 1,
+	    "feature fraction should lie between 0 and 1. Supplied value is {}",
+	    m_feature_fraction);
+
+	auto mat = data->as<DenseFeatures<float64_t>>()->get_feature_matrix();
+	auto labels = m_labels->as<DenseLabels>()->get_labels();
+	const index_t num_feats = mat.num_rows;
+	const index_t num_vecs = mat.num_cols;
+	require(
+	    labels.vlen == num_vecs,
+	    "Number of labels ({}) does not match number of vectors ({})",
+	    labels.vlen, num_vecs);
+
+	initialize_learners();
+
+	auto edges = compute_bin_edges(mat);
+	auto bins = bin_features(mat, edges);
+
+	SGVector<float64_t> f(num_vecs), g(num_vecs), h(num_vecs);
+	auto compute_gradients = [&]() {
+#pragma omp parallel for
+		for (index_t i = 0; i < num_vecs; ++i)
+		{
+			g[i] = m_loss->first_derivative(f[i], labels[i]);
+			h[i] = m_loss->second_derivative(f[i], labels[i]);
+			// losses without curvature take gradient steps
+			if (!(h[i] > 0))
+				h[i] = 1;
+		}
+	};
+
+	// start from the Newton step of a constant model
+	f.zero();
+	compute_gradients();
+	m_base_score = -linalg::sum(g) / linalg::sum(h);
+	f.set_const(m_base_score);
+
+	Nodes nodes;
+	std::vector<int32_t> roots;
+	for (auto i : SG_PROGRESS(range(m_num_iter)))
+	{
+		compute_gradients();
+
+		auto rows = sample_indices(num_vecs, m_subset_frac, m_prng);
+		auto features = sample_indices(num_feats, m_feature_fraction, m_prng);
+
+		TreeBuilder builder(
+		    bins, edges, num_vecs, m_max_bins, g, h, std::move(features),
+		    m_max_leaves, m_max_depth, m_min_samples_leaf,
+		    m_l2_regularization, m_min_split_gain, m_learning_rate);
+		auto root = builder.grow(std::move(rows), nodes);
+		roots.push_back(root);
+
+		// update predictions of all vectors, sampled or not
+#pragma omp parallel for
+		for (index_t j = 0; j < num_vecs; ++j)
+		{
+			auto node = root;
+			while (nodes.feature[node] >= 0)
+			{
+				auto bin = bins[int64_t(nodes.feature[node]) * num_vecs + j];
+				node = bin <= nodes.bin[node] ? nodes.left[node]
+				                              : nodes.right[node];
+			}
+			f[j] += nodes.value[node];
+		}
+	}
+
+	auto to_sgvector = [](const auto& vec) {
+		SGVector<typename std::decay_t<decltype(vec)>::value_type> result(
+		    vec.size());
+		std::copy(vec.begin(), vec.end(), result.begin());
+		return result;
+	};
+	m_tree_roots = to_sgvector(roots);
+	m_split_feature = to_sgvector(nodes.feature);
+	m_split_threshold = to_sgvector(nodes.threshold);
+	m_left_child = to_sgvector(nodes.left);
+	m_right_child = to_sgvector(nodes.right);
+	m_leaf_value = to_sgvector(nodes.value);
+
+	return true;
+}
+
+std::shared_ptr<RegressionLabels>
+HistogramGBMachine::apply_regression(std::shared_ptr<Features> data)
+{
+	require(data, "test data supplied is NULL");
+	auto mat = data->as<DenseFeatures<float64_t>>()->get_feature_matrix();
+
+	auto num_feats = std::max_element(
+	    m_split_feature.begin(), m_split_feature.end(),
+	    [](int32_t a, int32_t b) { return a < b; });
+	require(
+	    num_feats == m_split_feature.end() || *num_feats < mat.num_rows,
+	    "Trees use feature {} but the data has only {} features",
+	    num_feats == m_split_feature.end() ? 0 : *num_feats, mat.num_rows);
+
+	SGVector<float64_t> result(mat.num_cols);
+#pragma omp parallel for
+	for (index_t i = 0; i < mat.num_cols; ++i)
+	{
+		auto x = mat.get_column_vector(i);
+		float64_t sum = m_base_score;
+		for (auto root : m_tree_roots)
+		{
+			auto node = root;
+			while (m_split_feature[node] >= 0)
+			{
+				node = x[m_split_feature[node]] <= m_split_threshold[node]
+				           ? m_left_child[node]
+				           : m_right_child[node];
+			}
+			sum += m_leaf_value[node];
+		}
+		result[i] = sum;
+	}
+
+	return std::make_shared<RegressionLabels>(result);
+}
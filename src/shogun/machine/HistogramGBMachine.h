@@ -0,0 +1,164 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef _HISTOGRAMGBMACHINE_H__
+#define _HISTOGRAMGBMACHINE_H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/machine/StochasticGBMachine.h>
+
+#include <vector>
+
+namespace shogun
+{
+/** @brief Gradient boosting with histogram based regression trees.
+ *
+ * Instead of fitting a general base machine on the pseudo residuals of
+ * every stage, as StochasticGBMachine does, this machine grows its own
+ * trees on features that are discretised once into at most max_bins
+ * quantile bins:
+ *  - split search of a node scans per-feature histograms of gradient and
+ *    hessian sums, which are built in parallel over features, and the
+ *    larger child's histogram is obtained by subtracting the smaller
+ *    child's from its parent.
+ *  - trees grow leaf-wise, always splitting the leaf with the largest
+ *    gain, up to max_leaves leaves.
+ *  - leaves take the Newton step \f$-\sum g / (\sum h + \lambda)\f$ of the
+ *    loss function, scaled by the learning rate. Losses without curvature
+ *    use unit hessians.
+ *  - every stage uses a random fraction subset_fraction of the vectors
+ *    and every tree a random fraction feature_fraction of the features.
+ *
+ * The StochasticGBMachine API (loss function, number of iterations,
+ * learning rate, subset fraction) is kept; no base machine is needed.
+ *
+ * Ke, G., et al. (2017). LightGBM: A highly efficient gradient boosting
+ * decision tree. NIPS.
+ */
+class HistogramGBMachine : public StochasticGBMachine
+{
+public:
+	/** Constructor
+	 *
+	 * @param loss loss function
+	 * @param num_iterations number of iterations of boosting
+	 * @param learning_rate shrinkage factor
+	 * @param subset_fraction fraction of training vectors to be chosen
+	 * randomly w/o replacement in each iteration
+	 */
+	HistogramGBMachine(
+	    const std::shared_ptr<LossFunction>& loss = NULL,
+	    int32_t num_iterations = 100, float64_t learning_rate = 0.1,
+	    float64_t subset_fraction = 1.0);
+
+	/** Destructor */
+	~HistogramGBMachine() override;
+
+	/** get name
+	 *
+	 * @return HistogramGBMachine
+	 */
+	const char* get_name() const override
+	{
+		return "HistogramGBMachine";
+	}
+
+	/** apply_regression
+	 *
+	 * @param data test data
+	 * @return Regression labels
+	 */
+	std::shared_ptr<RegressionLabels>
+	apply_regression(std::shared_ptr<Features> data = NULL) override;
+
+	/** @return number of nodes of all trees */
+	index_t get_num_nodes() const
+	{
+		return m_split_feature.vlen;
+	}
+
+protected:
+	/** train machine
+	 *
+	 * @param data training data
+	 * @return true
+	 */
+	bool train_machine(std::shared_ptr<Features> data = NULL) override;
+
+	/** Computes the upper edges of the quantile bins of each feature.
+	 *
+	 * @param mat training data
+	 * @return bin edges of each feature, the last one is infinity
+	 */
+	std::vector<SGVector<float64_t>>
+	compute_bin_edges(const SGMatrix<float64_t>& mat) const;
+
+	/** @return bin of each feature value, stored feature by feature */
+	std::vector<uint8_t> bin_features(
+	    const SGMatrix<float64_t>& mat,
+	    const std::vector<SGVector<float64_t>>& edges) const;
+
+private:
+	void init();
+
+protected:
+	/** max number of bins per feature, at most 256 */
+	int32_t m_max_bins;
+
+	/** max number of leaves per tree */
+	int32_t m_max_leaves;
+
+	/** max depth of trees, 0 for no limit */
+	int32_t m_max_depth;
+
+	/** min number of vectors in a leaf */
+	int32_t m_min_samples_leaf;
+
+	/** L2 regularization of leaf values */
+	float64_t m_l2_regularization;
+
+	/** min gain of a split */
+	float64_t m_min_split_gain;
+
+	/** fraction of features considered by each tree */
+	float64_t m_feature_fraction;
+
+	/** initial prediction */
+	float64_t m_base_score;
+
+	/** first node of each tree */
+	SGVector<int32_t> m_tree_roots;
+
+	/** split feature of each node, -1 for leaves */
+	SGVector<int32_t> m_split_feature;
+
+	/** split threshold of each node, values up to it go left */
+	SGVector<float64_t> m_split_threshold;
+
+	/** left child of each node */
+	SGVector<int32_t> m_left_child;
+
+	/** right child of each node */
+	SGVector<int32_t> m_right_child;
+
+	/** output of each leaf */
+	SGVector<float64_t> m_leaf_value;
+
+#ifndef SWIG
+public:
+	static constexpr std::string_view kMaxBins = "max_bins";
+	static constexpr std::string_view kMaxLeaves = "max_leaves";
+	static constexpr std::string_view kMaxDepth = "max_depth";
+	static constexpr std::string_view kMinSamplesLeaf = "min_samples_leaf";
+	static constexpr std::string_view kL2Regularization = "l2_regularization";
+	static constexpr std::string_view kMinSplitGain = "min_split_gain";
+	static constexpr std::string_view kFeatureFraction = "feature_fraction";
+#endif
+};
+} // namespace shogun
+
+#endif /* _HISTOGRAMGBMACHINE_H__ */
@@ -14,6 +14,8 @@
 #include <shogun/labels/Labels.h>
 #include <shogun/labels/RegressionLabels.h>
 #include <shogun/machine/KernelMachine.h>
+#include <shogun/mathematics/eigen3.h>
+#include <algorithm>
 #include <utility>
 
 #ifdef HAVE_OPENMP
@@ -330,6 +332,18 @@ SGVector<float64_t> KernelMachine::apply_get_outputs(const std::shared_ptr<Featu
 		else
 		{
 			auto pb = SG_PROGRESS(range(num_vectors));
+			ASSERT(kernel)
+			const bool linadd = kernel->has_property(KP_LINADD) &&
+			                    kernel->get_is_initialized();
+
+			SGVector<index_t> sv_idx(get_num_support_vectors());
+			SGVector<float64_t> alphas(get_num_support_vectors());
+			for (index_t i = 0; i < sv_idx.vlen; i++)
+			{
+				sv_idx[i] = get_support_vector(i);
+				alphas[i] = get_alpha(i);
+			}
+
 			int32_t num_threads;
 			int64_t step;
 #pragma omp parallel shared(num_threads, step)
@@ -353,27 +367,24 @@ SGVector<float64_t> KernelMachine::apply_get_outputs(const std::shared_ptr<Featu
 				                  ? num_vectors
 				                  : (thread_num + 1) * step;
 
-				for (int32_t vec = start; vec < end; vec++)
+				for (int32_t vec = start; vec < end; vec += vector_tile_size)
 				{
 					COMPUTATION_CONTROLLERS
-					pb.print_progress();
+					int32_t tile_end = std::min(vec + vector_tile_size, end);
 
-					ASSERT(kernel)
-					if (kernel->has_property(KP_LINADD) &&
-					    (kernel->get_is_initialized()))
+					if (linadd)
 					{
-						float64_t score = kernel->compute_optimized(vec);
-						output[vec] = score + get_bias();
+						for (int32_t i = vec; i < tile_end; i++)
+						{
+							float64_t score = kernel->compute_optimized(i);
+							output[i] = score + get_bias();
+						}
 					}
 					else
-					{
-						float64_t score = 0;
-						for (int32_t i = 0; i < get_num_support_vectors(); i++)
-							score +=
-							    kernel->kernel(get_support_vector(i), vec) *
-							    get_alpha(i);
-						output[vec] = score + get_bias();
-					}
+						compute_outputs_block(vec, tile_end, sv_idx, alphas, output);
+
+					for (int32_t i = vec; i < tile_end; i++)
+						pb.print_progress();
 				}
 			}
 			pb.complete();
@@ -386,6 +397,37 @@ SGVector<float64_t> KernelMachine::apply_get_outputs(const std::shared_ptr<Featu
 	return output;
 }
 
+void KernelMachine::compute_outputs_block(
+	index_t begin, index_t end, const SGVector<index_t>& sv_idx,
+	const SGVector<float64_t>& alphas, SGVector<float64_t>& output)
+{
+	SGVector<index_t> vec_idx(end - begin);
+	vec_idx.range_fill(begin);
+
+	Eigen::VectorXd scores = Eigen::VectorXd::Zero(vec_idx.vlen);
+	SGMatrix<float64_t> buffer(
+	    std::min(support_vector_tile_size, sv_idx.vlen), vec_idx.vlen);
+
+	for (index_t sv_begin = 0; sv_begin < sv_idx.vlen;
+	     sv_begin += support_vector_tile_size)
+	{
+		auto num_svs =
+		    std::min(support_vector_tile_size, sv_idx.vlen - sv_begin);
+		SGVector<index_t> tile_idx(sv_idx.vector + sv_begin, num_svs, false);
+		SGMatrix<float64_t> block(buffer.matrix, num_svs, vec_idx.vlen, false);
+		kernel->compute_kernel_block(tile_idx, vec_idx, block);
+
+		Eigen::Map<Eigen::MatrixXd> block_eigen(
+		    block.matrix, num_svs, vec_idx.vlen);
+		Eigen::Map<Eigen::VectorXd> alphas_eigen(
+		    alphas.vector + sv_begin, num_svs);
+		scores.noalias() += block_eigen.transpose() * alphas_eigen;
+	}
+
+	for (index_t i = 0; i < vec_idx.vlen; i++)
+		output[begin + i] = scores[i] + get_bias();
+}
+
 void KernelMachine::store_model_features()
 {
 	if (!kernel)
@@ -229,6 +229,16 @@ class KernelMachine : public Machine
 		 */
 		virtual void store_model_features();
 
+		/** number of test vectors that are evaluated together when the
+		 * kernel has no linadd optimization
+		 */
+		static constexpr int32_t vector_tile_size = 256;
+
+		/** number of support vectors that are evaluated together when the
+		 * kernel has no linadd optimization
+		 */
+		static constexpr index_t support_vector_tile_size = 1024;
+
 	protected:
 
 		/** apply get outputs
@@ -238,6 +248,18 @@ class KernelMachine : public Machine
 		 */
 		SGVector<float64_t> apply_get_outputs(const std::shared_ptr<Features>& data);
 
+		/** computes the outputs of the vectors [begin, end) of the kernel's
+		 * rhs in tiles of support vectors, using Kernel::compute_kernel_block
+		 *
+		 * @param begin first vector
+		 * @param end one past the last vector
+		 * @param sv_idx support vector indices
+		 * @param alphas support vector weights
+		 * @param output outputs of all vectors
+		 */
+		void compute_outputs_block(
+			index_t begin, index_t end, const SGVector<index_t>& sv_idx,
+			const SGVector<float64_t>& alphas, SGVector<float64_t>& output);
 
 	private:
 		/** register parameters and do misc init */
@@ -8,8 +8,11 @@
 #include <shogun/machine/KernelMulticlassMachine.h>
 #include <shogun/features/Features.h>
 #include <shogun/kernel/Kernel.h>
+#include <shogun/lib/ScopeGuard.h>
+#include <shogun/lib/View.h>
 #include <shogun/machine/KernelMachine.h>
 
+#include <algorithm>
 #include <unordered_set>
 #include <utility>
 
@@ -73,6 +76,113 @@ void KernelMulticlassMachine::store_model_features()
 	}
 }
 
+SGMatrix<float64_t> KernelMulticlassMachine::get_submachine_outputs_matrix(int32_t num_vectors)
+{
+	int32_t num_machines=m_machines.size();
+
+	// sharing kernel values requires all machines to evaluate the same kernel
+	std::vector<std::shared_ptr<KernelMachine>> machines;
+	for (const auto& m: m_machines)
+	{
+		auto machine=std::dynamic_pointer_cast<KernelMachine>(m);
+		if (!machine || machine->get_kernel()!=m_kernel)
+			return MulticlassMachine::get_submachine_outputs_matrix(num_vectors);
+		machines.push_back(machine);
+	}
+	if (m_kernel->has_property(KP_LINADD) && m_kernel->get_is_initialized())
+		return MulticlassMachine::get_submachine_outputs_matrix(num_vectors);
+
+	// union of the support vectors of all machines
+	std::vector<index_t> all_sv;
+	for (const auto& machine: machines)
+	{
+		for (int32_t j=0; j<machine->get_num_support_vectors(); ++j)
+			all_sv.push_back(machine->get_support_vector(j));
+	}
+	std::sort(all_sv.begin(), all_sv.end());
+	all_sv.erase(std::unique(all_sv.begin(), all_sv.end()), all_sv.end());
+	SGVector<index_t> sv_idx(all_sv.size());
+	std::copy(all_sv.begin(), all_sv.end(), sv_idx.begin());
+
+	// coefficients of each machine, by position of the SV in the union
+	std::vector<index_t> offsets(num_machines+1, 0);
+	std::vector<std::pair<index_t, float64_t>> coefficients;
+	for (int32_t m=0; m<num_machines; ++m)
+	{
+		const auto& machine=machines[m];
+		for (int32_t j=0; j<machine->get_num_support_vectors(); ++j)
+		{
+			auto position=std::lower_bound(all_sv.begin(), all_sv.end(),
+					machine->get_support_vector(j))-all_sv.begin();
+			coefficients.emplace_back(position, machine->get_alpha(j));
+		}
+		std::sort(coefficients.begin()+offsets[m], coefficients.end());
+		offsets[m+1]=coefficients.size();
+	}
+
+	SGMatrix<float64_t> outputs(num_machines, num_vectors);
+	for (int32_t i=0; i<num_vectors; ++i)
+	{
+		for (int32_t m=0; m<num_machines; ++m)
+			outputs(m, i)=machines[m]->get_bias();
+	}
+
+#pragma omp parallel
+	{
+		SGMatrix<float64_t> buffer(
+			std::min(KernelMachine::support_vector_tile_size, sv_idx.vlen),
+			KernelMachine::vector_tile_size);
+		std::vector<index_t> cursor(num_machines);
+		std::vector<index_t> tile_end(num_machines);
+
+#pragma omp for schedule(dynamic)
+		for (int32_t vec=0; vec<num_vectors; vec+=KernelMachine::vector_tile_size)
+		{
+			int32_t num_vecs=std::min(KernelMachine::vector_tile_size, num_vectors-vec);
+			SGVector<index_t> vec_idx(num_vecs);
+			vec_idx.range_fill(vec);
+			std::copy(offsets.begin(), offsets.end()-1, cursor.begin());
+
+			for (index_t sv_begin=0; sv_begin<sv_idx.vlen;
+					sv_begin+=KernelMachine::support_vector_tile_size)
+			{
+				auto num_svs=std::min(
+					KernelMachine::support_vector_tile_size, sv_idx.vlen-sv_begin);
+				SGVector<index_t> tile_idx(sv_idx.vector+sv_begin, num_svs, false);
+				SGMatrix<float64_t> block(buffer.matrix, num_svs, num_vecs, false);
+				m_kernel->compute_kernel_block(tile_idx, vec_idx, block);
+
+				for (int32_t m=0; m<num_machines; ++m)
+				{
+					tile_end[m]=cursor[m];
+					while (tile_end[m]<offsets[m+1] &&
+							coefficients[tile_end[m]].first<sv_begin+num_svs)
+						++tile_end[m];
+				}
+
+				for (int32_t i=0; i<num_vecs; ++i)
+				{
+					auto kernel_values=block.get_column_vector(i);
+					auto output=outputs.get_column_vector(vec+i);
+					for (int32_t m=0; m<num_machines; ++m)
+					{
+						float64_t sum=0;
+						for (index_t k=cursor[m]; k<tile_end[m]; ++k)
+						{
+							sum+=coefficients[k].second*
+								kernel_values[coefficients[k].first-sv_begin];
+						}
+						output[m]+=sum;
+					}
+				}
+				std::copy(tile_end.begin(), tile_end.end(), cursor.begin());
+			}
+		}
+	}
+
+	return outputs;
+}
+
 KernelMulticlassMachine::KernelMulticlassMachine() : MulticlassMachine(), m_kernel(NULL)
 {
 	SG_ADD(&m_kernel,"kernel", "The kernel to be used", ParameterProperties::HYPER);
@@ -163,6 +273,70 @@ int32_t KernelMulticlassMachine::get_num_rhs_vectors() const
 	return m_kernel->get_num_vec_rhs();
 }
 
+bool KernelMulticlassMachine::supports_parallel_training() const
+{
+	// custom and combined kernels do not index their data via features
+	return m_kernel && m_kernel->get_kernel_type() != K_CUSTOM &&
+	       m_kernel->get_kernel_type() != K_COMBINED;
+}
+
+std::vector<std::shared_ptr<Machine>>
+KernelMulticlassMachine::get_machines_for_tasks(
+    const std::vector<MulticlassStrategy::TrainTask>& tasks)
+{
+	auto lhs = m_kernel->get_lhs();
+	auto rhs = m_kernel->get_rhs();
+	require(lhs && rhs, "{}: kernel is not initialized", get_name());
+
+	// clone machine and kernel without the features, the guard restores
+	// both also when cloning or initializing a task kernel throws
+	auto kernel_machine = m_machine->as<KernelMachine>();
+	auto restore = make_scope_guard([&]() {
+		if (!m_kernel->get_lhs() || !m_kernel->get_rhs())
+			m_kernel->init(lhs, rhs);
+		kernel_machine->set_kernel(m_kernel);
+	});
+	kernel_machine->set_kernel(nullptr);
+	m_kernel->remove_lhs_and_rhs();
+	auto prototype = make_clone(m_kernel);
+	m_kernel->init(lhs, rhs);
+
+	std::vector<std::shared_ptr<Machine>> machines;
+	for (const auto& task : tasks)
+	{
+		auto features_lhs = task.subset.vlen ? view(lhs, task.subset)
+		                                     : lhs->duplicate();
+		auto features_rhs = lhs == rhs
+		                        ? features_lhs
+		                        : task.subset.vlen ? view(rhs, task.subset)
+		                                           : rhs->duplicate();
+		auto kernel = make_clone(prototype);
+		kernel->init(features_lhs, features_rhs);
+
+		auto machine = make_clone(kernel_machine);
+		machine->set_kernel(kernel);
+		machine->set_labels(task.labels);
+		machines.push_back(machine);
+	}
+
+	return machines;
+}
+
+std::shared_ptr<Machine> KernelMulticlassMachine::get_machine_from_task(
+    const std::shared_ptr<Machine>& machine,
+    const MulticlassStrategy::TrainTask& task) const
+{
+	auto result = get_machine_from_trained(machine)->as<KernelMachine>();
+	if (task.subset.vlen)
+	{
+		for (int32_t j = 0; j < result->get_num_support_vectors(); ++j)
+			result->set_support_vector(
+			    j, task.subset[result->get_support_vector(j)]);
+	}
+	result->set_kernel(m_kernel);
+	return result;
+}
+
 void KernelMulticlassMachine::add_machine_subset(SGVector<index_t> subset)
 {
 	not_implemented(SOURCE_LOCATION);
@@ -63,6 +63,14 @@ class KernelMulticlassMachine : public MulticlassMachine
 		 */
 		virtual void store_model_features();
 
+		/** get outputs of all submachines for all vectors. Kernel values
+		 * are computed once per support vector shared by the submachines.
+		 *
+		 * @param num_vectors number of vectors
+		 * @return outputs, one row per submachine and one column per vector
+		 */
+		SGMatrix<float64_t> get_submachine_outputs_matrix(int32_t num_vectors) override;
+
 	protected:
 
 		/** init machine for training with kernel init */
@@ -80,6 +88,22 @@ class KernelMulticlassMachine : public MulticlassMachine
 		/** return number of rhs feature vectors */
 		int32_t get_num_rhs_vectors() const override;
 
+		/** whether the kernel can be cloned onto feature views */
+		bool supports_parallel_training() const override;
+
+		/** copies of the base machine, each with a kernel on views of the
+		 * features
+		 */
+		std::vector<std::shared_ptr<Machine>> get_machines_for_tasks(
+		    const std::vector<MulticlassStrategy::TrainTask>& tasks) override;
+
+		/** construct kernel machine on the full kernel from one trained on
+		 * a task, support vectors are mapped back from the task's subset
+		 */
+		std::shared_ptr<Machine> get_machine_from_task(
+		    const std::shared_ptr<Machine>& machine,
+		    const MulticlassStrategy::TrainTask& task) const override;
+
 		/** set subset to the features of the machine, deletes old one
 		 *
 		 * @param subset subset indices to set
@@ -0,0 +1,61 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/machine/LinearMulticlassMachine.h>
+#include <shogun/mathematics/linalg/LinalgNamespace.h>
+
+using namespace shogun;
+
+SGMatrix<float64_t> LinearMulticlassMachine::get_submachine_outputs_matrix(int32_t num_vectors)
+{
+	require(m_features, "{}: no features set", get_name());
+	require(m_features->get_num_vectors()==num_vectors,
+			"Number of vectors ({}) does not match number of features ({})",
+			num_vectors, m_features->get_num_vectors());
+
+	int32_t num_machines=m_machines.size();
+	int32_t dim=m_features->get_dim_feature_space();
+
+	// weight vectors of all machines as columns of one matrix
+	SGMatrix<float64_t> weights(dim, num_machines);
+	SGVector<float64_t> biases(num_machines);
+	for (int32_t m=0; m<num_machines; ++m)
+	{
+		auto machine=m_machines[m]->as<LinearMachine>();
+		auto w=machine->get_w();
+		// machines that do not act on the full feature space
+		if (w.vlen!=dim)
+			return MulticlassMachine::get_submachine_outputs_matrix(num_vectors);
+
+		sg_memcpy(weights.get_column_vector(m), w.vector, sizeof(float64_t)*dim);
+		biases[m]=machine->get_bias();
+	}
+
+	SGMatrix<float64_t> outputs(num_machines, num_vectors);
+	if (auto dense=std::dynamic_pointer_cast<DenseFeatures<float64_t>>(m_features))
+	{
+		linalg::matrix_prod(weights, dense->get_feature_matrix(), outputs, true, false);
+	}
+	else
+	{
+#pragma omp parallel for
+		for (int32_t i=0; i<num_vectors; ++i)
+		{
+			for (int32_t m=0; m<num_machines; ++m)
+			{
+				SGVector<float64_t> w(weights.get_column_vector(m), dim, false);
+				outputs(m, i)=m_features->dot(i, w);
+			}
+		}
+	}
+
+	for (int32_t i=0; i<num_vectors; ++i)
+	{
+		for (int32_t m=0; m<num_machines; ++m)
+			outputs(m, i)+=biases[m];
+	}
+
+	return outputs;
+}
@@ -13,6 +13,8 @@
 
 #include <shogun/lib/common.h>
 #include <shogun/features/DotFeatures.h>
+#include <shogun/lib/ScopeGuard.h>
+#include <shogun/lib/View.h>
 #include <shogun/machine/LinearMachine.h>
 #include <shogun/machine/MulticlassMachine.h>
 
@@ -80,6 +82,14 @@ class LinearMulticlassMachine : public MulticlassMachine
 			return m_features;
 		}
 
+		/** get outputs of all submachines for all vectors, computed as one
+		 * product of the stacked weight vectors with the features
+		 *
+		 * @param num_vectors number of vectors
+		 * @return outputs, one row per submachine and one column per vector
+		 */
+		SGMatrix<float64_t> get_submachine_outputs_matrix(int32_t num_vectors) override;
+
 	protected:
 
 		/** init machine for train with setting features */
@@ -134,6 +144,39 @@ class LinearMulticlassMachine : public MulticlassMachine
 			return m_features->get_num_vectors();
 		}
 
+		/** linear machines are trained on their own feature views */
+		bool supports_parallel_training() const override
+		{
+			return true;
+		}
+
+		/** copies of the base machine, each on a view of the features */
+		std::vector<std::shared_ptr<Machine>> get_machines_for_tasks(
+		    const std::vector<MulticlassStrategy::TrainTask>& tasks) override
+		{
+			// the features are not cloned along with the machine, the guard
+			// restores them also when cloning or viewing throws
+			auto linear = m_machine->as<LinearMachine>();
+			auto restore = make_scope_guard(
+			    [&]() { linear->set_features(m_features); });
+			linear->set_features(nullptr);
+
+			std::vector<std::shared_ptr<Machine>> machines;
+			for (const auto& task : tasks)
+			{
+				auto machine = make_clone(linear);
+				if (task.subset.vlen)
+					machine->set_features(view(m_features, task.subset));
+				else
+					machine->set_features(
+					    m_features->duplicate()->as<DotFeatures>());
+				machine->set_labels(task.labels);
+				machines.push_back(machine);
+			}
+
+			return machines;
+		}
+
 		/** set subset to the features of the machine, deletes old one
 		 *
 		 * @param subset subset instance to set
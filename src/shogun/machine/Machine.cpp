@@ -41,6 +41,10 @@ bool Machine::train(std::shared_ptr<Features> data)
 		m_labels->ensure_valid(get_name());
 	}
 
+	/* gather subset views once instead of on every access */
+	if (data && train_prefers_contiguous_features())
+		data = data->materialize_subset();
+
 	auto sub = connect_to_signal_handler();
 	bool result = false;
 
@@ -237,6 +237,29 @@ class Machine : public StoppableSGObject
 			return true;
 		}
 
+		/** returns whether machine accesses training vectors repeatedly,
+		 * such that train materializes subsets of the features first
+		 */
+		virtual bool train_prefers_contiguous_features() const
+		{
+			return false;
+		}
+
+		/** Continue Training
+		 *
+		 * This method can be used to continue a prematurely stopped
+		 * call to Machine::train.
+		 * This is available for Iterative models and throws an error
+		 * if the feature is not supported. 
+		 *
+		 * @return whether training was successful
+		 */
+		virtual bool continue_train()
+		{
+			error("Training continuation not supported by this model.");
+			return false;
+		}
+
 	protected:
 		/** train machine
 		 *
@@ -282,21 +305,6 @@ class Machine : public StoppableSGObject
 			return false;
 		}
 
-		/** Continue Training
-		 *
-		 * This method can be used to continue a prematurely stopped
-		 * call to Machine::train.
-		 * This is available for Iterative models and throws an error
-		 * if the feature is not supported. 
-		 *
-		 * @return whether training was successful
-		 */
-		virtual bool continue_train()
-		{
-			error("Training continuation not supported by this model.");
-			return false;
-		}
-
 		/** check whether the labels is valid.
 		 *
 		 * Subclasses can override this to implement their check of label types.
@@ -14,6 +14,9 @@
 #include <shogun/mathematics/Statistics.h>
 #include <shogun/labels/MultilabelLabels.h>
 
+#include <algorithm>
+#include <exception>
+#include <numeric>
 #include <utility>
 
 using namespace shogun;
@@ -49,6 +52,9 @@ void MulticlassMachine::register_parameters()
 {
 	SG_ADD(&m_multiclass_strategy,"multiclass_strategy", "Multiclass strategy");
 	SG_ADD(&m_machine, "machine", "The base machine");
+	SG_ADD(
+	    &m_parallel_training, "parallel_training",
+	    "Whether machines are trained concurrently");
 }
 
 void MulticlassMachine::init_strategy()
@@ -71,6 +77,22 @@ float64_t MulticlassMachine::get_submachine_output(int32_t i, int32_t num)
 	return machine->apply_one(num);
 }
 
+SGMatrix<float64_t> MulticlassMachine::get_submachine_outputs_matrix(int32_t num_vectors)
+{
+	int32_t num_machines=m_machines.size();
+	SGMatrix<float64_t> outputs(num_machines, num_vectors);
+	for (int32_t i=0; i<num_machines; ++i)
+	{
+		auto values = get_submachine_outputs(i)->get_values();
+		require(values.vlen==num_vectors,
+				"Machine {} has {} outputs, expected {}", i, values.vlen, num_vectors);
+		for (int32_t j=0; j<num_vectors; j++)
+			outputs(i, j) = values[j];
+	}
+
+	return outputs;
+}
+
 std::shared_ptr<MulticlassLabels> MulticlassMachine::apply_multiclass(std::shared_ptr<Features> data)
 {
 	SG_TRACE("entering {}::apply_multiclass({} at {})",
@@ -99,64 +121,59 @@ std::shared_ptr<MulticlassLabels> MulticlassMachine::apply_multiclass(std::share
 		int32_t num_classes=m_multiclass_strategy->get_num_classes();
 		EProbHeuristicType heuris = get_prob_heuris();
 
-		if (heuris!=PROB_HEURIS_NONE)
-			result->allocate_confidences_for(num_classes);
-		else
-			result->allocate_confidences_for(num_machines);
-
-		std::vector<std::shared_ptr<BinaryLabels>> outputs(num_machines);
-		SGVector<float64_t> As(num_machines);
-		SGVector<float64_t> Bs(num_machines);
-
-		for (int32_t i=0; i<num_machines; ++i)
-		{
-			outputs[i] = get_submachine_outputs(i);
-
-			if (heuris==OVA_SOFTMAX)
-			{
-				Statistics::SigmoidParamters params = Statistics::fit_sigmoid(outputs[i]->get_values());
-				As[i] = params.a;
-				Bs[i] = params.b;
-			}
-
-			if (heuris!=PROB_HEURIS_NONE && heuris!=OVA_SOFTMAX)
-				outputs[i]->scores_to_probabilities(0,0);
-		}
+		auto outputs = get_submachine_outputs_matrix(num_vectors);
+		auto confidences = outputs;
 
-		SGVector<float64_t> output_for_i(num_machines);
-		SGVector<float64_t> r_output_for_i(num_machines);
 		if (heuris!=PROB_HEURIS_NONE)
-			r_output_for_i.resize_vector(num_classes);
-
-		for (int32_t i=0; i<num_vectors; i++)
 		{
-			for (int32_t j=0; j<num_machines; j++)
-				output_for_i[j] = outputs[j]->get_value(i);
+			SGVector<float64_t> As(num_machines);
+			SGVector<float64_t> Bs(num_machines);
 
-			if (heuris==PROB_HEURIS_NONE)
+			for (int32_t i=0; i<num_machines; ++i)
 			{
-				r_output_for_i = output_for_i;
+				auto values = outputs.get_row_vector(i);
+				if (heuris==OVA_SOFTMAX)
+				{
+					Statistics::SigmoidParamters params = Statistics::fit_sigmoid(values);
+					As[i] = params.a;
+					Bs[i] = params.b;
+				}
+				else
+				{
+					auto machine_outputs = std::make_shared<BinaryLabels>(values);
+					machine_outputs->scores_to_probabilities(0,0);
+					values = machine_outputs->get_values();
+					for (int32_t j=0; j<num_vectors; j++)
+						outputs(i, j) = values[j];
+				}
 			}
-			else
+
+			confidences = SGMatrix<float64_t>(num_classes, num_vectors);
+			SGVector<float64_t> output_for_i(num_machines);
+			for (int32_t i=0; i<num_vectors; i++)
 			{
+				sg_memcpy(output_for_i.vector, outputs.get_column_vector(i),
+						sizeof(float64_t)*num_machines);
+
 				if (heuris==OVA_SOFTMAX)
 					m_multiclass_strategy->rescale_outputs(output_for_i,As,Bs);
 				else
 					m_multiclass_strategy->rescale_outputs(output_for_i);
 
 				// only first num_classes are returned
-				for (int32_t r=0; r<num_classes; r++)
-					r_output_for_i[r] = output_for_i[r];
-
-				SG_DEBUG("{}::apply_multiclass(): sum(r_output_for_i) = {}",
-					get_name(), SGVector<float64_t>::sum(r_output_for_i.vector,num_classes));
+				sg_memcpy(confidences.get_column_vector(i), output_for_i.vector,
+						sizeof(float64_t)*num_classes);
 			}
+		}
 
-			// use rescaled outputs for label decision
-			result->set_label(i, m_multiclass_strategy->decide_label(r_output_for_i));
-			result->set_multiclass_confidences(i, r_output_for_i);
+		// use rescaled outputs for label decision
+		auto labels = m_multiclass_strategy->decide_labels(confidences);
+		result->allocate_confidences_for(confidences.num_rows);
+		for (int32_t i=0; i<num_vectors; i++)
+		{
+			result->set_label(i, labels[i]);
+			result->set_multiclass_confidences(i, confidences.get_column(i));
 		}
-		outputs.clear();
 
 		return_labels=result;
 	}
@@ -190,21 +207,13 @@ std::shared_ptr<MultilabelLabels> MulticlassMachine::apply_multilabel_output(std
 		require(n_outputs<=num_machines,"You request more outputs than machines available");
 
 		auto result=std::make_shared<MultilabelLabels>(num_vectors, n_outputs);
-		std::vector<std::shared_ptr<BinaryLabels>> outputs(num_machines);
+		auto outputs = get_submachine_outputs_matrix(num_vectors);
 
-		for (int32_t i=0; i < num_machines; ++i)
-			outputs[i] = get_submachine_outputs(i);
-
-		SGVector<float64_t> output_for_i(num_machines);
 		for (int32_t i=0; i<num_vectors; i++)
 		{
-			for (int32_t j=0; j<num_machines; j++)
-				output_for_i[j] = outputs[j]->get_value(i);
-
-			result->set_label(i, m_multiclass_strategy->decide_label_multiple_output(output_for_i, n_outputs));
+			result->set_label(i, m_multiclass_strategy->decide_label_multiple_output(
+					outputs.get_column(i), n_outputs));
 		}
-		for (int32_t i=0; i < num_machines; ++i)
-			outputs[i].reset();
 
 		return_labels=result;
 	}
@@ -225,6 +234,12 @@ bool MulticlassMachine::train_machine(std::shared_ptr<Features> data)
 		init_machine_for_train(data);
 
 	m_machines.clear();
+	if (m_parallel_training && supports_parallel_training())
+	{
+		train_machines_parallel();
+		return true;
+	}
+
 	auto train_labels = std::make_shared<BinaryLabels>(get_num_rhs_vectors());
 
 	m_machine->set_labels(train_labels);
@@ -256,6 +271,51 @@ bool MulticlassMachine::train_machine(std::shared_ptr<Features> data)
 	return true;
 }
 
+void MulticlassMachine::train_machines_parallel()
+{
+	auto tasks =
+	    m_multiclass_strategy->train_tasks(multiclass_labels(m_labels));
+	auto machines = get_machines_for_tasks(tasks);
+	const index_t num_tasks = tasks.size();
+
+	// scheduling the largest problems first keeps cores from idling
+	// behind a single long task at the end
+	std::vector<index_t> order(num_tasks);
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&](index_t a, index_t b) {
+		return tasks[a].labels->get_num_labels() >
+		       tasks[b].labels->get_num_labels();
+	});
+
+	std::exception_ptr exception;
+#pragma omp parallel for schedule(dynamic, 1)
+	for (index_t k = 0; k < num_tasks; ++k)
+	{
+		try
+		{
+			machines[order[k]]->train();
+		}
+		catch (...)
+		{
+#pragma omp critical
+			if (!exception)
+				exception = std::current_exception();
+		}
+	}
+	if (exception)
+		std::rethrow_exception(exception);
+
+	for (index_t i = 0; i < num_tasks; ++i)
+		m_machines.push_back(get_machine_from_task(machines[i], tasks[i]));
+}
+
+std::vector<std::shared_ptr<Machine>> MulticlassMachine::get_machines_for_tasks(
+    const std::vector<MulticlassStrategy::TrainTask>& tasks)
+{
+	not_implemented(SOURCE_LOCATION);
+	return {};
+}
+
 float64_t MulticlassMachine::apply_one(int32_t vec_idx)
 {
 	init_machines_for_apply(NULL);
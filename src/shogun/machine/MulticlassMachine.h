@@ -86,6 +86,12 @@ class MulticlassMachine : public BaseMulticlassMachine
 		 */
 		virtual float64_t get_submachine_output(int32_t i, int32_t num);
 
+		/** get outputs of all submachines for all vectors
+		 * @param num_vectors number of vectors
+		 * @return outputs, one row per submachine and one column per vector
+		 */
+		virtual SGMatrix<float64_t> get_submachine_outputs_matrix(int32_t num_vectors);
+
 		/** classify all examples
 		 *
 		 * @return resulting labels
@@ -152,6 +158,23 @@ class MulticlassMachine : public BaseMulticlassMachine
 			m_multiclass_strategy->set_prob_heuris_type(prob_heuris);
 		}
 
+		/** set whether the machines of the strategy are trained
+		 * concurrently, each as an independent copy of the base machine.
+		 * Ignored by machines that do not support it.
+		 *
+		 * @param parallel_training whether to train in parallel
+		 */
+		inline void set_parallel_training(bool parallel_training)
+		{
+			m_parallel_training = parallel_training;
+		}
+
+		/** @return whether machines are trained concurrently */
+		inline bool get_parallel_training() const
+		{
+			return m_parallel_training;
+		}
+
 	protected:
 		/** init strategy */
 		void init_strategy();
@@ -186,6 +209,35 @@ class MulticlassMachine : public BaseMulticlassMachine
 		/** deletes any subset set to the features of the machine */
 		virtual void remove_machine_subset() = 0;
 
+		/** whether copies of the base machine can be trained concurrently */
+		virtual bool supports_parallel_training() const
+		{
+			return false;
+		}
+
+		/** create independent copies of the base machine, one for each
+		 * task, set up to be trained concurrently on the task's vectors and
+		 * labels
+		 *
+		 * @param tasks training tasks of the strategy
+		 * @return untrained machine of each task
+		 */
+		virtual std::vector<std::shared_ptr<Machine>> get_machines_for_tasks(
+		    const std::vector<MulticlassStrategy::TrainTask>& tasks);
+
+		/** obtain machine from one trained on a task
+		 *
+		 * @param machine machine trained by train_machines_parallel
+		 * @param task task the machine was trained on
+		 * @return machine to be stored
+		 */
+		virtual std::shared_ptr<Machine> get_machine_from_task(
+		    const std::shared_ptr<Machine>& machine,
+		    const MulticlassStrategy::TrainTask& task) const
+		{
+			return get_machine_from_trained(machine);
+		}
+
 		/** whether the machine is acceptable in set_machine */
 		virtual bool is_acceptable_machine(std::shared_ptr<Machine >machine)
 		{
@@ -197,12 +249,20 @@ class MulticlassMachine : public BaseMulticlassMachine
 		/** register parameters */
 		void register_parameters();
 
+		/** train all machines of the strategy concurrently, longest tasks
+		 * first
+		 */
+		void train_machines_parallel();
+
 	protected:
 		/** type of multiclass strategy */
 		std::shared_ptr<MulticlassStrategy >m_multiclass_strategy;
 
 		/** machine */
 		std::shared_ptr<Machine> m_machine;
+
+		/** whether machines are trained concurrently */
+		bool m_parallel_training = false;
 };
 }
 #endif
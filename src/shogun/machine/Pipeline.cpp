@@ -6,6 +6,7 @@
 
 #include <shogun/lib/exception/InvalidStateException.h>
 #include <shogun/machine/Pipeline.h>
+#include <shogun/preprocessor/DensePreprocessorChain.h>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -112,8 +113,11 @@ namespace shogun
 		    m_stages.back().first);
 	}
 
-	Pipeline::Pipeline() : Machine()
+	Pipeline::Pipeline() : Machine(), m_fuse_preprocessors(false)
 	{
+		SG_ADD(
+		    &m_fuse_preprocessors, "fuse_preprocessors",
+		    "Whether consecutive dense preprocessors are fused");
 	}
 
 	Pipeline::~Pipeline()
@@ -127,9 +131,19 @@ namespace shogun
 			require(m_labels, "No labels given.");
 		}
 		auto current_data = data;
-		for (auto&& stage : m_stages)
+		for (size_t i = 0; i < m_stages.size(); i++)
 		{
-			if (holds_alternative<std::shared_ptr<Transformer>>(stage.second))
+			auto&& stage = m_stages[i];
+			auto fused = fusable_preprocessors(i, current_data);
+			if (!fused.empty())
+			{
+				DensePreprocessorChain<float64_t> chain(fused);
+				auto matrix = current_data->as<DenseFeatures<float64_t>>()->get_feature_matrix();
+				chain.fit(matrix);
+				current_data = std::make_shared<DenseFeatures<float64_t>>(chain.transform(matrix));
+				i += fused.size() - 1;
+			}
+			else if (holds_alternative<std::shared_ptr<Transformer>>(stage.second))
 			{
 				auto transformer = shogun::get<std::shared_ptr<Transformer>>(stage.second);
 				transformer->train_require_labels()
@@ -152,9 +166,18 @@ namespace shogun
 	std::shared_ptr<Labels> Pipeline::apply(std::shared_ptr<Features> data)
 	{
 		auto current_data = data;
-		for (auto&& stage : m_stages)
+		for (size_t i = 0; i < m_stages.size(); i++)
 		{
-			if (holds_alternative<std::shared_ptr<Transformer>>(stage.second))
+			auto&& stage = m_stages[i];
+			auto fused = fusable_preprocessors(i, current_data);
+			if (!fused.empty())
+			{
+				DensePreprocessorChain<float64_t> chain(fused);
+				auto matrix = current_data->as<DenseFeatures<float64_t>>()->get_feature_matrix();
+				current_data = std::make_shared<DenseFeatures<float64_t>>(chain.transform(matrix));
+				i += fused.size() - 1;
+			}
+			else if (holds_alternative<std::shared_ptr<Transformer>>(stage.second))
 			{
 				auto transformer = shogun::get<std::shared_ptr<Transformer>>(stage.second);
 				current_data = transformer->transform(current_data);
@@ -169,6 +192,39 @@ namespace shogun
 		return nullptr; // unreachable
 	}
 
+	std::vector<std::shared_ptr<DensePreprocessor<float64_t>>>
+	Pipeline::fusable_preprocessors(size_t first, const std::shared_ptr<Features>& data) const
+	{
+		std::vector<std::shared_ptr<DensePreprocessor<float64_t>>> result;
+		if (!m_fuse_preprocessors || !data ||
+		    data->get_feature_class() != C_DENSE ||
+		    data->get_feature_type() != F_DREAL)
+			return result;
+
+		for (auto i = first; i < m_stages.size(); i++)
+		{
+			if (!holds_alternative<std::shared_ptr<Transformer>>(m_stages[i].second))
+				break;
+			auto preprocessor = std::dynamic_pointer_cast<DensePreprocessor<float64_t>>(
+			    shogun::get<std::shared_ptr<Transformer>>(m_stages[i].second));
+			if (!preprocessor || !preprocessor->is_vectorwise() ||
+			    preprocessor->train_require_labels())
+				break;
+			result.push_back(preprocessor);
+		}
+		return result;
+	}
+
+	void Pipeline::set_fuse_preprocessors(bool fuse)
+	{
+		m_fuse_preprocessors = fuse;
+	}
+
+	bool Pipeline::get_fuse_preprocessors() const
+	{
+		return m_fuse_preprocessors;
+	}
+
 	bool Pipeline::train_require_labels() const
 	{
 		bool require_labels = false;
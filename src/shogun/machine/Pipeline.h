@@ -11,6 +11,7 @@
 #include <shogun/machine/Machine.h>
 #include <shogun/transformer/Transformer.h>
 #include <shogun/machine/Composite.h>
+#include <shogun/preprocessor/DensePreprocessor.h>
 #include <utility>
 
 namespace shogun
@@ -122,12 +123,38 @@ namespace shogun
 
 		EProblemType get_machine_problem_type() const override;
 
+		/** Fuse consecutive vectorwise dense preprocessors (cf.
+		 * DensePreprocessor::is_vectorwise) that transform DenseFeatures
+		 * of float64_t. Their fitting and transformation are then done in
+		 * parallel passes over the data without intermediate features,
+		 * see DensePreprocessorChain. Unlike transforming them one by one,
+		 * the input features are not modified.
+		 *
+		 * @param fuse whether to fuse preprocessors
+		 */
+		void set_fuse_preprocessors(bool fuse);
+
+		/** @return whether preprocessors are fused */
+		bool get_fuse_preprocessors() const;
+
 	protected:
 		bool train_machine(std::shared_ptr<Features> data = NULL) override;
 
+		/** Collects the preprocessors that can be fused, starting at a stage
+		 *
+		 * @param first index of the first stage
+		 * @param data features that are passed to the first stage
+		 * @return preprocessors, empty if none can be fused
+		 */
+		std::vector<std::shared_ptr<DensePreprocessor<float64_t>>>
+		fusable_preprocessors(size_t first, const std::shared_ptr<Features>& data) const;
+
 		std::vector<std::pair<std::string, variant<std::shared_ptr<Transformer>, std::shared_ptr<Machine>>>>
 		    m_stages;
 		bool train_require_labels() const override;
+
+		/** whether preprocessors are fused */
+		bool m_fuse_preprocessors;
 	};
 }
 
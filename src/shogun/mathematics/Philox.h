@@ -0,0 +1,155 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef __PHILOX_H__
+#define __PHILOX_H__
+
+#include <shogun/lib/common.h>
+#include <shogun/lib/config.h>
+
+#include <array>
+#include <limits>
+
+namespace shogun
+{
+	/** @brief Counter-based pseudo random number generator Philox4x32-10.
+	 *
+	 * The n-th output of a stream is a bijection of the counter (stream, n)
+	 * under the key (seed), so that jumping to any position or stream is
+	 * free. This makes it suitable for parallel algorithms: task i draws
+	 * from substream(i), which gives the same numbers no matter which
+	 * thread runs the task or how many threads there are.
+	 *
+	 * Satisfies the UniformRandomBitGenerator requirements, so it can be
+	 * used with all shogun distributions.
+	 *
+	 * Salmon, J. K., Moraes, M. A., Dror, R. O., & Shaw, D. E. (2011).
+	 * Parallel random numbers: as easy as 1, 2, 3. SC'11.
+	 */
+	class Philox
+	{
+	public:
+		using result_type = uint64_t;
+
+		/** constructor
+		 * @param seed key of the generator
+		 * @param stream index of the substream
+		 */
+		explicit Philox(uint64_t seed = 0, uint64_t stream = 0)
+		{
+			this->seed(seed);
+			m_stream = stream;
+		}
+
+		/** reset the generator to the start of stream 0 of a key */
+		void seed(uint64_t seed)
+		{
+			m_key = {uint32_t(seed), uint32_t(seed >> 32)};
+			m_stream = 0;
+			m_position = 0;
+			m_next = 2;
+		}
+
+		/** @return generator with the same key, at the start of a
+		 * different stream
+		 */
+		Philox substream(uint64_t stream) const
+		{
+			Philox result;
+			result.m_key = m_key;
+			result.m_stream = stream;
+			return result;
+		}
+
+		/** @return next 64 random bits */
+		result_type operator()()
+		{
+			if (m_next == 2)
+			{
+				m_block = generate_block(m_position++);
+				m_next = 0;
+			}
+			auto result = (uint64_t(m_block[2 * m_next]) << 32) |
+			              m_block[2 * m_next + 1];
+			++m_next;
+			return result;
+		}
+
+		/** advance by n outputs */
+		void discard(uint64_t n)
+		{
+			while (n > 0 && m_next < 2)
+			{
+				++m_next;
+				--n;
+			}
+			m_position += n / 2;
+			if (n % 2)
+				operator()();
+		}
+
+		static constexpr result_type min()
+		{
+			return 0;
+		}
+
+		static constexpr result_type max()
+		{
+			return std::numeric_limits<result_type>::max();
+		}
+
+		bool operator==(const Philox& other) const
+		{
+			return m_key == other.m_key && m_stream == other.m_stream &&
+			       m_position == other.m_position &&
+			       m_next == other.m_next;
+		}
+
+		bool operator!=(const Philox& other) const
+		{
+			return !(*this == other);
+		}
+
+	private:
+		/** ten Philox rounds on the counter (position, stream) */
+		std::array<uint32_t, 4> generate_block(uint64_t position) const
+		{
+			constexpr uint64_t M0 = 0xD2511F53;
+			constexpr uint64_t M1 = 0xCD9E8D57;
+			constexpr uint32_t W0 = 0x9E3779B9;
+			constexpr uint32_t W1 = 0xBB67AE85;
+
+			std::array<uint32_t, 4> ctr = {
+			    uint32_t(position), uint32_t(position >> 32),
+			    uint32_t(m_stream), uint32_t(m_stream >> 32)};
+			auto key = m_key;
+
+			for (int32_t round = 0; round < 10; ++round)
+			{
+				auto p0 = M0 * ctr[0];
+				auto p1 = M1 * ctr[2];
+				ctr = {uint32_t(p1 >> 32) ^ ctr[1] ^ key[0], uint32_t(p1),
+				       uint32_t(p0 >> 32) ^ ctr[3] ^ key[1], uint32_t(p0)};
+				key[0] += W0;
+				key[1] += W1;
+			}
+			return ctr;
+		}
+
+		/** key */
+		std::array<uint32_t, 2> m_key;
+		/** substream, upper half of the counter */
+		uint64_t m_stream;
+		/** block index within the stream, lower half of the counter */
+		uint64_t m_position;
+		/** current block */
+		std::array<uint32_t, 4> m_block;
+		/** index of the next 64 bit output in the current block, 2 if the
+		 * block is used up
+		 */
+		int32_t m_next;
+	};
+} // namespace shogun
+
+#endif // __PHILOX_H__
@@ -3,6 +3,7 @@
 
 #include <shogun/base/SGObject.h>
 #include <shogun/lib/config.h>
+#include <shogun/mathematics/Philox.h>
 #include <shogun/mathematics/Seedable.h>
 
 #include <iterator>
@@ -101,6 +102,16 @@ namespace shogun
 			random::seed(object, m_prng);
 		}
 
+		/** Returns a counter-based generator for parallel tasks, keyed by a
+		 * single draw from m_prng. Task i should draw from
+		 * substream(i) of it, which makes results independent of the
+		 * number of threads and of the order in which tasks run.
+		 */
+		Philox counter_prng() const
+		{
+			return Philox(m_prng());
+		}
+
 		mutable PRNG m_prng;
 	};
 
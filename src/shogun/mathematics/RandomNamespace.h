@@ -4,6 +4,7 @@
 #include <shogun/base/SGObject.h>
 #include <shogun/lib/common.h>
 #include <shogun/lib/config.h>
+#include <shogun/mathematics/Philox.h>
 #include <shogun/mathematics/UniformIntDistribution.h>
 #include <shogun/mathematics/UniformRealDistribution.h>
 
@@ -105,6 +106,47 @@ namespace shogun
 		{
 			fill_array(container.begin(), container.end(), min, max, prng);
 		}
+
+		/** Fills an array in parallel with random numbers generated from
+		 * a given distribution. The array is split into fixed blocks, block
+		 * b is drawn from prng.substream(b), so that the result does not
+		 * depend on the number of threads.
+		 *
+		 * @param first a random access iterator to the first element
+		 * @param last a random access iterator past the last element
+		 * @param dist random number distribution, copied per block
+		 * @param prng counter-based generator the substreams are taken from
+		 */
+		template <typename Iterator, typename Distribution>
+		static inline void fill_array_parallel(
+		    Iterator first, Iterator last, const Distribution& dist,
+		    const Philox& prng)
+		{
+			constexpr int64_t block_size = 4096;
+			const int64_t size = last - first;
+			const int64_t num_blocks = (size + block_size - 1) / block_size;
+
+#pragma omp parallel for
+			for (int64_t b = 0; b < num_blocks; ++b)
+			{
+				auto block_prng = prng.substream(b);
+				auto block_dist = dist;
+				auto end = first + std::min(size, (b + 1) * block_size);
+				for (auto it = first + b * block_size; it != end; ++it)
+					*it = block_dist(block_prng);
+			}
+		}
+
+		/** Fills a container in parallel with random numbers generated from
+		 * a given distribution, see fill_array_parallel above
+		 */
+		template <typename Container, typename Distribution>
+		static inline void fill_array_parallel(
+		    Container& container, const Distribution& dist, const Philox& prng)
+		{
+			fill_array_parallel(
+			    std::begin(container), std::end(container), dist, prng);
+		}
 	} // namespace random
 } // namespace shogun
 
@@ -0,0 +1,289 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/base/ShogunEnv.h>
+#include <shogun/base/range.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/features/DotFeatures.h>
+#include <shogun/mathematics/ScatterMatrix.h>
+#include <shogun/mathematics/eigen3.h>
+
+#include <algorithm>
+#include <type_traits>
+
+using namespace shogun;
+using namespace Eigen;
+
+template <class T>
+ScatterMatrix<T>::ScatterMatrix() : m_diagonal(false), m_num_features(0)
+{
+}
+
+template <class T>
+ScatterMatrix<T>::ScatterMatrix(const DotFeatures& features, bool diagonal)
+    : m_diagonal(diagonal), m_num_features(0)
+{
+	SGVector<int32_t> labels(features.get_num_vectors());
+	labels.zero();
+	compute(features, labels, 1);
+}
+
+template <class T>
+ScatterMatrix<T>::ScatterMatrix(
+    const DotFeatures& features, const SGVector<int32_t>& labels,
+    int32_t num_classes, bool diagonal)
+    : m_diagonal(diagonal), m_num_features(0)
+{
+	compute(features, labels, num_classes);
+}
+
+template <class T>
+void ScatterMatrix<T>::compute(
+    const DotFeatures& features, const SGVector<int32_t>& labels,
+    int32_t num_classes)
+{
+	auto num_vectors = features.get_num_vectors();
+	m_num_features = features.get_dim_feature_space();
+	require(m_num_features > 0, "Dimension of provided features {} must be positive", m_num_features);
+	require(
+	    labels.vlen == num_vectors,
+	    "Number of labels ({}) must match number of vectors ({})",
+	    labels.vlen, num_vectors);
+
+	// sort vectors by class, labels are checked here as exceptions must not
+	// leave the parallel loop below
+	std::vector<index_t> offsets(num_classes + 1, 0);
+	for (auto i : range(num_vectors))
+	{
+		require(
+		    labels[i] >= 0 && labels[i] < num_classes,
+		    "Label {} of vector {} is out of [0, {})", labels[i], i,
+		    num_classes);
+		offsets[labels[i] + 1]++;
+	}
+	for (auto c : range(num_classes))
+		offsets[c + 1] += offsets[c];
+	std::vector<index_t> index(num_vectors);
+	auto next = offsets;
+	for (auto i : range(num_vectors))
+		index[next[labels[i]]++] = i;
+
+	add_classes(num_classes);
+
+	auto dense = dynamic_cast<const DenseFeatures<T>*>(&features);
+	auto num_features = m_num_features;
+	auto scatter_cols = m_diagonal ? 1 : num_features;
+	for (auto c : range(num_classes))
+	{
+		auto first = offsets[c];
+		auto count = offsets[c + 1] - first;
+		if (count == 0)
+			continue;
+
+		// blocks are computed in parallel, but their statistics are merged
+		// one after another in block order, which does not depend on the
+		// number of threads
+		int64_t num_blocks = (count + block_size - 1) / block_size;
+		auto num_threads = std::max<int64_t>(
+		    1, std::min<int64_t>(num_blocks, env()->get_num_threads()));
+#pragma omp parallel num_threads(num_threads)
+		{
+			SGMatrix<T> block(num_features, block_size);
+			SGVector<T> block_mean(num_features);
+			SGMatrix<T> block_scatter(num_features, scatter_cols);
+			SGVector<float64_t> buffer(num_features);
+#pragma omp for ordered schedule(static, 1)
+			for (int64_t b = 0; b < num_blocks; b++)
+			{
+				auto begin = b * block_size;
+				auto size = std::min<int64_t>(block_size, count - begin);
+				for (auto j : range(size))
+				{
+					auto idx = index[first + begin + j];
+					auto column = block.get_column_vector(j);
+					if (dense)
+					{
+						int32_t len;
+						bool dofree;
+						auto vec = dense->get_feature_vector(idx, len, dofree);
+						std::copy_n(vec, num_features, column);
+						dense->free_feature_vector(vec, idx, dofree);
+					}
+					else if constexpr (std::is_same_v<T, float64_t>)
+					{
+						std::fill_n(column, num_features, 0.0);
+						features.add_to_dense_vec(1.0, idx, column, num_features);
+					}
+					else
+					{
+						buffer.zero();
+						features.add_to_dense_vec(1.0, idx, buffer.vector, num_features);
+						std::copy_n(buffer.vector, num_features, column);
+					}
+				}
+
+				Map<typename SGMatrix<T>::EigenMatrixXt> X(block.matrix, num_features, size);
+				typename SGVector<T>::EigenVectorXtMap mu = block_mean;
+				typename SGMatrix<T>::EigenMatrixXtMap S = block_scatter;
+				mu = X.rowwise().mean();
+				X.colwise() -= mu;
+				if (m_diagonal)
+					S.col(0) = X.cwiseAbs2().rowwise().sum();
+				else
+				{
+					S.setZero();
+					S.template selfadjointView<Lower>().rankUpdate(X);
+				}
+#pragma omp ordered
+				merge_statistics(
+				    m_count[c], m_mean[c], m_scatter[c], size, block_mean,
+				    block_scatter);
+			}
+		}
+		if (!m_diagonal)
+		{
+			typename SGMatrix<T>::EigenMatrixXtMap S = m_scatter[c];
+			S.template triangularView<StrictlyUpper>() = S.transpose();
+		}
+	}
+}
+
+template <class T>
+void ScatterMatrix<T>::merge(const ScatterMatrix<T>& other)
+{
+	if (other.get_num_classes() == 0)
+		return;
+	if (get_num_classes() == 0)
+	{
+		m_diagonal = other.m_diagonal;
+		m_num_features = other.m_num_features;
+	}
+	require(
+	    other.m_num_features == m_num_features,
+	    "Number of features ({}) does not match number of features seen so "
+	    "far ({})",
+	    other.m_num_features, m_num_features);
+	require(
+	    other.m_diagonal == m_diagonal,
+	    "Can not merge diagonals with full scatter matrices");
+
+	add_classes(other.get_num_classes());
+	for (auto c : range(other.get_num_classes()))
+	{
+		merge_statistics(
+		    m_count[c], m_mean[c], m_scatter[c], other.m_count[c],
+		    other.m_mean[c], other.m_scatter[c]);
+		if (!m_diagonal)
+		{
+			typename SGMatrix<T>::EigenMatrixXtMap S = m_scatter[c];
+			S.template triangularView<StrictlyUpper>() = S.transpose();
+		}
+	}
+}
+
+template <class T>
+void ScatterMatrix<T>::add_classes(int32_t num_classes)
+{
+	while (get_num_classes() < num_classes)
+	{
+		SGVector<T> mean(m_num_features);
+		SGMatrix<T> scatter(m_num_features, m_diagonal ? 1 : m_num_features);
+		mean.zero();
+		scatter.zero();
+		m_count.push_back(0);
+		m_mean.push_back(mean);
+		m_scatter.push_back(scatter);
+	}
+}
+
+template <class T>
+void ScatterMatrix<T>::merge_statistics(
+    int64_t& count, SGVector<T>& mean, SGMatrix<T>& scatter,
+    int64_t other_count, const SGVector<T>& other_mean,
+    const SGMatrix<T>& other_scatter) const
+{
+	if (other_count == 0)
+		return;
+
+	typename SGVector<T>::EigenVectorXtMap mu = mean;
+	typename SGMatrix<T>::EigenMatrixXtMap S = scatter;
+	typename SGVector<T>::EigenVectorXt delta =
+	    typename SGVector<T>::EigenVectorXtMap(other_mean) - mu;
+	auto total = count + other_count;
+	auto factor = static_cast<T>(count) * other_count / total;
+
+	S += typename SGMatrix<T>::EigenMatrixXtMap(other_scatter);
+	if (m_diagonal)
+		S.col(0) += factor * delta.cwiseAbs2();
+	else if (count > 0)
+		S.template selfadjointView<Lower>().rankUpdate(delta, factor);
+	mu += delta * (static_cast<T>(other_count) / total);
+	count = total;
+}
+
+template <class T>
+int64_t ScatterMatrix<T>::get_count(int32_t c) const
+{
+	require(c >= 0 && c < get_num_classes(), "Class {} is out of [0, {})", c, get_num_classes());
+	return m_count[c];
+}
+
+template <class T>
+SGVector<T> ScatterMatrix<T>::get_mean(int32_t c) const
+{
+	require(c >= 0 && c < get_num_classes(), "Class {} is out of [0, {})", c, get_num_classes());
+	return m_mean[c];
+}
+
+template <class T>
+SGVector<T> ScatterMatrix<T>::get_total_mean() const
+{
+	SGVector<T> mean(m_num_features);
+	mean.zero();
+	int64_t total = 0;
+	for (auto c : range(get_num_classes()))
+	{
+		typename SGVector<T>::EigenVectorXtMap(mean.vector, m_num_features) +=
+		    typename SGVector<T>::EigenVectorXtMap(m_mean[c]) *
+		    static_cast<T>(m_count[c]);
+		total += m_count[c];
+	}
+	if (total > 0)
+		typename SGVector<T>::EigenVectorXtMap(mean.vector, m_num_features) /=
+		    static_cast<T>(total);
+	return mean;
+}
+
+template <class T>
+SGMatrix<T> ScatterMatrix<T>::get_scatter(int32_t c) const
+{
+	require(c >= 0 && c < get_num_classes(), "Class {} is out of [0, {})", c, get_num_classes());
+	require(!m_diagonal, "Only diagonals of scatter matrices have been computed");
+	return m_scatter[c];
+}
+
+template <class T>
+SGVector<T> ScatterMatrix<T>::get_scatter_diagonal(int32_t c) const
+{
+	require(c >= 0 && c < get_num_classes(), "Class {} is out of [0, {})", c, get_num_classes());
+	if (m_diagonal)
+		return SGVector<T>(m_scatter[c].get_column_vector(0), m_num_features, false).clone();
+	return m_scatter[c].get_diagonal_vector();
+}
+
+template <class T>
+SGMatrix<T> ScatterMatrix<T>::get_within_scatter() const
+{
+	require(!m_diagonal, "Only diagonals of scatter matrices have been computed");
+	SGMatrix<T> scatter(m_num_features, m_num_features);
+	scatter.zero();
+	typename SGMatrix<T>::EigenMatrixXtMap S = scatter;
+	for (const auto& class_scatter : m_scatter)
+		S += typename SGMatrix<T>::EigenMatrixXtMap(class_scatter);
+	return scatter;
+}
+
+template class shogun::ScatterMatrix<float32_t>;
+template class shogun::ScatterMatrix<float64_t>;
+template class shogun::ScatterMatrix<floatmax_t>;
@@ -0,0 +1,136 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef _SCATTERMATRIX_H__
+#define _SCATTERMATRIX_H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+
+#include <vector>
+
+namespace shogun
+{
+class DotFeatures;
+
+/** @brief Means and scatter matrices, i.e. sums of the outer products of the
+ * centered vectors, of DotFeatures, either of all vectors or of the vectors of
+ * every class. Covariance matrices are scatter matrices divided by N or N-1.
+ *
+ * The vectors are gathered into dense blocks of block_size columns, which
+ * works alike for dense, sparse and any other DotFeatures. Every block is
+ * centered at its own mean and its scatter matrix is added by a symmetric
+ * rank-k update (SYRK). Statistics of blocks are merged with the pairwise
+ * updates of Chan et al. (1979), which is numerically stable and needs a
+ * single pass over the data. Blocks are processed by different threads, but
+ * their statistics are merged in block order, so that results do not depend
+ * on the number of threads.
+ */
+template <class T> class ScatterMatrix
+{
+	public:
+		/** number of vectors that are gathered into a block */
+		static constexpr index_t block_size = 256;
+
+		/** constructor, statistics of no vectors */
+		ScatterMatrix();
+
+		/** Computes the statistics of all vectors
+		 *
+		 * @param features features
+		 * @param diagonal whether to compute the diagonal of the scatter
+		 * matrix only
+		 */
+		ScatterMatrix(const DotFeatures& features, bool diagonal = false);
+
+		/** Computes the statistics of the vectors of every class
+		 *
+		 * @param features features
+		 * @param labels class of every vector, from 0 to num_classes-1
+		 * @param num_classes number of classes
+		 * @param diagonal whether to compute the diagonals of the scatter
+		 * matrices only
+		 */
+		ScatterMatrix(
+		    const DotFeatures& features, const SGVector<int32_t>& labels,
+		    int32_t num_classes, bool diagonal = false);
+
+		/** Merges the statistics of other vectors class by class, classes
+		 * that are missing so far are added.
+		 *
+		 * @param other statistics of other vectors
+		 */
+		void merge(const ScatterMatrix<T>& other);
+
+		/** @return number of classes */
+		int32_t get_num_classes() const
+		{
+			return m_count.size();
+		}
+
+		/** @return number of features */
+		index_t get_num_features() const
+		{
+			return m_num_features;
+		}
+
+		/** @param c class
+		 * @return number of vectors of the class
+		 */
+		int64_t get_count(int32_t c = 0) const;
+
+		/** @param c class
+		 * @return mean of the vectors of the class
+		 */
+		SGVector<T> get_mean(int32_t c = 0) const;
+
+		/** @return mean of all vectors */
+		SGVector<T> get_total_mean() const;
+
+		/** @param c class
+		 * @return scatter matrix of the vectors of the class
+		 */
+		SGMatrix<T> get_scatter(int32_t c = 0) const;
+
+		/** @param c class
+		 * @return diagonal of the scatter matrix of the vectors of the class
+		 */
+		SGVector<T> get_scatter_diagonal(int32_t c = 0) const;
+
+		/** @return within class scatter matrix, sum of the scatter matrices
+		 * of all classes
+		 */
+		SGMatrix<T> get_within_scatter() const;
+
+	private:
+		void compute(
+		    const DotFeatures& features, const SGVector<int32_t>& labels,
+		    int32_t num_classes);
+
+		/** Adds class statistics with zero vectors */
+		void add_classes(int32_t num_classes);
+
+		/** Merges statistics of other vectors into the lower triangle of a
+		 * scatter matrix, or its diagonal column
+		 */
+		void merge_statistics(
+		    int64_t& count, SGVector<T>& mean, SGMatrix<T>& scatter,
+		    int64_t other_count, const SGVector<T>& other_mean,
+		    const SGMatrix<T>& other_scatter) const;
+
+		/** whether only diagonals of scatter matrices are computed */
+		bool m_diagonal;
+		/** number of features */
+		index_t m_num_features;
+		/** number of vectors of every class */
+		std::vector<int64_t> m_count;
+		/** mean of every class */
+		std::vector<SGVector<T>> m_mean;
+		/** scatter matrix of every class, a single column for diagonals */
+		std::vector<SGMatrix<T>> m_scatter;
+};
+}
+#endif
@@ -7,6 +7,7 @@
  */
 
 #include <algorithm>
+#include <shogun/features/DenseFeatures.h>
 #include <shogun/lib/SGMatrix.h>
 #include <shogun/lib/SGSparseMatrix.h>
 #include <shogun/lib/SGSparseVector.h>
@@ -17,6 +18,7 @@
 #include <shogun/mathematics/eigen3.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 #include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/mathematics/ScatterMatrix.h>
 #include <shogun/mathematics/UniformIntDistribution.h>
 #include <shogun/mathematics/NormalDistribution.h>
 
@@ -146,25 +148,20 @@ SGMatrix<float64_t> Statistics::covariance_matrix(
 	require(N>1, "Number of observations ({}) must be at least 2.", N);
 	require(D>0, "Number of dimensions ({}) must be at least 1.", D);
 
-	SGMatrix<float64_t> centered=in_place ? observations :
-					SGMatrix<float64_t>(D, N);
+	SG_DEBUG("Computing squared differences");
+	auto features = std::make_shared<DenseFeatures<float64_t>>(observations);
+	ScatterMatrix<float64_t> scatter(*features);
+	SGMatrix<float64_t> cov = scatter.get_scatter();
+	linalg::scale(cov, cov, 1.0 / (N - 1));
 
-	/* center observations, potentially in-place */
-	if (!in_place)
+	/* center observations in-place, if requested */
+	if (in_place)
 	{
-		int64_t num_elements = N*D;
-		sg_memcpy(centered.matrix, observations.matrix,
-				sizeof(float64_t)*num_elements);
+		SG_DEBUG("Centering observations");
+		Map<MatrixXd> eigen_centered(observations.matrix, D, N);
+		Map<VectorXd> mean(scatter.get_mean().vector, D);
+		eigen_centered.colwise() -= mean;
 	}
-	SG_DEBUG("Centering observations");
-	Map<MatrixXd> eigen_centered(centered.matrix, D, N);
-	eigen_centered.colwise() -= eigen_centered.rowwise().mean();
-
-	/* compute and store 1/(N-1) * X * X.T */
-	SG_DEBUG("Computing squared differences");
-	SGMatrix<float64_t> cov(D, D);
-	Map<MatrixXd> eigen_cov(cov.matrix, D, D);
-	eigen_cov = (eigen_centered * eigen_centered.adjoint()) / double(N - 1);
 
 	return cov;
 }
@@ -111,12 +111,12 @@ public:
 	 * data which is organized as num_cols variables with num_rows observations.
 	 * Normalizes by N-1 for N observations
 	 *
-	 * Data is centered before matrix is computed. May be done in place.
-	 * In this case, the observation matrix is changed (centered).
+	 * The covariance is computed blockwise in parallel without copying the
+	 * observations (cf. ScatterMatrix).
 	 *
 	 * @param observations Data matrix
 	 * @param in_place Optional, if set to true, observations matrix will be
-	 * centered, if false, a copy will be created an centered.
+	 * centered afterwards, if false, it is not modified.
 	 * @return DxD covariance matrix
 	 */
 	static SGMatrix<float64_t> covariance_matrix(
@@ -0,0 +1,200 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef LINALG_RANDOMIZED_H_
+#define LINALG_RANDOMIZED_H_
+
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/mathematics/NormalDistribution.h>
+#include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/mathematics/eigen3.h>
+
+#include <algorithm>
+
+namespace shogun
+{
+
+	namespace linalg
+	{
+		namespace internal
+		{
+			/** Replaces the columns of Y with an orthonormal basis of their
+			 * span (thin Q factor of a Householder QR).
+			 */
+			template <typename EigenMatrix>
+			void orthonormalize(EigenMatrix& Y)
+			{
+				Eigen::HouseholderQR<EigenMatrix> qr(Y);
+				Y = qr.householderQ() *
+				    EigenMatrix::Identity(Y.rows(), Y.cols());
+			}
+
+			/** Randomized range finder (Halko, Martinsson & Tropp, 2011,
+			 * Algorithm 4.4). Returns an orthonormal
+			 * rows(A) x l matrix Q whose span approximates the range of A.
+			 */
+			template <typename T, typename PRNG>
+			typename SGMatrix<T>::EigenMatrixXt range_finder(
+			    const typename SGMatrix<T>::EigenMatrixXtMap& A, index_t l,
+			    index_t power_iterations, PRNG& prng)
+			{
+				using MatrixXt = typename SGMatrix<T>::EigenMatrixXt;
+
+				SGMatrix<T> omega(A.cols(), l);
+				random::fill_array(omega, NormalDistribution<T>(), prng);
+				typename SGMatrix<T>::EigenMatrixXtMap omega_eig = omega;
+
+				MatrixXt Q = A * omega_eig;
+				orthonormalize(Q);
+				for (index_t i = 0; i < power_iterations; ++i)
+				{
+					MatrixXt Z = A.transpose() * Q;
+					orthonormalize(Z);
+					Q = A * Z;
+					orthonormalize(Q);
+				}
+				return Q;
+			}
+		} // namespace internal
+
+		/** Computes the top-k singular triplets of A with a randomized
+		 * range finder followed by a small dense SVD, see
+		 *
+		 * Halko, N., Martinsson, P. G., & Tropp, J. A. (2011).
+		 * Finding structure with randomness: Probabilistic algorithms for
+		 * constructing approximate matrix decompositions. SIAM review.
+		 *
+		 * The cost is \f$O(mn(k+p)(2q+2))\f$ for an \f$m\times n\f$ matrix,
+		 * with \f$p\f$ oversampling columns and \f$q\f$ power iterations,
+		 * instead of \f$O(mn\min(m,n))\f$ for a full SVD.
+		 *
+		 * User should pass appropriately pre-allocated result containers.
+		 * Either U or V may be empty, in which case it is not computed.
+		 *
+		 * @param A the matrix to decompose
+		 * @param s singular values (length k) in descending order
+		 * @param U left singular vectors (num_rows(A) x k) or empty
+		 * @param V right singular vectors (num_cols(A) x k) or empty
+		 * @param k number of singular triplets to compute
+		 * @param prng pseudo random number generator for the test matrix
+		 * @param oversampling number of extra random projections
+		 * @param power_iterations number of subspace iterations, which
+		 * sharpen the decay of the spectrum
+		 */
+		template <typename T, typename PRNG>
+		void randomized_svd(
+		    const SGMatrix<T>& A, SGVector<T>& s, SGMatrix<T>& U,
+		    SGMatrix<T>& V, index_t k, PRNG& prng, index_t oversampling = 10,
+		    index_t power_iterations = 2)
+		{
+			using MatrixXt = typename SGMatrix<T>::EigenMatrixXt;
+
+			auto max_rank = std::min(A.num_rows, A.num_cols);
+			require(
+			    k > 0 && k <= max_rank,
+			    "Invalid value of k ({}), it must be in the range 1-{}.", k,
+			    max_rank);
+			require(
+			    s.vlen == k, "Length of singular values vector ({}) doesn't "
+			                 "match the number of requested components ({}).",
+			    s.vlen, k);
+			require(
+			    !U.matrix || (U.num_rows == A.num_rows && U.num_cols == k),
+			    "Left singular vectors matrix must be {} x {}.", A.num_rows, k);
+			require(
+			    !V.matrix || (V.num_rows == A.num_cols && V.num_cols == k),
+			    "Right singular vectors matrix must be {} x {}.", A.num_cols,
+			    k);
+			require(
+			    oversampling >= 0 && power_iterations >= 0,
+			    "Oversampling ({}) and power iterations ({}) must be "
+			    "non-negative.",
+			    oversampling, power_iterations);
+
+			auto l = std::min(k + oversampling, max_rank);
+			typename SGMatrix<T>::EigenMatrixXtMap A_eig = A;
+			MatrixXt Q =
+			    internal::range_finder<T>(A_eig, l, power_iterations, prng);
+
+			// project onto the l-dimensional subspace, B is l x num_cols(A)
+			MatrixXt B = Q.transpose() * A_eig;
+			auto options = V.matrix ? Eigen::ComputeThinU | Eigen::ComputeThinV
+			                        : Eigen::ComputeThinU;
+			Eigen::BDCSVD<MatrixXt> svd(B, options);
+
+			typename SGVector<T>::EigenVectorXtMap s_eig = s;
+			s_eig = svd.singularValues().head(k);
+			if (U.matrix)
+			{
+				typename SGMatrix<T>::EigenMatrixXtMap U_eig = U;
+				U_eig = Q * svd.matrixU().leftCols(k);
+			}
+			if (V.matrix)
+			{
+				typename SGMatrix<T>::EigenMatrixXtMap V_eig = V;
+				V_eig = svd.matrixV().leftCols(k);
+			}
+		}
+
+		/** Computes the top-k eigenvalues and eigenvectors of a symmetric
+		 * matrix with a randomized range finder, projecting A onto a
+		 * (k + oversampling)-dimensional subspace and solving the small
+		 * eigenproblem there. Results follow the conventions of
+		 * @see linalg::eigen_solver_symmetric.
+		 *
+		 * @param A symmetric matrix
+		 * @param eigenvalues eigenvalues result vector in ascending order
+		 * @param eigenvectors eigenvectors result matrix (num_rows(A) x k)
+		 * @param k number of top eigenvalues to be computed
+		 * @param prng pseudo random number generator for the test matrix
+		 * @param oversampling number of extra random projections
+		 * @param power_iterations number of subspace iterations
+		 */
+		template <typename T, typename PRNG>
+		void randomized_eigen_solver_symmetric(
+		    const SGMatrix<T>& A, SGVector<T>& eigenvalues,
+		    SGMatrix<T>& eigenvectors, index_t k, PRNG& prng,
+		    index_t oversampling = 10, index_t power_iterations = 2)
+		{
+			using MatrixXt = typename SGMatrix<T>::EigenMatrixXt;
+
+			require(
+			    A.num_rows == A.num_cols, "Matrix A ({} x {}) is not square!",
+			    A.num_rows, A.num_cols);
+			require(
+			    k > 0 && k <= A.num_rows,
+			    "Invalid value of k ({}), it must be in the range 1-{}.", k,
+			    A.num_rows);
+			require(
+			    eigenvectors.num_rows == A.num_rows &&
+			        eigenvectors.num_cols == k,
+			    "Eigenvectors matrix must be {} x {}.", A.num_rows, k);
+			require(
+			    eigenvalues.vlen == k, "Length of result vector doesn't "
+			                           "match the number of requested "
+			                           "eigenvalues");
+
+			auto l = std::min(k + oversampling, A.num_rows);
+			typename SGMatrix<T>::EigenMatrixXtMap A_eig = A;
+			MatrixXt Q =
+			    internal::range_finder<T>(A_eig, l, power_iterations, prng);
+
+			MatrixXt B = Q.transpose() * A_eig * Q;
+			Eigen::SelfAdjointEigenSolver<MatrixXt> solver(B);
+			require(
+			    solver.info() != Eigen::NoConvergence,
+			    "Iterative procedure did not converge!");
+
+			typename SGVector<T>::EigenVectorXtMap eigenvalues_eig =
+			    eigenvalues;
+			typename SGMatrix<T>::EigenMatrixXtMap eigenvectors_eig =
+			    eigenvectors;
+			eigenvalues_eig = solver.eigenvalues().tail(k);
+			eigenvectors_eig = Q * solver.eigenvectors().rightCols(k);
+		}
+	} // namespace linalg
+} // namespace shogun
+
+#endif // LINALG_RANDOMIZED_H_
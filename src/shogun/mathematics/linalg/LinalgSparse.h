@@ -0,0 +1,394 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef LINALG_SPARSE_H_
+#define LINALG_SPARSE_H_
+
+#include <shogun/features/SparseFeatures.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGSparseMatrix.h>
+#include <shogun/lib/SGSparseVector.h>
+#include <shogun/lib/SGVector.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace shogun
+{
+
+	namespace linalg
+	{
+		/* Products with sparse matrices. Following SGSparseMatrix::operator*,
+		 * a sparse matrix A (or sparse features) is treated as a
+		 * num_vectors x num_features matrix whose rows are the sparse
+		 * vectors. All products are parallelized over the sparse vectors.
+		 */
+		namespace internal
+		{
+			template <typename T>
+			index_t sparse_num_rows(const SGSparseMatrix<T>& A)
+			{
+				return A.num_vectors;
+			}
+
+			template <typename T>
+			index_t sparse_num_rows(const SparseFeatures<T>& A)
+			{
+				return A.get_num_vectors();
+			}
+
+			template <typename T>
+			index_t sparse_num_cols(const SGSparseMatrix<T>& A)
+			{
+				return A.num_features;
+			}
+
+			template <typename T>
+			index_t sparse_num_cols(const SparseFeatures<T>& A)
+			{
+				return A.get_num_features();
+			}
+
+			/** calls f(index, value) for all entries of sparse vector i */
+			template <typename T, typename F>
+			void for_each_entry(const SGSparseMatrix<T>& A, index_t i, F&& f)
+			{
+				const auto& row = A.sparse_matrix[i];
+				for (index_t k = 0; k < row.num_feat_entries; ++k)
+					f(row.features[k].feat_index, row.features[k].entry);
+			}
+
+			template <typename T, typename F>
+			void for_each_entry(const SparseFeatures<T>& A, index_t i, F&& f)
+			{
+				if (A.is_compressed())
+				{
+					const index_t* indices;
+					const T* values;
+					auto len = A.get_compressed_feature_vector(i, indices, values);
+					for (index_t k = 0; k < len; ++k)
+						f(indices[k], values[k]);
+				}
+				else
+				{
+					auto row = A.get_sparse_feature_vector(i);
+					for (index_t k = 0; k < row.num_feat_entries; ++k)
+						f(row.features[k].feat_index, row.features[k].entry);
+					A.free_sparse_feature_vector(i);
+				}
+			}
+
+			template <typename T, typename Sparse>
+			void sparse_matrix_prod(
+			    const Sparse& A, const SGVector<T>& x, SGVector<T>& result,
+			    bool transpose)
+			{
+				auto num_rows = sparse_num_rows(A);
+				auto num_cols = sparse_num_cols(A);
+				require(
+				    x.vlen == (transpose ? num_rows : num_cols),
+				    "Dimension mismatch! {} vs {}", x.vlen,
+				    transpose ? num_rows : num_cols);
+				require(
+				    result.vlen == (transpose ? num_cols : num_rows),
+				    "Dimension mismatch! {} vs {}", result.vlen,
+				    transpose ? num_cols : num_rows);
+
+				if (!transpose)
+				{
+#pragma omp parallel for
+					for (index_t i = 0; i < num_rows; ++i)
+					{
+						T sum = 0;
+						for_each_entry(A, i, [&](index_t j, T value) {
+							sum += value * x[j];
+						});
+						result[i] = sum;
+					}
+					return;
+				}
+
+				// scatter into one accumulator per thread, then reduce
+				std::fill_n(result.vector, result.vlen, T(0));
+#pragma omp parallel
+				{
+					std::vector<T> local(num_cols, T(0));
+#pragma omp for
+					for (index_t i = 0; i < num_rows; ++i)
+					{
+						const T scale = x[i];
+						for_each_entry(A, i, [&](index_t j, T value) {
+							local[j] += value * scale;
+						});
+					}
+#pragma omp critical
+					for (index_t j = 0; j < num_cols; ++j)
+						result[j] += local[j];
+				}
+			}
+
+			template <typename T, typename Sparse>
+			void sparse_matrix_prod(
+			    const Sparse& A, const SGMatrix<T>& B, SGMatrix<T>& result,
+			    bool transpose_A)
+			{
+				auto num_rows = sparse_num_rows(A);
+				auto num_cols = sparse_num_cols(A);
+				auto inner = transpose_A ? num_rows : num_cols;
+				auto outer = transpose_A ? num_cols : num_rows;
+				require(
+				    B.num_rows == inner, "Dimension mismatch! {} vs {}",
+				    B.num_rows, inner);
+				require(
+				    result.num_rows == outer && result.num_cols == B.num_cols,
+				    "Result matrix must be {} x {}, but is {} x {}", outer,
+				    B.num_cols, result.num_rows, result.num_cols);
+
+				const index_t k = B.num_cols;
+				if (!transpose_A)
+				{
+#pragma omp parallel
+					{
+						std::vector<T> row(k);
+#pragma omp for
+						for (index_t i = 0; i < num_rows; ++i)
+						{
+							std::fill(row.begin(), row.end(), T(0));
+							for_each_entry(A, i, [&](index_t j, T value) {
+								for (index_t c = 0; c < k; ++c)
+									row[c] += value * B(j, c);
+							});
+							for (index_t c = 0; c < k; ++c)
+								result(i, c) = row[c];
+						}
+					}
+					return;
+				}
+
+				std::fill_n(result.matrix, result.size(), T(0));
+#pragma omp parallel
+				{
+					// row-major accumulator, rows of B are scattered into it
+					std::vector<T> local(int64_t(num_cols) * k, T(0));
+					std::vector<T> row(k);
+#pragma omp for
+					for (index_t i = 0; i < num_rows; ++i)
+					{
+						for (index_t c = 0; c < k; ++c)
+							row[c] = B(i, c);
+						for_each_entry(A, i, [&](index_t j, T value) {
+							T* dst = local.data() + int64_t(j) * k;
+							for (index_t c = 0; c < k; ++c)
+								dst[c] += value * row[c];
+						});
+					}
+#pragma omp critical
+					for (index_t j = 0; j < num_cols; ++j)
+					{
+						for (index_t c = 0; c < k; ++c)
+							result(j, c) += local[int64_t(j) * k + c];
+					}
+				}
+			}
+
+			template <typename T, typename SparseA, typename SparseB>
+			void sparse_gram_matrix(
+			    const SparseA& A, const SparseB& B, SGMatrix<T>& result)
+			{
+				auto num_rows_a = sparse_num_rows(A);
+				auto num_rows_b = sparse_num_rows(B);
+				auto dim = std::max(sparse_num_cols(A), sparse_num_cols(B));
+				require(
+				    result.num_rows == num_rows_a &&
+				        result.num_cols == num_rows_b,
+				    "Result matrix must be {} x {}, but is {} x {}",
+				    num_rows_a, num_rows_b, result.num_rows, result.num_cols);
+
+				// index the entries of B by feature, i.e. transpose B
+				std::vector<index_t> indptr(dim + 1, 0);
+				for (index_t i = 0; i < num_rows_b; ++i)
+					for_each_entry(B, i, [&](index_t j, T) { ++indptr[j + 1]; });
+				for (index_t j = 0; j < dim; ++j)
+					indptr[j + 1] += indptr[j];
+
+				std::vector<index_t> rows(indptr[dim]);
+				std::vector<T> values(indptr[dim]);
+				std::vector<index_t> next(indptr.begin(), indptr.end() - 1);
+				for (index_t i = 0; i < num_rows_b; ++i)
+				{
+					for_each_entry(B, i, [&](index_t j, T value) {
+						rows[next[j]] = i;
+						values[next[j]++] = value;
+					});
+				}
+
+				// every row of A is accumulated against all rows of B at once
+#pragma omp parallel
+				{
+					std::vector<T> acc(num_rows_b);
+#pragma omp for schedule(dynamic, 16)
+					for (index_t i = 0; i < num_rows_a; ++i)
+					{
+						std::fill(acc.begin(), acc.end(), T(0));
+						for_each_entry(A, i, [&](index_t j, T a) {
+							for (index_t k = indptr[j]; k < indptr[j + 1]; ++k)
+								acc[rows[k]] += a * values[k];
+						});
+						for (index_t l = 0; l < num_rows_b; ++l)
+							result(i, l) = acc[l];
+					}
+				}
+			}
+		} // namespace internal
+
+		/** Performs the operation result = A * x (or A^T * x) for a sparse
+		 * matrix A whose rows are the sparse vectors.
+		 *
+		 * User should pass an appropriately pre-allocated result vector.
+		 *
+		 * @param A sparse matrix, num_vectors x num_features
+		 * @param x dense vector
+		 * @param result result vector
+		 * @param transpose whether to multiply with the transpose of A
+		 */
+		template <typename T>
+		void matrix_prod(
+		    const SGSparseMatrix<T>& A, const SGVector<T>& x,
+		    SGVector<T>& result, bool transpose = false)
+		{
+			internal::sparse_matrix_prod(A, x, result, transpose);
+		}
+
+		/** Performs the operation A * x (or A^T * x) for a sparse matrix A
+		 * whose rows are the sparse vectors.
+		 *
+		 * @param A sparse matrix, num_vectors x num_features
+		 * @param x dense vector
+		 * @param transpose whether to multiply with the transpose of A
+		 * @return result vector
+		 */
+		template <typename T>
+		SGVector<T> matrix_prod(
+		    const SGSparseMatrix<T>& A, const SGVector<T>& x,
+		    bool transpose = false)
+		{
+			SGVector<T> result(transpose ? A.num_features : A.num_vectors);
+			matrix_prod(A, x, result, transpose);
+			return result;
+		}
+
+		/** Performs the operation A * x (or A^T * x) where the rows of A are
+		 * the vectors of sparse features, i.e. computes the dot products of
+		 * all vectors with x (or the weighted sum of the vectors).
+		 *
+		 * @param A sparse features, possibly with subset
+		 * @param x dense vector
+		 * @param transpose whether to multiply with the transpose of A
+		 * @return result vector
+		 */
+		template <typename T>
+		SGVector<T> matrix_prod(
+		    const std::shared_ptr<SparseFeatures<T>>& A, const SGVector<T>& x,
+		    bool transpose = false)
+		{
+			SGVector<T> result(
+			    transpose ? A->get_num_features() : A->get_num_vectors());
+			internal::sparse_matrix_prod(*A, x, result, transpose);
+			return result;
+		}
+
+		/** Performs the operation result = A * B (or A^T * B) for a sparse
+		 * matrix A whose rows are the sparse vectors and a dense matrix B.
+		 *
+		 * User should pass an appropriately pre-allocated result matrix.
+		 *
+		 * @param A sparse matrix, num_vectors x num_features
+		 * @param B dense matrix
+		 * @param result result matrix
+		 * @param transpose_A whether to multiply with the transpose of A
+		 */
+		template <typename T>
+		void matrix_prod(
+		    const SGSparseMatrix<T>& A, const SGMatrix<T>& B,
+		    SGMatrix<T>& result, bool transpose_A = false)
+		{
+			internal::sparse_matrix_prod(A, B, result, transpose_A);
+		}
+
+		/** Performs the operation A * B (or A^T * B) for a sparse matrix A
+		 * whose rows are the sparse vectors and a dense matrix B.
+		 *
+		 * @param A sparse matrix, num_vectors x num_features
+		 * @param B dense matrix
+		 * @param transpose_A whether to multiply with the transpose of A
+		 * @return result matrix
+		 */
+		template <typename T>
+		SGMatrix<T> matrix_prod(
+		    const SGSparseMatrix<T>& A, const SGMatrix<T>& B,
+		    bool transpose_A = false)
+		{
+			SGMatrix<T> result(
+			    transpose_A ? A.num_features : A.num_vectors, B.num_cols);
+			matrix_prod(A, B, result, transpose_A);
+			return result;
+		}
+
+		/** Performs the operation A * B (or A^T * B) where the rows of A are
+		 * the vectors of sparse features and B is a dense matrix.
+		 *
+		 * @param A sparse features, possibly with subset
+		 * @param B dense matrix
+		 * @param transpose_A whether to multiply with the transpose of A
+		 * @return result matrix
+		 */
+		template <typename T>
+		SGMatrix<T> matrix_prod(
+		    const std::shared_ptr<SparseFeatures<T>>& A, const SGMatrix<T>& B,
+		    bool transpose_A = false)
+		{
+			SGMatrix<T> result(
+			    transpose_A ? A->get_num_features() : A->get_num_vectors(),
+			    B.num_cols);
+			internal::sparse_matrix_prod(*A, B, result, transpose_A);
+			return result;
+		}
+
+		/** Computes the matrix of dot products between the sparse vectors
+		 * of A and B, i.e. A * B^T, without densifying either of them.
+		 *
+		 * @param A sparse matrix, num_vectors_a x num_features
+		 * @param B sparse matrix, num_vectors_b x num_features
+		 * @return dense num_vectors_a x num_vectors_b matrix
+		 */
+		template <typename T>
+		SGMatrix<T>
+		gram_matrix(const SGSparseMatrix<T>& A, const SGSparseMatrix<T>& B)
+		{
+			SGMatrix<T> result(A.num_vectors, B.num_vectors);
+			internal::sparse_gram_matrix(A, B, result);
+			return result;
+		}
+
+		/** Computes the matrix of dot products between the vectors of two
+		 * sparse features, e.g. the linear kernel matrix.
+		 *
+		 * @param A sparse features, possibly with subset
+		 * @param B sparse features, possibly with subset
+		 * @return dense num_vectors(A) x num_vectors(B) matrix
+		 */
+		template <typename T>
+		SGMatrix<T> gram_matrix(
+		    const std::shared_ptr<SparseFeatures<T>>& A,
+		    const std::shared_ptr<SparseFeatures<T>>& B)
+		{
+			SGMatrix<T> result(A->get_num_vectors(), B->get_num_vectors());
+			internal::sparse_gram_matrix(*A, *B, result);
+			return result;
+		}
+	} // namespace linalg
+} // namespace shogun
+
+#endif // LINALG_SPARSE_H_
@@ -8,6 +8,7 @@
 #include <shogun/lib/SGVector.h>
 #include <shogun/lib/SGSparseMatrix.h>
 #include <shogun/lib/SGSparseVector.h>
+#include <shogun/mathematics/linalg/LinalgSparse.h>
 #include <shogun/mathematics/linalg/linop/SparseMatrixOperator.h>
 #include <shogun/mathematics/eigen3.h>
 
@@ -213,7 +214,7 @@ SGVector<T> SparseMatrixOperator<T>::apply(SGVector<T> b) const
 			"number of cols of the operator!");
 
 		SGVector<T> result(m_operator.num_vectors);
-		result=m_operator*b;
+		linalg::matrix_prod(m_operator, b, result);
 
 		return result;
 	}
@@ -5,13 +5,16 @@
  *          Thoralf Klein, Bjoern Esser
  */
 
+#include <shogun/base/ShogunEnv.h>
 #include <shogun/base/progress.h>
 #include <shogun/features/Features.h>
 #include <shogun/labels/Labels.h>
 #include <shogun/labels/MulticlassLabels.h>
 #include <shogun/labels/RegressionLabels.h>
 #include <shogun/lib/Signal.h>
+#include <shogun/lib/View.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/ScatterMatrix.h>
 #include <shogun/multiclass/GaussianNaiveBayes.h>
 
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
@@ -102,56 +105,39 @@ bool GaussianNaiveBayes::train_machine(std::shared_ptr<Features> data)
 	m_label_prob.zero();
 	m_rates.zero();
 
-	// number of iterations in all cycles
-	int32_t max_progress = 2 * train_labels.vlen + 2 * m_num_classes;
-
-	// Progress bar
-	auto pb = SG_PROGRESS(range(max_progress));
-
-	// get sum of features among labels
-	for (i=0; i<train_labels.vlen; i++)
+	// get means and squared residuals of features of labels in one pass,
+	// chunk by chunk to report progress and allow cancelling in between
+	const index_t num_vectors = train_labels.vlen;
+	const index_t chunk_size = ScatterMatrix<float64_t>::block_size *
+	                           env()->get_num_threads() * 4;
+	const index_t num_chunks = (num_vectors + chunk_size - 1) / chunk_size;
+	ScatterMatrix<float64_t> scatter;
+	for (auto chunk : SG_PROGRESS(range(num_chunks)))
 	{
-		SGVector<float64_t> fea = m_features->get_computed_dot_feature_vector(i);
-		for (j=0; j<m_dim; j++)
-			m_means(j, train_labels.vector[i]) += fea.vector[j];
-
-		m_label_prob.vector[train_labels.vector[i]]+=1.0;
-
-		pb.print_progress();
+		auto begin = chunk * chunk_size;
+		auto end = std::min(begin + chunk_size, num_vectors);
+		SGVector<index_t> subset(end - begin);
+		subset.range_fill(begin);
+		scatter.merge(ScatterMatrix<float64_t>(
+		    *view(m_features, subset),
+		    SGVector<int32_t>(train_labels.vector, end - begin, begin),
+		    m_num_classes, true));
+		COMPUTATION_CONTROLLERS
 	}
 
-	// get means of features of labels
 	for (i=0; i<m_num_classes; i++)
 	{
-		for (j=0; j<m_dim; j++)
-			m_means(j, i) /= m_label_prob.vector[i];
-		pb.print_progress();
-	}
-
-	// compute squared residuals with means available
-	for (i=0; i<train_labels.vlen; i++)
-	{
-		SGVector<float64_t> fea = m_features->get_computed_dot_feature_vector(i);
-		for (j=0; j<m_dim; j++)
-		{
-			m_variances(j, train_labels.vector[i]) +=
-				Math::sq(fea[j]-m_means(j, train_labels.vector[i]));
-		}
-		pb.print_progress();
-	}
+		m_means.set_column(i, scatter.get_mean(i));
+		m_label_prob.vector[i] = scatter.get_count(i);
 
-	// get variance of features of labels
-	for (i=0; i<m_num_classes; i++)
-	{
+		// get variance of features of labels
+		SGVector<float64_t> residuals = scatter.get_scatter_diagonal(i);
 		for (j=0; j<m_dim; j++)
-			m_variances(j, i) /= m_label_prob.vector[i] > 1 ? m_label_prob.vector[i]-1 : 1;
+			m_variances(j, i) = residuals[j] / (m_label_prob.vector[i] > 1 ? m_label_prob.vector[i]-1 : 1);
 
 		// get a priori probabilities of labels
 		m_label_prob.vector[i]/= m_num_classes;
-
-		pb.print_progress();
 	}
-	pb.complete();
 
 	return true;
 }
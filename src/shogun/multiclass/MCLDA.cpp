@@ -14,9 +14,11 @@
 #include <shogun/labels/Labels.h>
 #include <shogun/labels/MulticlassLabels.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/ScatterMatrix.h>
 
 #include <shogun/mathematics/eigen3.h>
 
+#include <algorithm>
 #include <utility>
 
 using namespace shogun;
@@ -179,30 +181,13 @@ bool MCLDA::train_machine(std::shared_ptr<Features> data)
 	if (num_vec != train_labels.vlen)
 		error("Dimension mismatch between features and labels in MCLDA training");
 
-	int32_t* class_idxs = SG_MALLOC(int32_t, num_vec*m_num_classes);
-	int32_t* class_nums = SG_MALLOC(int32_t, m_num_classes); // number of examples of each class
-	memset(class_nums, 0, m_num_classes*sizeof(int32_t));
-
-	for (int i = 0; i < train_labels.vlen; i++)
-	{
-		int32_t class_idx = train_labels.vector[i];
-
-		if (class_idx < 0 || class_idx >= m_num_classes)
-		{
-			error(
-			    "Label {} with value {} is out of {0, 1, 2, ..., "
-			    "num_classes-1}, where num_classes is {}",
-			    i, class_idx, m_num_classes);
-			return false;
-		}
-		else
-		{
-			class_idxs[ class_idx*num_vec + class_nums[class_idx]++ ] = i;
-		}
-	}
+	// means and scatter matrices of all classes in one pass over the data
+	ScatterMatrix<float64_t> scatter(*m_features, train_labels, m_num_classes);
+	SGVector<int32_t> class_nums(m_num_classes); // number of examples of each class
 
 	for (int i = 0; i < m_num_classes; i++)
 	{
+		class_nums[i] = scatter.get_count(i);
 		if (class_nums[i] <= 0)
 		{
 			error("What? One class with no elements");
@@ -210,79 +195,24 @@ bool MCLDA::train_machine(std::shared_ptr<Features> data)
 		}
 	}
 
-	auto rf = m_features->as<DenseFeatures<float64_t>>();
-
-	// if ( m_store_cov )
-		index_t * cov_dims = SG_MALLOC(index_t, 3);
-		cov_dims[0] = m_dim;
-		cov_dims[1] = m_dim;
-		cov_dims[2] = m_num_classes;
-		SGNDArray< float64_t > covs(cov_dims, 3);
-
 	m_means = SGMatrix< float64_t >(m_dim, m_num_classes, true);
-
-	// matrix of all samples
-	MatrixXd X =  MatrixXd::Zero(num_vec, m_dim);
-	int32_t iX = 0;
-
-	m_means.zero();
-
-	int32_t vlen;
-	bool vfree;
-	float64_t* vec;
 	for (int k = 0; k < m_num_classes; k++)
-	{
-		// gather all the samples for class k into buffer and calculate the mean of class k
-		MatrixXd buffer(class_nums[k], m_dim);
-		Map< VectorXd > Em_mean(m_means.get_column_vector(k), m_dim);
-		for (int i = 0; i < class_nums[k]; i++)
-		{
-			vec = rf->get_feature_vector(class_idxs[k*num_vec + i], vlen, vfree);
-			ASSERT(vec)
-
-			Map< VectorXd > Evec(vec, vlen);
-			Em_mean += Evec;
-			buffer.row(i) = Evec;
-
-			rf->free_feature_vector(vec, class_idxs[k*num_vec + i], vfree);
-		}
-
-		Em_mean /= class_nums[k];
-
-		// subtract the mean of class k from each sample of class k and store the centered data in Xc
-		for (int i = 0; i < class_nums[k]; i++)
-		{
-			buffer.row(i) -= Em_mean;
-			X.row(iX) += buffer.row(i);
-			iX++;
-		}
-
-		if (m_store_cov)
-		{
-			// calc cov = buffer.T * buffer
-			Map< MatrixXd > Em_cov_k(covs.get_matrix(k), m_dim, m_dim);
-			Em_cov_k = buffer.transpose() * buffer;
-		}
-	}
+		m_means.set_column(k, scatter.get_mean(k));
 
 #ifdef DEBUG_MCLDA
 	io::print("\n>>> Displaying means ...\n");
 	SGMatrix< float64_t >::display_matrix(m_means.matrix, m_dim, m_num_classes);
 #endif
 
+	// scatter of the data centered with the mean of its class
+	SGMatrix< float64_t > within = scatter.get_within_scatter();
+	Map< MatrixXd > Em_within(within.matrix, m_dim, m_dim);
+
 	if (m_store_cov)
 	{
 		m_cov = SGMatrix< float64_t >(m_dim, m_dim, true);
-		m_cov.zero();
 		Map< MatrixXd > Em_cov(m_cov.matrix, m_dim, m_dim);
-
-		for (int k = 0; k < m_num_classes; k++)
-		{
-			Map< MatrixXd > Em_cov_k(covs.get_matrix(k), m_dim, m_dim);
-			Em_cov += Em_cov_k;
-		}
-
-		Em_cov /= m_num_classes;
+		Em_cov = Em_within / m_num_classes;
 	}
 
 #ifdef DEBUG_MCLDA
@@ -296,16 +226,12 @@ bool MCLDA::train_machine(std::shared_ptr<Features> data)
 	///////////////////////////////////////////////////////////
 	// 1) within (univariate) scaling by with classes std-dev
 
-	// std-dev of X
+	// the centered data has zero mean
 	m_xbar = SGVector< float64_t >(m_dim);
 	m_xbar.zero();
 	Map< VectorXd > Em_xbar(m_xbar.vector, m_dim);
-	Em_xbar = X.colwise().sum();
-	Em_xbar /= num_vec;
 
-	VectorXd std = VectorXd::Zero(m_dim);
-	std = (X.rowwise() - Em_xbar.transpose()).array().pow(2).colwise().sum();
-	std = std.array() / num_vec;
+	VectorXd std = Em_within.diagonal() / num_vec;
 
 	for (int j = 0; j < m_dim; j++)
 		if(std[j] == 0)
@@ -323,19 +249,21 @@ bool MCLDA::train_machine(std::shared_ptr<Features> data)
 
 	///////////////////////////////
 	// 2) Within variance scaling
-	for (int i = 0; i < num_vec; i++)
-		X.row(i) = sqrt(fac) * X.row(i).array() / std.transpose().array();
 
-
-	// SVD of centered (within)scaled data
+	// SVD of centered (within)scaled data X, computed from the eigenvalue
+	// decomposition of X'X, which is the scaled within scatter matrix
 	VectorXd S(m_dim);
 	MatrixXd V(m_dim, m_dim);
 
-	Eigen::JacobiSVD<MatrixXd> eSvd;
-	eSvd.compute(X,Eigen::ComputeFullV);
-	sg_memcpy(S.data(), eSvd.singularValues().data(), m_dim*sizeof(float64_t));
-	sg_memcpy(V.data(), eSvd.matrixV().data(), m_dim*m_dim*sizeof(float64_t));
-	V.transposeInPlace();
+	MatrixXd XtX = fac * std.cwiseInverse().asDiagonal() * Em_within *
+	               std.cwiseInverse().asDiagonal();
+	Eigen::SelfAdjointEigenSolver<MatrixXd> eEig(XtX);
+	for (int j = 0; j < m_dim; j++)
+	{
+		// singular values in decreasing order
+		S[j] = std::sqrt(std::max(eEig.eigenvalues()[m_dim - 1 - j], 0.0));
+		V.row(j) = eEig.eigenvectors().col(m_dim - 1 - j).transpose();
+	}
 
 	int rank = 0;
 	while (rank < m_dim && S[rank] > m_tolerance)
@@ -373,6 +301,7 @@ bool MCLDA::train_machine(std::shared_ptr<Features> data)
 	S = VectorXd(rank);
 	V = MatrixXd(rank, rank);
 
+	Eigen::JacobiSVD<MatrixXd> eSvd;
 	eSvd.compute(Xc,Eigen::ComputeFullV);
 	sg_memcpy(S.data(), eSvd.singularValues().data(), rank*sizeof(float64_t));
 	sg_memcpy(V.data(), eSvd.matrixV().data(), rank*rank*sizeof(float64_t));
@@ -417,9 +346,6 @@ bool MCLDA::train_machine(std::shared_ptr<Features> data)
 	SGVector< float64_t >::display_vector(m_intercept.vector, m_num_classes);
 #endif
 
-	SG_FREE(class_idxs);
-	SG_FREE(class_nums);
-
 	return true;
 }
 
@@ -63,6 +63,21 @@ SGVector<int32_t> MulticlassStrategy::train_prepare_next()
 	return SGVector<int32_t>();
 }
 
+SGVector<int32_t> MulticlassStrategy::decide_labels(const SGMatrix<float64_t>& outputs)
+{
+	SGVector<int32_t> labels(outputs.num_cols);
+
+#pragma omp parallel for
+	for (index_t i=0; i<outputs.num_cols; ++i)
+	{
+		SGVector<float64_t> output_for_i(
+			outputs.get_column_vector(i), outputs.num_rows, false);
+		labels[i] = decide_label(output_for_i);
+	}
+
+	return labels;
+}
+
 void MulticlassStrategy::train_stop()
 {
 
@@ -70,3 +85,31 @@ void MulticlassStrategy::train_stop()
     m_train_labels = NULL;
     m_orig_labels = NULL;
 }
+
+std::vector<MulticlassStrategy::TrainTask> MulticlassStrategy::train_tasks(
+    const std::shared_ptr<MulticlassLabels>& orig_labels)
+{
+	auto train_labels =
+	    std::make_shared<BinaryLabels>(orig_labels->get_num_labels());
+
+	std::vector<TrainTask> tasks;
+	train_start(orig_labels, train_labels);
+	while (train_has_more())
+	{
+		TrainTask task;
+		task.subset = train_prepare_next();
+
+		// labels are overwritten by the next phase, so they are copied
+		if (task.subset.vlen)
+			train_labels->add_subset(task.subset);
+		task.labels =
+		    std::make_shared<BinaryLabels>(train_labels->get_labels_copy());
+		if (task.subset.vlen)
+			train_labels->remove_subset();
+
+		tasks.push_back(std::move(task));
+	}
+	train_stop();
+
+	return tasks;
+}
@@ -103,11 +103,39 @@ public:
 	/** finish training, release resources */
 	virtual void train_stop();
 
+#ifndef SWIG
+	/** @brief Binary training problem of one machine, independent of
+	 * the problems of the other machines.
+	 */
+	struct TrainTask
+	{
+		/** vectors to train on, empty for all vectors */
+		SGVector<int32_t> subset;
+		/** labels of the vectors to train on */
+		std::shared_ptr<BinaryLabels> labels;
+	};
+
+	/** prepare all training phases at once, so that the machines can be
+	 * trained concurrently. Runs a whole training pass of the strategy.
+	 *
+	 * @param orig_labels original multiclass labels
+	 * @return one task per machine, in order of the machines
+	 */
+	std::vector<TrainTask>
+	train_tasks(const std::shared_ptr<MulticlassLabels>& orig_labels);
+#endif
+
 	/** decide the final label.
 	 * @param outputs a vector of output from each machine (in that order)
 	 */
 	virtual int32_t decide_label(SGVector<float64_t> outputs)=0;
 
+	/** decide the final labels of many vectors at once.
+	 * @param outputs outputs of each machine (rows) for each vector (columns)
+	 * @return label of each vector
+	 */
+	virtual SGVector<int32_t> decide_labels(const SGMatrix<float64_t>& outputs);
+
 	/** decide the final label.
 	 * @param outputs a vector of output from each machine (in that order)
 	 * @param n_outputs number of outputs
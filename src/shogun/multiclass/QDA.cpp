@@ -15,9 +15,11 @@
 #include <shogun/labels/Labels.h>
 #include <shogun/labels/MulticlassLabels.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/ScatterMatrix.h>
 
 #include <shogun/mathematics/eigen3.h>
 
+#include <algorithm>
 #include <utility>
 
 using namespace shogun;
@@ -200,28 +202,13 @@ bool QDA::train_machine(std::shared_ptr<Features> data)
 	if (num_vec != train_labels.vlen)
 		error("Dimension mismatch between features and labels in QDA training");
 
-	int32_t* class_idxs = SG_MALLOC(int32_t, num_vec*m_num_classes); // number of examples of each class
-	int32_t* class_nums = SG_MALLOC(int32_t, m_num_classes);
-	memset(class_nums, 0, m_num_classes*sizeof(int32_t));
-	int32_t class_idx;
-
-	for (int i = 0; i < train_labels.vlen; i++)
-	{
-		class_idx = train_labels.vector[i];
-
-		if (class_idx < 0 || class_idx >= m_num_classes)
-		{
-			error("found label out of {0, 1, 2, ..., num_classes-1}...");
-			return false;
-		}
-		else
-		{
-			class_idxs[ class_idx*num_vec + class_nums[class_idx]++ ] = i;
-		}
-	}
+	// means and scatter matrices of all classes in one pass over the data
+	ScatterMatrix<float64_t> scatter(*m_features, train_labels, m_num_classes);
+	SGVector<int32_t> class_nums(m_num_classes); // number of examples of each class
 
 	for (int i = 0; i < m_num_classes; i++)
 	{
+		class_nums[i] = scatter.get_count(i);
 		if (class_nums[i] <= 0)
 		{
 			error("What? One class with no elements");
@@ -249,55 +236,32 @@ bool QDA::train_machine(std::shared_ptr<Features> data)
 	rot_dims[2] = m_num_classes;
 	SGNDArray< float64_t > rotations = SGNDArray< float64_t >(rot_dims, 3);
 
-	auto rf = m_features->as<DenseFeatures<float64_t>>();
-
-	m_means.zero();
-
-	SGVector<float64_t> vec;
 	for (int k = 0; k < m_num_classes; k++)
 	{
-		MatrixXd buffer(class_nums[k], m_dim);
-		Map< VectorXd > Em_means(m_means.get_column_vector(k), m_dim);
-		for (int i = 0; i < class_nums[k]; i++)
-		{
-			vec = rf->get_feature_vector(class_idxs[k*num_vec + i]);
-			ASSERT(vec.vector)
-
-			SGVector<float64_t>::EigenVectorXtMap Evec = vec;
-			Em_means += Evec;
-			buffer.row(i) = Evec;
-
-			rf->free_feature_vector(vec, class_idxs[k*num_vec + i]);
-		}
-
-		Em_means /= class_nums[k];
+		m_means.set_column(k, scatter.get_mean(k));
 
-		for (int i = 0; i < class_nums[k]; i++)
-			buffer.row(i) -= Em_means;
+		// the squared singular values and right singular vectors of the
+		// centered data of class k are the eigenvalues and eigenvectors of
+		// its scatter matrix
+		SGMatrix<float64_t> scatter_k = scatter.get_scatter(k);
+		Eigen::SelfAdjointEigenSolver<MatrixXd> eEig(
+		    Map<MatrixXd>(scatter_k.matrix, m_dim, m_dim));
 
-		// SVD
 		float64_t * col = scalings.get_column_vector(k);
-		float64_t * rot_mat = rotations.get_matrix(k);
-
-		Eigen::JacobiSVD<MatrixXd> eSvd;
-		eSvd.compute(buffer,Eigen::ComputeFullV);
-		sg_memcpy(col, eSvd.singularValues().data(), m_dim*sizeof(float64_t));
-		sg_memcpy(rot_mat, eSvd.matrixV().data(), m_dim*m_dim*sizeof(float64_t));
+		Map<MatrixXd> rot_mat(rotations.get_matrix(k), m_dim, m_dim);
+		for (int j = 0; j < m_dim; j++)
+		{
+			// in decreasing order
+			col[j] = std::max(eEig.eigenvalues()[m_dim - 1 - j], 0.0);
+			rot_mat.col(j) = eEig.eigenvectors().col(m_dim - 1 - j);
+		}
 
-		SGVector<float64_t>::vector_multiply(col, col, col, m_dim);
 		SGVector<float64_t>::scale_vector(1.0/(class_nums[k]-1), col, m_dim);
 
 		if (m_store_covs)
 		{
-			SGMatrix< float64_t > M(m_dim ,m_dim);
-			MatrixXd MEig = Map<MatrixXd>(rot_mat,m_dim,m_dim);
-			for (int i = 0; i < m_dim; i++)
-				for (int j = 0; j < m_dim; j++)
-					M(i,j)*=scalings[k*m_dim + j];
-			MatrixXd rotE = Map<MatrixXd>(rot_mat,m_dim,m_dim);
-			MatrixXd resE(m_dim,m_dim);
-			resE = MEig * rotE.transpose();
-			sg_memcpy(m_covs.get_matrix(k),resE.data(),m_dim*m_dim*sizeof(float64_t));
+			Map<MatrixXd> cov(m_covs.get_matrix(k), m_dim, m_dim);
+			cov = Map<MatrixXd>(scatter_k.matrix, m_dim, m_dim) / (class_nums[k] - 1);
 		}
 	}
 
@@ -328,7 +292,5 @@ bool QDA::train_machine(std::shared_ptr<Features> data)
 	}
 
 
-	SG_FREE(class_idxs);
-	SG_FREE(class_nums);
 	return true;
 }
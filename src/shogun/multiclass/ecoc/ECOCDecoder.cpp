@@ -23,3 +23,12 @@ SGVector<float64_t> ECOCDecoder::binarize(const SGVector<float64_t> query)
     return bquery;
 }
 
+SGVector<int32_t> ECOCDecoder::decide_labels(const SGMatrix<float64_t>& outputs, const SGMatrix<int32_t>& codebook)
+{
+    // decoders may cache data of the codebook, so this is sequential
+    SGVector<int32_t> labels(outputs.num_cols);
+    for (int32_t i=0; i < outputs.num_cols; ++i)
+        labels[i] = decide_label(outputs.get_column(i), codebook);
+
+    return labels;
+}
@@ -43,6 +43,13 @@ public:
      */
     virtual int32_t decide_label(const SGVector<float64_t> outputs, const SGMatrix<int32_t> codebook)=0;
 
+    /** decide labels of many vectors.
+     * @param outputs outputs by classifiers, one column per vector
+     * @param codebook ECOC codebook
+     * @return label of each vector
+     */
+    virtual SGVector<int32_t> decide_labels(const SGMatrix<float64_t>& outputs, const SGMatrix<int32_t>& codebook);
+
 protected:
     /** turn 2-class labels into binary */
     SGVector<float64_t> binarize(const SGVector<float64_t> query);
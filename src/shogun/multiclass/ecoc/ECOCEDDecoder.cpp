@@ -0,0 +1,51 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/mathematics/linalg/LinalgNamespace.h>
+#include <shogun/multiclass/ecoc/ECOCEDDecoder.h>
+
+using namespace shogun;
+
+SGVector<int32_t> ECOCEDDecoder::decide_labels(const SGMatrix<float64_t>& outputs, const SGMatrix<int32_t>& codebook)
+{
+    require(outputs.num_rows == codebook.num_rows,
+            "Number of outputs ({}) does not match code length ({})",
+            outputs.num_rows, codebook.num_rows);
+
+    // |q-b|^2 = |q|^2 - 2 q'b + |b|^2, where |q|^2 does not change the
+    // closest code of a vector
+    SGMatrix<float64_t> codes(codebook.num_rows, codebook.num_cols);
+    SGVector<float64_t> code_norms(codebook.num_cols);
+    for (int32_t j=0; j < codebook.num_cols; ++j)
+    {
+        code_norms[j] = 0;
+        for (int32_t k=0; k < codebook.num_rows; ++k)
+        {
+            codes(k, j) = codebook(k, j);
+            code_norms[j] += codes(k, j) * codes(k, j);
+        }
+    }
+
+    auto products = linalg::matrix_prod(codes, outputs, true, false);
+
+    SGVector<int32_t> labels(outputs.num_cols);
+#pragma omp parallel for
+    for (int32_t i=0; i < outputs.num_cols; ++i)
+    {
+        int32_t best = 0;
+        float64_t best_distance = code_norms[0] - 2 * products(0, i);
+        for (int32_t j=1; j < codebook.num_cols; ++j)
+        {
+            float64_t distance = code_norms[j] - 2 * products(j, i);
+            if (distance < best_distance)
+            {
+                best = j;
+                best_distance = distance;
+            }
+        }
+        labels[i] = best;
+    }
+
+    return labels;
+}
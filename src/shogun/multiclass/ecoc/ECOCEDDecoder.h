@@ -33,6 +33,14 @@ public:
     /** get name */
     const char* get_name() const override { return "ECOCEDDecoder"; }
 
+    /** decide labels of many vectors, with the distances to all codes
+     * computed by one matrix product.
+     * @param outputs outputs by classifiers, one column per vector
+     * @param codebook ECOC codebook
+     * @return label of each vector
+     */
+    SGVector<int32_t> decide_labels(const SGMatrix<float64_t>& outputs, const SGMatrix<int32_t>& codebook) override;
+
 
 protected:
     /** whether to turn the output into binary before decoding */
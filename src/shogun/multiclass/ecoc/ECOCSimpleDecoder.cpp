@@ -23,3 +23,17 @@ int32_t ECOCSimpleDecoder::decide_label(const SGVector<float64_t> outputs, const
     int32_t result = Math::arg_min(distances.vector, 1, distances.vlen);
     return result;
 }
+
+SGVector<int32_t> ECOCSimpleDecoder::decide_labels(const SGMatrix<float64_t>& outputs, const SGMatrix<int32_t>& codebook)
+{
+    SGVector<int32_t> labels(outputs.num_cols);
+
+#pragma omp parallel for
+    for (int32_t i=0; i < outputs.num_cols; ++i)
+    {
+        SGVector<float64_t> output(outputs.get_column_vector(i), outputs.num_rows, false);
+        labels[i] = decide_label(output, codebook);
+    }
+
+    return labels;
+}
@@ -37,6 +37,13 @@ public:
      */
     int32_t decide_label(const SGVector<float64_t> outputs, const SGMatrix<int32_t> codebook) override;
 
+    /** decide labels of many vectors in parallel.
+     * @param outputs outputs by classifiers, one column per vector
+     * @param codebook ECOC codebook
+     * @return label of each vector
+     */
+    SGVector<int32_t> decide_labels(const SGMatrix<float64_t>& outputs, const SGMatrix<int32_t>& codebook) override;
+
 protected:
     /** whether to turn the output into binary before decoding */
     virtual bool binary_decoding()=0;
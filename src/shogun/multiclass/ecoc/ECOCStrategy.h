@@ -51,6 +51,11 @@ public:
      */
     int32_t decide_label(SGVector<float64_t> outputs) override;
 
+    /** decide the final labels of many vectors with the decoder.
+     * @param outputs outputs of each machine (rows) for each vector (columns)
+     */
+    SGVector<int32_t> decide_labels(const SGMatrix<float64_t>& outputs) override;
+
     /** get number of machines used in this strategy.
      */
     int32_t get_num_machines() override;
@@ -29,6 +29,7 @@
  */
 
 #include <shogun/evaluation/MulticlassAccuracy.h>
+#include <shogun/lib/ScratchArena.h>
 #include <shogun/lib/View.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/Statistics.h>
@@ -234,6 +235,9 @@ std::shared_ptr<TreeMachineNode<C45TreeNodeData>> C45ClassifierTree::C45train(co
 	if (flag)
 		return node;
 
+	// per-node temporaries, released after the children are built
+	ScratchArena::Scope scratch;
+
 	// else get the feature with the highest informational gain. threshold is used for continuous features only.
 	float64_t max=0;
 	float64_t impurity = 0.0;
@@ -255,7 +259,8 @@ std::shared_ptr<TreeMachineNode<C45TreeNodeData>> C45ClassifierTree::C45train(co
 		}
 		else
 		{
-			SGVector<float64_t> feature_values(num_vecs);
+			ScratchArena::Scope feature_scratch;
+			auto feature_values = feature_scratch.vector<float64_t>(num_vecs);
 			float64_t max_value=Math::MIN_REAL_NUMBER;
 			for (int32_t k=0; k<num_vecs; k++)
 			{
@@ -265,13 +270,13 @@ std::shared_ptr<TreeMachineNode<C45TreeNodeData>> C45ClassifierTree::C45train(co
 					max_value=feature_values[k];
 			}
 
+			// temporary dense features to calculate gain (continuous->nominal conversion)
+			auto temp_feat_mat = feature_scratch.matrix<float64_t>(1, num_vecs);
 			for (int32_t k=0;k<num_vecs;k++)
 			{
 				if (feature_values[k]!=max_value && !Math::fequals(feature_values[k],MISSING,0))
 				{
-					// form temporary dense features to calculate gain (continuous->nominal conversion)
 					float64_t z=feature_values[k];
-					SGMatrix<float64_t> temp_feat_mat=SGMatrix<float64_t>(1,num_vecs);
 					for (int32_t l=0;l<num_vecs;l++)
 					{
 						if (Math::fequals(feature_values[l],MISSING,0))
@@ -298,7 +303,7 @@ std::shared_ptr<TreeMachineNode<C45TreeNodeData>> C45ClassifierTree::C45train(co
 	}
 
 	// feature cache for data restoration if feature is continuous
-	SGVector<float64_t> feature_cache(num_vecs);
+	auto feature_cache = scratch.vector<float64_t>(num_vecs);
 
 	// if continuous attribute - split feature values about threshold
 	if (!m_nominal[feature_id_vector[best_feature_index]])
@@ -318,7 +323,7 @@ std::shared_ptr<TreeMachineNode<C45TreeNodeData>> C45ClassifierTree::C45train(co
 	}
 
 	// get feature values for the best feature chosen - shorthand for the features values of the best feature chosen
-	SGVector<float64_t> best_feature_values(num_vecs);
+	auto best_feature_values = scratch.vector<float64_t>(num_vecs);
 	for (int32_t i=0; i<num_vecs; i++)
 		best_feature_values[i]=(feats->get_feature_vector(i))[best_feature_index];
 
@@ -334,7 +339,8 @@ std::shared_ptr<TreeMachineNode<C45TreeNodeData>> C45ClassifierTree::C45train(co
 		}
 	}
 
-	SGVector<float64_t> best_features_unique(num_vecs-num_missing);
+	auto best_features_unique =
+	    scratch.vector<float64_t>(num_vecs - num_missing);
 	int32_t index=0;
 	for (int32_t j=0;j<num_vecs;j++)
 	{
@@ -568,6 +574,7 @@ float64_t C45ClassifierTree::informational_gain_attribute(
 	float64_t gain=0;
 	auto feats=data->as<DenseFeatures<float64_t>>();
 	int32_t num_vecs=feats->get_num_vectors();
+	ScratchArena::Scope scratch;
 	SGVector<float64_t> gain_attribute_values;
 	SGVector<float64_t> gain_weights=weights;
 	auto gain_labels=class_labels;
@@ -581,15 +588,16 @@ float64_t C45ClassifierTree::informational_gain_attribute(
 
 	if (num_missing==0)
 	{
-		gain_attribute_values=SGVector<float64_t>(num_vecs);
+		gain_attribute_values = scratch.vector<float64_t>(num_vecs);
 		for (int32_t i=0; i<num_vecs; i++)
 			gain_attribute_values[i]=(feats->get_feature_vector(i))[attr_no];
 	}
 	else
 	{
-		gain_attribute_values=SGVector<float64_t>(num_vecs-num_missing);
-		gain_weights=SGVector<float64_t>(num_vecs-num_missing);
-		SGVector<float64_t> label_vector(num_vecs-num_missing);
+		gain_attribute_values =
+		    scratch.vector<float64_t>(num_vecs - num_missing);
+		gain_weights = scratch.vector<float64_t>(num_vecs - num_missing);
+		auto label_vector = scratch.vector<float64_t>(num_vecs - num_missing);
 		int32_t index=0;
 		for (int32_t i=0; i<num_vecs; i++)
 		{
@@ -607,7 +615,10 @@ float64_t C45ClassifierTree::informational_gain_attribute(
 
 	float64_t total_weight=gain_weights.sum(gain_weights.vector,gain_weights.vlen);
 
-	SGVector<float64_t> attr_val_unique=gain_attribute_values.clone();
+	auto attr_val_unique = scratch.vector<float64_t>(gain_attribute_values.vlen);
+	sg_memcpy(
+	    attr_val_unique.vector, gain_attribute_values.vector,
+	    gain_attribute_values.vlen * sizeof(float64_t));
 	int32_t uniques_num=attr_val_unique.unique(attr_val_unique.vector,attr_val_unique.vlen);
 
 	for (int32_t i=0; i<uniques_num; i++)
@@ -625,8 +636,9 @@ float64_t C45ClassifierTree::informational_gain_attribute(
 			}
 		}
 
-		SGVector<float64_t> sub_class(attr_count);
-		SGVector<float64_t> sub_weights(attr_count);
+		ScratchArena::Scope value_scratch;
+		auto sub_class = value_scratch.vector<float64_t>(attr_count);
+		auto sub_weights = value_scratch.vector<float64_t>(attr_count);
 		int32_t count=0;
 
 		for (int32_t j=0; j<num_vecs; j++)
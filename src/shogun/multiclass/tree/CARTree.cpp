@@ -30,6 +30,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <shogun/lib/ScratchArena.h>
 #include <shogun/lib/View.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/RandomNamespace.h>
@@ -293,7 +294,7 @@ bool CARTree::train_machine(std::shared_ptr<Features> data)
 	}
 
 	auto dense_labels = m_labels->as<DenseLabels>();
-	set_root(CARTtrain(dense_features,m_weights,dense_labels,0));
+	set_root(train_tree(dense_features, m_weights, dense_labels));
 
 	if (m_apply_cv_pruning)
 	{
@@ -322,6 +323,32 @@ void CARTree::set_sorted_features(SGMatrix<float64_t>& sorted_feats, SGMatrix<in
 	m_sorted_indices=sorted_indices;
 }
 
+std::shared_ptr<CARTree::bnode_t> CARTree::train_tree(
+    const std::shared_ptr<DenseFeatures<float64_t>>& data,
+    const SGVector<float64_t>& weights,
+    const std::shared_ptr<DenseLabels>& labels)
+{
+	require(
+	    m_mode == PT_MULTICLASS || m_mode == PT_REGRESSION,
+	    "mode should be either PT_MULTICLASS or PT_REGRESSION");
+
+	if (!train_in_parallel(data->get_num_vectors()))
+		return CARTtrain(data, weights, labels, 0);
+
+	// nodes and features of large nodes become tasks of one team
+	std::shared_ptr<bnode_t> root;
+#pragma omp parallel
+#pragma omp single
+	root = CARTtrain(data, weights, labels, 0);
+	return root;
+}
+
+bool CARTree::train_in_parallel(index_t num_vecs) const
+{
+	return supports_parallel_training() && m_min_parallel_node_size > 0 &&
+	       num_vecs >= m_min_parallel_node_size;
+}
+
 void CARTree::pre_sort_features(const std::shared_ptr<Features>& data, SGMatrix<float64_t>& sorted_feats, SGMatrix<index_t>& sorted_indices)
 {
 	SGMatrix<float64_t> mat=(data)->as<DenseFeatures<float64_t>>()->get_feature_matrix();
@@ -431,19 +458,22 @@ std::shared_ptr<BinaryTreeMachineNode<CARTreeNodeData>> CARTree::CARTtrain(std::
 		return node;
 	}
 
+	// per-node temporaries, released after the children are built
+	ScratchArena::Scope scratch;
+
 	// choose best attribute
 	// transit_into_values for left child
 	SGVector<float64_t> left(num_feats);
 	// transit_into_values for right child
 	SGVector<float64_t> right(num_feats);
 	// final data distribution among children
-	SGVector<bool> left_final(num_vecs);
+	auto left_final = scratch.vector<bool>(num_vecs);
 	int32_t num_missing_final=0;
 	int32_t c_left=-1;
 	int32_t c_right=-1;
 	int32_t best_attribute;
 
-	SGVector<index_t> indices(num_vecs);
+	auto indices = scratch.vector<index_t>(num_vecs);
 	if (m_pre_sort)
 	{
 		auto subset_stack = data->get_subset_stack();
@@ -488,10 +518,10 @@ std::shared_ptr<BinaryTreeMachineNode<CARTreeNodeData>> CARTree::CARTtrain(std::
 
 	index_t count_left=std::count(left_final.begin(), left_final.end(), true);
 
-	SGVector<index_t> subsetl(count_left);
-	SGVector<float64_t> weightsl(count_left);
-	SGVector<index_t> subsetr(num_vecs-count_left);
-	SGVector<float64_t> weightsr(num_vecs-count_left);
+	auto subsetl = scratch.vector<index_t>(count_left);
+	auto weightsl = scratch.vector<float64_t>(count_left);
+	auto subsetr = scratch.vector<index_t>(num_vecs - count_left);
+	auto weightsr = scratch.vector<float64_t>(num_vecs - count_left);
 	index_t l=0;
 	index_t r=0;
 	for (index_t c = 0; c < num_vecs; ++c)
@@ -508,17 +538,19 @@ std::shared_ptr<BinaryTreeMachineNode<CARTreeNodeData>> CARTree::CARTtrain(std::
 		}
 	}
 
+	// children of large nodes are built in parallel
+	bool parallel = train_in_parallel(num_vecs);
+
 	// left child
-	auto feats_train = view(data, subsetl);
-	auto labels_train = view(labels, subsetl);
-	auto left_child =
-	    CARTtrain(feats_train, weightsl, labels_train, level + 1);
+	std::shared_ptr<bnode_t> left_child;
+#pragma omp task shared(left_child) if (parallel)
+	left_child = CARTtrain(
+	    view(data, subsetl), weightsl, view(labels, subsetl), level + 1);
 
 	// right child
-	feats_train = view(data, subsetr);
-	labels_train = view(labels, subsetr);
-	auto right_child =
-	    CARTtrain(feats_train, weightsr, labels_train, level + 1);
+	auto right_child = CARTtrain(
+	    view(data, subsetr), weightsr, view(labels, subsetr), level + 1);
+#pragma omp taskwait
 
 	// set node parameters
 	node->data.attribute_id=best_attribute;
@@ -579,10 +611,11 @@ index_t CARTree::compute_best_attribute(
 	if (m_mode==PT_REGRESSION)
 		delta=m_label_epsilon;
 
-	SGVector<float64_t> total_wclasses(n_ulabels);
+	ScratchArena::Scope scratch;
+	auto total_wclasses = scratch.vector<float64_t>(n_ulabels);
 	linalg::zero(total_wclasses);
 
-	SGVector<index_t> simple_labels(num_vecs);
+	auto simple_labels = scratch.vector<index_t>(num_vecs);
 	for (index_t i=0;i<num_vecs;i++)
 	{
 		for (index_t j=0;j<n_ulabels;j++)
@@ -596,7 +629,7 @@ index_t CARTree::compute_best_attribute(
 		}
 	}
 
-	SGVector<index_t> idx(num_feats);
+	auto idx = scratch.vector<index_t>(num_feats);
 	linalg::range_fill(idx);
 	if (subset_size)
 	{
@@ -604,19 +637,14 @@ index_t CARTree::compute_best_attribute(
 		random::shuffle(idx, m_prng);
 	}
 
-	float64_t max_gain=MIN_SPLIT_GAIN;
-	float64_t max_impurity = MIN_SPLIT_GAIN;
-	index_t best_attribute=-1;
-	float64_t best_threshold=0;
-
 	SGVector<int64_t> indices_mask;
-	SGVector<index_t> count_indices(mat.num_rows);
+	auto count_indices = scratch.vector<index_t>(mat.num_rows);
 	count_indices.zero();
-	SGVector<index_t> dupes(num_vecs);
+	auto dupes = scratch.vector<index_t>(num_vecs);
 	linalg::range_fill(dupes);
 	if (m_pre_sort)
 	{
-		indices_mask = SGVector<int64_t>(mat.num_rows);
+		indices_mask = scratch.vector<int64_t>(mat.num_rows);
 		linalg::set_const(indices_mask, int64_t(-1));
 		for(index_t j=0;j<active_indices.size();++j)
 		{
@@ -628,12 +656,32 @@ index_t CARTree::compute_best_attribute(
 		}
 	}
 
-	for (index_t i=0;i<num_feats;++i)
-	{
-		SGVector<float64_t> feats(num_vecs);
-		SGVector<index_t> sorted_args(num_vecs);
-		SGVector<index_t> temp_count_indices(count_indices.size());
-		sg_memcpy(temp_count_indices.vector, count_indices.vector, sizeof(index_t)*count_indices.size());
+	auto split_gain = [&](
+	                      const SGVector<float64_t>& wleft,
+	                      const SGVector<float64_t>& wright,
+	                      const SGVector<float64_t>& wtotal,
+	                      float64_t& node_impurity) {
+		if (m_mode == PT_MULTICLASS)
+			return gain(wleft, wright, wtotal, node_impurity);
+		return gain(wleft, wright, wtotal, ulabels, node_impurity);
+	};
+
+	// best split of each candidate feature, features are evaluated
+	// independently and reduced in order afterwards, which gives the same
+	// split as a serial search
+	std::vector<SplitCandidate> candidates(num_feats);
+	auto evaluate_feature = [&](index_t i) {
+		auto& candidate = candidates[i];
+		ScratchArena::Scope feature_scratch;
+
+		// feature values of the node and their order
+		auto feats = feature_scratch.vector<float64_t>(num_vecs);
+		auto sorted_args = feature_scratch.vector<index_t>(num_vecs);
+		// class weights of vectors with known value
+		auto wtotal = feature_scratch.vector<float64_t>(n_ulabels);
+		sg_memcpy(
+		    wtotal.vector, total_wclasses.vector,
+		    n_ulabels * sizeof(float64_t));
 
 		if (m_pre_sort)
 		{
@@ -670,17 +718,18 @@ index_t CARTree::compute_best_attribute(
 		// number of non-missing vecs
 		while (feats[n_nm_vecs-1] == MISSING)
 		{
-			total_wclasses[simple_labels[sorted_args[n_nm_vecs-1]]]-=weights[sorted_args[n_nm_vecs-1]];
+			wtotal[simple_labels[sorted_args[n_nm_vecs-1]]]-=weights[sorted_args[n_nm_vecs-1]];
 			--n_nm_vecs;
 		}
+		candidate.num_missing = num_vecs - n_nm_vecs;
 
 		// if only one unique value - it cannot be used to split
 		if (feats[n_nm_vecs-1]<=feats[0]+EQ_DELTA)
-			continue;
+			return;
 
 		if (m_nominal[idx[i]])
 		{
-			SGVector<index_t> simple_feats(num_vecs);
+			auto simple_feats = feature_scratch.vector<index_t>(num_vecs);
 			linalg::set_const(simple_feats, -1);
 
 			// convert to simple values
@@ -695,7 +744,7 @@ index_t CARTree::compute_best_attribute(
 			}
 
 			// collect the unique categorical values
-			SGVector<float64_t> ufeats(c+1);
+			auto ufeats = feature_scratch.vector<float64_t>(c + 1);
 			ufeats[0]=feats[0];
 			index_t u=0;
 			for (index_t j = 1; j < n_nm_vecs; ++j)
@@ -706,22 +755,22 @@ index_t CARTree::compute_best_attribute(
 					ufeats[++u]=feats[j];
 			}
 
+			auto wleft = feature_scratch.vector<float64_t>(n_ulabels);
+			auto wright = feature_scratch.vector<float64_t>(n_ulabels);
+			// stores which vectors are assigned to left child
+			auto is_left = feature_scratch.vector<bool>(num_vecs);
+			// stores which among the categorical values of chosen attribute are assigned left child
+			auto feats_left = feature_scratch.vector<bool>(c + 1);
+
 			// FIXME: this approach is way too vanilla!
 			// test all 2^(I-1)-1 possible division between two nodes
 			index_t num_cases=Math::pow(2,c);
 			for (index_t k = 1; k < num_cases; ++k)
 			{
-				SGVector<float64_t> wleft(n_ulabels), wright(n_ulabels);
 				linalg::zero(wleft);
 				linalg::zero(wright);
-
-				// stores which vectors are assigned to left child
-				SGVector<bool> is_left(num_vecs);
 				linalg::set_const(is_left, false);
 
-				// stores which among the categorical values of chosen attribute are assigned left child
-				SGVector<bool> feats_left(c+1);
-
 				// fill feats_left in a unique way corresponding to the case
 				for (index_t p = 0; p < feats_left.vlen; ++p)
 					feats_left[p]=((k/Math::pow(2,p))%(Math::pow(2,p+1))==1);
@@ -741,43 +790,29 @@ index_t CARTree::compute_best_attribute(
 						is_left[j]=is_left[dupes[j]];
 				}
 
-				float64_t g=0;
-				switch(m_mode)
-				{
-					case PT_MULTICLASS:
-					    g = gain(wleft, wright, total_wclasses, max_impurity);
-					    impurity = std::max(max_impurity, impurity);
-					    break;
-				    case PT_REGRESSION:
-					    g = gain(
-					        wleft, wright, total_wclasses, ulabels,
-					        max_impurity);
-					    impurity = std::max(max_impurity, impurity);
-					    break;
-				    default:
-					    error("Undefined problem statement");
-				}
+				float64_t node_impurity = 0;
+				float64_t g = split_gain(wleft, wright, wtotal, node_impurity);
+				candidate.impurity = std::max(candidate.impurity, node_impurity);
 
-				if (g>max_gain)
+				if (g>candidate.gain)
 				{
-					best_attribute=idx[i];
-					max_gain=g;
-					sg_memcpy(is_left_final.vector,is_left.vector,is_left.vlen*sizeof(bool));
-					num_missing_final=num_vecs-n_nm_vecs;
-
-					count_left = std::count(feats_left.begin(), feats_left.end(), true);
-					count_right = c+1-count_left;
-
+					candidate.gain = g;
+					if (!candidate.is_left.vlen)
+						candidate.is_left = SGVector<bool>(num_vecs);
+					sg_memcpy(candidate.is_left.vector,is_left.vector,is_left.vlen*sizeof(bool));
+
+					candidate.left = SGVector<float64_t>(
+					    std::count(feats_left.begin(), feats_left.end(), true));
+					candidate.right =
+					    SGVector<float64_t>(c + 1 - candidate.left.vlen);
 					index_t l=0;
 					index_t r=0;
-					if (right.vlen < count_right)
-						right.resize_vector(count_right);
 					for (index_t w = 0; w < feats_left.vlen; ++w)
 					{
 						if (feats_left[w])
-							left[l++]=ufeats[w];
+							candidate.left[l++]=ufeats[w];
 						else
-							right[r++]=ufeats[w];
+							candidate.right[r++]=ufeats[w];
 					}
 				}
 			}
@@ -785,8 +820,11 @@ index_t CARTree::compute_best_attribute(
 		else
 		{
 			// O(N)
-			SGVector<float64_t> right_wclasses=total_wclasses.clone();
-			SGVector<float64_t> left_wclasses(n_ulabels);
+			auto right_wclasses = feature_scratch.vector<float64_t>(n_ulabels);
+			sg_memcpy(
+			    right_wclasses.vector, wtotal.vector,
+			    n_ulabels * sizeof(float64_t));
+			auto left_wclasses = feature_scratch.vector<float64_t>(n_ulabels);
 			linalg::zero(left_wclasses);
 
 			// O(N)
@@ -803,30 +841,15 @@ index_t CARTree::compute_best_attribute(
 					continue;
 				}
 				// O(F)
-				float64_t g=0;
-				if (m_mode == PT_MULTICLASS)
-				{
-					g = gain(
-					    left_wclasses, right_wclasses, total_wclasses,
-					    max_impurity);
-					impurity = std::max(max_impurity, impurity);
-				}
-				else if (m_mode == PT_REGRESSION)
-				{
-					g = gain(
-					    left_wclasses, right_wclasses, total_wclasses, ulabels,
-					    max_impurity);
-					impurity = std::max(max_impurity, impurity);
-				}
-				else
-					error("Undefined problem statement");
+				float64_t node_impurity = 0;
+				float64_t g = split_gain(
+				    left_wclasses, right_wclasses, wtotal, node_impurity);
+				candidate.impurity = std::max(candidate.impurity, node_impurity);
 
-				if (g>max_gain)
+				if (g>candidate.gain)
 				{
-					max_gain=g;
-					best_attribute=idx[i];
-					best_threshold=z;
-					num_missing_final=num_vecs-n_nm_vecs;
+					candidate.gain = g;
+					candidate.threshold = z;
 				}
 
 				z=feats[j];
@@ -836,20 +859,52 @@ index_t CARTree::compute_best_attribute(
 				left_wclasses[simple_labels[sorted_args[j]]]+=weights[sorted_args[j]];
 			}
 		}
+	};
 
-		// restore total_wclasses
-		while (n_nm_vecs<feats.vlen)
+	// large nodes evaluate their features as parallel tasks
+	bool parallel = train_in_parallel(num_vecs);
+	for (index_t i=0;i<num_feats;++i)
+	{
+#pragma omp task shared(evaluate_feature) if (parallel)
+		evaluate_feature(i);
+	}
+#pragma omp taskwait
+
+	float64_t max_gain=MIN_SPLIT_GAIN;
+	index_t best=-1;
+	for (index_t i=0;i<num_feats;++i)
+	{
+		impurity = std::max(candidates[i].impurity, impurity);
+		if (candidates[i].gain > max_gain)
 		{
-			total_wclasses[simple_labels[sorted_args[n_nm_vecs-1]]]+=weights[sorted_args[n_nm_vecs-1]];
-			++n_nm_vecs;
+			max_gain = candidates[i].gain;
+			best = i;
 		}
 	}
 
-	if (best_attribute==-1)
+	if (best==-1)
 		return -1;
 
-	if (!m_nominal[best_attribute])
+	auto best_attribute = idx[best];
+	const auto& candidate = candidates[best];
+	num_missing_final = candidate.num_missing;
+	if (m_nominal[best_attribute])
 	{
+		sg_memcpy(
+		    is_left_final.vector, candidate.is_left.vector,
+		    num_vecs * sizeof(bool));
+		count_left = candidate.left.vlen;
+		count_right = candidate.right.vlen;
+		if (left.vlen < count_left)
+			left.resize_vector(count_left);
+		if (right.vlen < count_right)
+			right.resize_vector(count_right);
+		sg_memcpy(left.vector, candidate.left.vector, count_left * sizeof(float64_t));
+		sg_memcpy(right.vector, candidate.right.vector, count_right * sizeof(float64_t));
+	}
+	else
+	{
+		auto best_threshold = candidate.threshold;
 		left[0]=best_threshold;
 		right[0]=best_threshold;
 		count_left=1;
@@ -1263,7 +1318,7 @@ void CARTree::prune_by_cross_validation(const std::shared_ptr<DenseFeatures<floa
 			subset_weights[j]=m_weights[train_indices.at(j)];
 
 		// train with training subset
-		auto root = CARTtrain(feats_train, subset_weights, labels_train, 0);
+		auto root = train_tree(feats_train, subset_weights, labels_train);
 
 		// prune trained tree
 		auto tmax=std::make_shared<TreeMachine<CARTreeNodeData>>();
@@ -1505,6 +1560,7 @@ void CARTree::init()
 
 	m_max_depth=0;
 	m_min_node_size=0;
+	m_min_parallel_node_size=5000;
 	m_label_epsilon=1e-7;
 	m_sorted_features=SGMatrix<float64_t>();
 	m_sorted_indices=SGMatrix<index_t>();
@@ -1524,6 +1580,9 @@ void CARTree::init()
 	SG_ADD(&m_folds, "folds", "number of subsets for cross validation");
 	SG_ADD(&m_max_depth, "max_depth", "max allowed tree depth");
 	SG_ADD(&m_min_node_size, "min_node_size", "min allowed node size");
+	SG_ADD(
+	    &m_min_parallel_node_size, "min_parallel_node_size",
+	    "min node size to search splits and build children in parallel");
 	SG_ADD(&m_label_epsilon, "label_epsilon", "epsilon for labels");
 	SG_ADD_OPTIONS(
 	    (machine_int_t*)&m_mode, "mode",
@@ -32,6 +32,7 @@
 #ifndef _CARTREE_H__
 #define _CARTREE_H__
 
+#include <limits>
 #include <memory>
 #include <shogun/lib/config.h>
 
@@ -120,6 +121,16 @@ public:
 	 */
 	EProblemType get_machine_problem_type() const override { return m_mode; }
 
+	/** the tree is grown on the feature matrix of the training vectors,
+	 * unless pre-sorted features are set, which are indexed by the
+	 * subset of the training vectors and thus need it to be kept
+	 * @return whether features are not pre-sorted
+	 */
+	bool train_prefers_contiguous_features() const override
+	{
+		return !m_pre_sort;
+	}
+
 	/** set problem type - multiclass classification or regression
 	 * @param mode EProblemType PT_MULTICLASS or PT_REGRESSION
 	 */
@@ -213,6 +224,31 @@ public:
 	 */
 	void set_min_node_size(int32_t nsize);
 
+	/** get min node size for parallel training
+	 *
+	 * @return min number of vectors of a node to be trained in parallel
+	 */
+	int32_t get_min_parallel_node_size() const
+	{
+		return m_min_parallel_node_size;
+	}
+
+	/** set min node size for parallel training. Nodes with at least this
+	 * many vectors evaluate their features and build their children as
+	 * parallel tasks, smaller nodes are trained serially.
+	 *
+	 * @param nsize min node size, 0 to always train serially
+	 */
+	void set_min_parallel_node_size(int32_t nsize)
+	{
+		require(
+		    nsize >= 0,
+		    "Min parallel node size should not be negative. Supplied value "
+		    "is {}",
+		    nsize);
+		m_min_parallel_node_size = nsize;
+	}
+
 	/** Set cross validation pruning parameter
 	 *
 	 * @param cv_pruning allow CV pruning
@@ -244,12 +280,55 @@ public:
 	SGVector<float64_t> get_feature_importance();
 
 protected:
+	/** best split of a single feature found in compute_best_attribute */
+	struct SplitCandidate
+	{
+		/** gain of the split */
+		float64_t gain = MIN_SPLIT_GAIN;
+		/** max impurity of the node seen while searching */
+		float64_t impurity = std::numeric_limits<float64_t>::lowest();
+		/** threshold of continuous features */
+		float64_t threshold = 0;
+		/** number of vectors with missing value */
+		index_t num_missing = 0;
+		/** which vectors go to the left child, nominal features only */
+		SGVector<bool> is_left;
+		/** values going left, nominal features only */
+		SGVector<float64_t> left;
+		/** values going right, nominal features only */
+		SGVector<float64_t> right;
+	};
+
 	/** train machine - build CART from training data
 	 * @param data training data
 	 * @return true
 	 */
 	bool train_machine(std::shared_ptr<Features> data=NULL) override;
 
+	/** builds a tree with CARTtrain, in parallel if the data is large
+	 * enough
+	 *
+	 * @param data training data
+	 * @param weights vector of weights of data points
+	 * @param labels labels of data points
+	 * @return root of the tree
+	 */
+	std::shared_ptr<bnode_t> train_tree(
+	    const std::shared_ptr<DenseFeatures<float64_t>>& data,
+	    const SGVector<float64_t>& weights,
+	    const std::shared_ptr<DenseLabels>& labels);
+
+	/** @return whether a node of given size is trained in parallel */
+	bool train_in_parallel(index_t num_vecs) const;
+
+	/** @return whether nodes may be built in any order, which is not the
+	 * case if compute_best_attribute depends on the order of calls
+	 */
+	virtual bool supports_parallel_training() const
+	{
+		return true;
+	}
+
 	/** CARTtrain - recursive CART training method
 	 *
 	 * @param data training data
@@ -483,6 +562,9 @@ protected:
 
 	/** minimum number of feature vectors required in a node **/
 	int32_t m_min_node_size;
+
+	/** minimum number of feature vectors of a node to train it in parallel **/
+	int32_t m_min_parallel_node_size;
 };
 } /* namespace shogun */
 
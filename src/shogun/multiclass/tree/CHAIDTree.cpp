@@ -28,6 +28,7 @@
  * either expressed or implied, of the Shogun Development Team.
  */
 
+#include <shogun/lib/ScratchArena.h>
 #include <shogun/lib/View.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/Statistics.h>
@@ -302,13 +303,16 @@ std::shared_ptr<TreeMachineNode<CHAIDTreeNodeData>> CHAIDTree::CHAIDtrain(const
 			return node;
 	}
 
+	// per-node temporaries, released after the children are built
+	ScratchArena::Scope scratch;
+
 	// choose best attribute for splitting
 	float64_t min_pv=Math::MAX_REAL_NUMBER;
 	SGVector<int32_t> cat_min;
 	int32_t attr_min=-1;
+	auto feats = scratch.vector<float64_t>(num_vecs);
 	for (int32_t i=0;i<num_feats;i++)
 	{
-		SGVector<float64_t> feats(num_vecs);
 		for (int32_t j=0;j<num_vecs;j++)
 			feats[j]=mat(i,j);
 
@@ -333,7 +337,7 @@ std::shared_ptr<TreeMachineNode<CHAIDTreeNodeData>> CHAIDTree::CHAIDtrain(const
 		return node;
 
 	// split
-	SGVector<float64_t> ufeats_best(num_vecs);
+	auto ufeats_best = scratch.vector<float64_t>(num_vecs);
 	for (int32_t i=0;i<num_vecs;i++)
 		ufeats_best[i]=mat(attr_min,i);
 
@@ -356,8 +360,9 @@ std::shared_ptr<TreeMachineNode<CHAIDTreeNodeData>> CHAIDTree::CHAIDtrain(const
 			}
 		}
 
-		SGVector<int32_t> subset(feat_index.size());
-		SGVector<float64_t> subweights(feat_index.size());
+		ScratchArena::Scope child_scratch;
+		auto subset = child_scratch.vector<int32_t>(feat_index.size());
+		auto subweights = child_scratch.vector<float64_t>(feat_index.size());
 		for (int32_t j=0;j<feat_index.size();j++)
 		{
 			subset[j]=feat_index[j];
@@ -1055,9 +1060,11 @@ SGMatrix<float64_t> CHAIDTree::expected_cf_row_effects_model(SGMatrix<int32_t> c
 	int32_t r=ct.num_rows;
 	int32_t c=ct.num_cols;
 
+	ScratchArena::Scope scratch;
+
 	// compute row sum(n_i.'s) and column sum(n_.j's)
-	SGVector<int32_t> row_sum(r);
-	SGVector<int32_t> col_sum(c);
+	auto row_sum = scratch.vector<int32_t>(r);
+	auto col_sum = scratch.vector<int32_t>(c);
 	for (int32_t i=0;i<r;i++)
 	{
 		int32_t sum=0;
@@ -1098,9 +1105,11 @@ SGMatrix<float64_t> CHAIDTree::expected_cf_row_effects_model(SGMatrix<int32_t> c
 	}
 
 	SGMatrix<float64_t> m_k=wt.clone();
-	SGVector<float64_t> alpha(r);
-	SGVector<float64_t> beta(c);
-	SGVector<float64_t> gamma(r);
+	auto alpha = scratch.vector<float64_t>(r);
+	auto beta = scratch.vector<float64_t>(c);
+	auto gamma = scratch.vector<float64_t>(r);
+	auto g = scratch.vector<float64_t>(r);
+	auto m_star = scratch.matrix<float64_t>(r, c);
 	alpha.fill_vector(alpha.vector,alpha.vlen,1.0);
 	beta.fill_vector(beta.vector,beta.vlen,1.0);
 	gamma.fill_vector(gamma.vector,gamma.vlen,1.0);
@@ -1128,8 +1137,6 @@ SGMatrix<float64_t> CHAIDTree::expected_cf_row_effects_model(SGMatrix<int32_t> c
 		}
 
 		// compute g_i for updating gamma
-		SGVector<float64_t> g(r);
-		SGMatrix<float64_t> m_star(r,c);
 		for (int32_t i=0;i<r;i++)
 		{
 			for (int32_t j=0;j<c;j++)
@@ -31,6 +31,7 @@
 #include <shogun/evaluation/MulticlassAccuracy.h>
 #include <shogun/features/DenseFeatures.h>
 #include <shogun/labels/MulticlassLabels.h>
+#include <shogun/lib/ScratchArena.h>
 #include <shogun/lib/View.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/Statistics.h>
@@ -152,8 +153,11 @@ std::shared_ptr<TreeMachineNode<id3TreeNodeData>> ID3ClassifierTree::id3train(co
 		}
 	}
 
+	// per-node temporaries, released after the children are built
+	ScratchArena::Scope scratch;
+
 	// get feature values for the best feature chosen
-	SGVector<float64_t> best_feature_values = SGVector<float64_t>(num_vecs);
+	auto best_feature_values = scratch.vector<float64_t>(num_vecs);
 	for (int32_t i=0; i<num_vecs; i++)
 		best_feature_values[i] = (feats->get_feature_vector(i))[best_feature_index];
 
@@ -234,8 +238,10 @@ float64_t ID3ClassifierTree::informational_gain_attribute(
 	auto feats = data->as<DenseFeatures<float64_t>>();
 	int32_t num_vecs = feats->get_num_vectors();
 
+	ScratchArena::Scope scratch;
+
 	// get attribute values for attribute
-	SGVector<float64_t> attribute_values = SGVector<float64_t>(num_vecs);
+	auto attribute_values = scratch.vector<float64_t>(num_vecs);
 
 	for (int32_t i=0; i<num_vecs; i++)
 		attribute_values[i] = (feats->get_feature_vector(i))[attr_no];
@@ -254,7 +260,8 @@ float64_t ID3ClassifierTree::informational_gain_attribute(
 				attr_count++;
 		}
 
-		SGVector<float64_t> sub_class = SGVector<float64_t>(attr_count);
+		ScratchArena::Scope value_scratch;
+		auto sub_class = value_scratch.vector<float64_t>(attr_count);
 		int32_t count = 0;
 
 		for (int32_t j=0; j<num_vecs; j++)
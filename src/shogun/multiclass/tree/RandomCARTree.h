@@ -93,6 +93,14 @@ protected:
 		float64_t& impurity, index_t subset_size = 0,
 		const SGVector<index_t>& active_indices = SGVector<index_t>()) override;
 
+	/** feature subsets are drawn from m_prng in depth-first order of the
+	 * nodes, so the tree is built serially
+	 */
+	bool supports_parallel_training() const override
+	{
+		return false;
+	}
+
 private:
 	/** initialize parameters */
 	void init();
@@ -1,5 +1,9 @@
+#include <shogun/base/ShogunEnv.h>
 #include <shogun/preprocessor/DensePreprocessor.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace shogun
 {
 template <class ST>
@@ -126,11 +130,103 @@ void DensePreprocessor<ST>::fit(std::shared_ptr<Features> f)
 	require(num_features > 0, "Dimension of provided features {} must be positive", num_features);
 	
 	auto feature_matrix = dense_features->get_feature_matrix();
+	reset_partial_fit();
 	fit_impl(feature_matrix);
 	
 	m_fitted.store(true);
 }
 
+template <class ST>
+void DensePreprocessor<ST>::partial_fit(std::shared_ptr<Features> f)
+{
+	if (!is_vectorwise())
+	{
+		Preprocessor::partial_fit(f);
+		return;
+	}
+	require(f, "No features provided");
+
+	auto feature_matrix = f->as<DenseFeatures<ST>>()->get_feature_matrix();
+	auto num_features = feature_matrix.num_rows;
+	if (feature_matrix.num_cols == 0)
+		return;
+
+	if (m_partial_fit_num_vectors == 0)
+	{
+		require(num_features > 0, "Dimension of provided features {} must be positive", num_features);
+		m_partial_fit_num_features = num_features;
+		m_partial_fit_statistics = init_fit_statistics(num_features);
+	}
+	require(
+	    num_features == m_partial_fit_num_features,
+	    "Number of features of batch ({}) does not match number of features "
+	    "seen so far ({}).",
+	    num_features, m_partial_fit_num_features);
+
+	if (m_partial_fit_statistics.vlen > 0)
+		merge_fit_statistics(m_partial_fit_statistics, compute_fit_statistics(feature_matrix));
+	m_partial_fit_num_vectors += feature_matrix.num_cols;
+	fit_statistics(m_partial_fit_statistics, num_features, m_partial_fit_num_vectors);
+}
+
+template <class ST>
+void DensePreprocessor<ST>::reset_partial_fit()
+{
+	m_partial_fit_statistics = SGVector<float64_t>();
+	m_partial_fit_num_features = 0;
+	m_partial_fit_num_vectors = 0;
+}
+
+template <class ST>
+void DensePreprocessor<ST>::transform_vector_inplace(ST* vector, index_t num_features) const
+{
+	not_implemented(SOURCE_LOCATION);
+}
+
+template <class ST>
+void DensePreprocessor<ST>::fit_statistics(
+    const SGVector<float64_t>& statistics, index_t num_features,
+    int64_t num_vectors)
+{
+	m_fitted.store(true);
+}
+
+template <class ST>
+void DensePreprocessor<ST>::fit_with_statistics(const SGMatrix<ST>& feature_matrix)
+{
+	auto num_features = feature_matrix.num_rows;
+	auto statistics = compute_fit_statistics(feature_matrix);
+	fit_statistics(statistics, num_features, feature_matrix.num_cols);
+}
+
+template <class ST>
+SGVector<float64_t> DensePreprocessor<ST>::compute_fit_statistics(const SGMatrix<ST>& feature_matrix) const
+{
+	auto num_features = feature_matrix.num_rows;
+	auto num_vectors = feature_matrix.num_cols;
+	auto statistics = init_fit_statistics(num_features);
+	if (statistics.vlen == 0)
+		return statistics;
+
+	// every block accumulates its own statistics, which are merged in order
+	// afterwards to get reproducible results
+	auto num_blocks = std::max<index_t>(1, std::min<index_t>(num_vectors, env()->get_num_threads()));
+	std::vector<SGVector<float64_t>> block_statistics(num_blocks);
+#pragma omp parallel for num_threads(num_blocks)
+	for (index_t block = 0; block < num_blocks; block++)
+	{
+		auto local = init_fit_statistics(num_features);
+		auto first = static_cast<int64_t>(block) * num_vectors / num_blocks;
+		auto last = static_cast<int64_t>(block + 1) * num_vectors / num_blocks;
+		for (auto i = first; i < last; i++)
+			accumulate_fit_statistics(local, feature_matrix.get_column_vector(i), num_features);
+		block_statistics[block] = local;
+	}
+	for (const auto& local : block_statistics)
+		merge_fit_statistics(statistics, local);
+	return statistics;
+}
+
 template <class ST>
 SGMatrix<ST>
 DensePreprocessor<ST>::inverse_apply_to_matrix(SGMatrix<ST> matrix)
@@ -25,8 +25,12 @@ template <class ST> class DenseFeatures;
  * in this interface need to be implemented in each particular preprocessor
  * operating on DenseFeatures. For examples see e.g. CLogPlusOne or CPCACut.
  */
+template <class ST> class DensePreprocessorChain;
+
 template <class ST> class DensePreprocessor : public Preprocessor
 {
+	friend class DensePreprocessorChain<ST>;
+
 	public:
 		/** constructor
 		 */
@@ -64,6 +68,94 @@ template <class ST> class DensePreprocessor : public Preprocessor
 
 		void fit(std::shared_ptr<Features>) override;
 
+		/** Updates a vectorwise preprocessor (cf. is_vectorwise()) with a
+		 * batch of vectors. The fit statistics of all batches are kept and
+		 * merged, so that the result equals fit() on all batches at once,
+		 * and the preprocessor is refitted to them after every batch.
+		 *
+		 * @param features dense batch of feature vectors
+		 */
+		void partial_fit(std::shared_ptr<Features> features) override;
+
+		/** Whether the preprocessor transforms every feature vector on its
+		 * own, using fitted state only. Such preprocessors implement
+		 * transform_vector_inplace() and, if fitting needs the data, the
+		 * fit statistics methods below. Consecutive ones can then be fused
+		 * into single passes over the data, see DensePreprocessorChain.
+		 *
+		 * @return whether the preprocessor is vectorwise
+		 */
+		virtual bool is_vectorwise() const
+		{
+			return false;
+		}
+
+		/** @param num_features number of features of input vectors
+		 * @return number of features of transformed vectors
+		 */
+		virtual index_t get_num_transformed_features(index_t num_features) const
+		{
+			return num_features;
+		}
+
+		/** Transforms a feature vector in place, for vectorwise
+		 * preprocessors. As it may run in parallel, it does not check
+		 * whether the preprocessor is fitted and does not throw, input
+		 * dimensions are checked by get_num_transformed_features().
+		 *
+		 * @param vector feature vector, with room for the larger of
+		 * num_features and the number of transformed features
+		 * @param num_features number of features of the vector
+		 */
+		virtual void transform_vector_inplace(ST* vector, index_t num_features) const;
+
+		/** Creates statistics that fitting needs from the data. They are
+		 * accumulated one feature vector at a time and statistics of
+		 * disjoint sets of vectors can be merged, so that they can be
+		 * computed in parallel and along with other passes over the data.
+		 *
+		 * @param num_features number of features of the vectors
+		 * @return statistics of no vectors, empty if fitting does not need
+		 * the data
+		 */
+		virtual SGVector<float64_t> init_fit_statistics(index_t num_features) const
+		{
+			return SGVector<float64_t>();
+		}
+
+		/** Adds a feature vector to statistics
+		 *
+		 * @param statistics statistics from init_fit_statistics()
+		 * @param vector feature vector
+		 * @param num_features number of features of the vector
+		 */
+		virtual void accumulate_fit_statistics(
+		    SGVector<float64_t>& statistics, const ST* vector,
+		    index_t num_features) const
+		{
+		}
+
+		/** Merges statistics of other vectors into statistics
+		 *
+		 * @param statistics statistics to update
+		 * @param other statistics of other vectors
+		 */
+		virtual void merge_fit_statistics(
+		    SGVector<float64_t>& statistics,
+		    const SGVector<float64_t>& other) const
+		{
+		}
+
+		/** Fits the preprocessor to the statistics of all vectors
+		 *
+		 * @param statistics statistics of all vectors
+		 * @param num_features number of features of the vectors
+		 * @param num_vectors number of vectors
+		 */
+		virtual void fit_statistics(
+		    const SGVector<float64_t>& statistics, index_t num_features,
+		    int64_t num_vectors);
+
 	protected:
 		/** Apply preprocessor on matrix. Subclasses should try to apply in
 		 * place to avoid copying.
@@ -82,6 +174,31 @@ template <class ST> class DensePreprocessor : public Preprocessor
 		virtual void fit_impl(const SGMatrix<ST>& feature_matrix)
 		{
 		}
+
+		/** Fits the preprocessor by accumulating fit statistics of all
+		 * feature vectors. Vectorwise preprocessors use it as fit_impl().
+		 *
+		 * @param feature_matrix the training feature matrix
+		 */
+		void fit_with_statistics(const SGMatrix<ST>& feature_matrix);
+
+		/** Accumulates the fit statistics of a feature matrix, blocks of
+		 * vectors are processed in parallel and merged in order.
+		 *
+		 * @param feature_matrix feature matrix
+		 * @return statistics of all vectors of the matrix
+		 */
+		SGVector<float64_t> compute_fit_statistics(const SGMatrix<ST>& feature_matrix) const;
+
+		void reset_partial_fit() override;
+
+	private:
+		/** fit statistics of the batches passed to partial_fit() */
+		SGVector<float64_t> m_partial_fit_statistics;
+		/** number of features of the batches passed to partial_fit() */
+		index_t m_partial_fit_num_features = 0;
+		/** number of vectors passed to partial_fit() */
+		int64_t m_partial_fit_num_vectors = 0;
 };
 
 }
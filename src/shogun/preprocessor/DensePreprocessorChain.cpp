@@ -0,0 +1,135 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/base/ShogunEnv.h>
+#include <shogun/base/range.h>
+#include <shogun/preprocessor/DensePreprocessorChain.h>
+
+#include <algorithm>
+
+using namespace shogun;
+
+template <class ST>
+DensePreprocessorChain<ST>::DensePreprocessorChain(
+    std::vector<std::shared_ptr<DensePreprocessor<ST>>> preprocessors)
+    : m_preprocessors(std::move(preprocessors))
+{
+	for (const auto& preprocessor : m_preprocessors)
+	{
+		require(
+		    preprocessor->is_vectorwise(),
+		    "Preprocessor {} can not be fused, as it does not transform "
+		    "feature vectors independently",
+		    preprocessor->get_name());
+	}
+}
+
+template <class ST>
+void DensePreprocessorChain<ST>::fit(const SGMatrix<ST>& matrix)
+{
+	require(matrix.num_rows > 0, "Dimension of provided features {} must be positive", matrix.num_rows);
+
+	auto num_vectors = matrix.num_cols;
+	auto blocks = num_blocks(num_vectors);
+	for (auto stage : range(m_preprocessors.size()))
+	{
+		auto& preprocessor = m_preprocessors[stage];
+		auto num_features = matrix.num_rows;
+		for (auto i : range(stage))
+			num_features = m_preprocessors[i]->get_num_transformed_features(num_features);
+
+		auto statistics = preprocessor->init_fit_statistics(num_features);
+		if (statistics.vlen > 0)
+		{
+			// every block accumulates its own statistics, which are merged
+			// in order afterwards to get reproducible results
+			std::vector<SGVector<float64_t>> block_statistics(blocks);
+			auto size = buffer_size(matrix.num_rows, stage);
+#pragma omp parallel for num_threads(blocks)
+			for (index_t block = 0; block < blocks; block++)
+			{
+				auto local = preprocessor->init_fit_statistics(num_features);
+				SGVector<ST> buffer(size);
+				for (index_t i = first_vector(block, blocks, num_vectors);
+				     i < first_vector(block + 1, blocks, num_vectors); i++)
+				{
+					std::copy_n(matrix.get_column_vector(i), matrix.num_rows, buffer.vector);
+					apply(buffer.vector, matrix.num_rows, stage);
+					preprocessor->accumulate_fit_statistics(local, buffer.vector, num_features);
+				}
+				block_statistics[block] = local;
+			}
+			for (const auto& local : block_statistics)
+				preprocessor->merge_fit_statistics(statistics, local);
+		}
+		preprocessor->fit_statistics(statistics, num_features, num_vectors);
+	}
+}
+
+template <class ST>
+SGMatrix<ST> DensePreprocessorChain<ST>::transform(const SGMatrix<ST>& matrix) const
+{
+	// check everything here, exceptions must not leave the parallel loop
+	auto num_features = matrix.num_rows;
+	for (const auto& preprocessor : m_preprocessors)
+	{
+		preprocessor->assert_fitted();
+		num_features = preprocessor->get_num_transformed_features(num_features);
+	}
+
+	auto num_vectors = matrix.num_cols;
+	auto blocks = num_blocks(num_vectors);
+	auto size = buffer_size(matrix.num_rows, m_preprocessors.size());
+	SGMatrix<ST> result(num_features, num_vectors);
+#pragma omp parallel for num_threads(blocks)
+	for (index_t block = 0; block < blocks; block++)
+	{
+		SGVector<ST> buffer(size);
+		for (index_t i = first_vector(block, blocks, num_vectors);
+		     i < first_vector(block + 1, blocks, num_vectors); i++)
+		{
+			std::copy_n(matrix.get_column_vector(i), matrix.num_rows, buffer.vector);
+			apply(buffer.vector, matrix.num_rows, m_preprocessors.size());
+			std::copy_n(buffer.vector, num_features, result.get_column_vector(i));
+		}
+	}
+	return result;
+}
+
+template <class ST>
+index_t DensePreprocessorChain<ST>::apply(ST* vector, index_t num_features, size_t num_stages) const
+{
+	for (auto stage : range(num_stages))
+	{
+		m_preprocessors[stage]->transform_vector_inplace(vector, num_features);
+		num_features = m_preprocessors[stage]->get_num_transformed_features(num_features);
+	}
+	return num_features;
+}
+
+template <class ST>
+index_t DensePreprocessorChain<ST>::buffer_size(index_t num_features, size_t num_stages) const
+{
+	auto size = num_features;
+	for (auto stage : range(num_stages))
+	{
+		num_features = m_preprocessors[stage]->get_num_transformed_features(num_features);
+		size = std::max(size, num_features);
+	}
+	return size;
+}
+
+template <class ST>
+index_t DensePreprocessorChain<ST>::num_blocks(index_t num_vectors)
+{
+	return std::max<index_t>(1, std::min<index_t>(num_vectors, env()->get_num_threads()));
+}
+
+template <class ST>
+index_t DensePreprocessorChain<ST>::first_vector(index_t block, index_t num_blocks, index_t num_vectors)
+{
+	return static_cast<int64_t>(block) * num_vectors / num_blocks;
+}
+
+template class shogun::DensePreprocessorChain<float64_t>;
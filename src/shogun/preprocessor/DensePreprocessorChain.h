@@ -0,0 +1,77 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef _DENSEPREPROCESSORCHAIN__H__
+#define _DENSEPREPROCESSORCHAIN__H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/preprocessor/DensePreprocessor.h>
+
+#include <memory>
+#include <vector>
+
+namespace shogun
+{
+/** @brief Fused fitting and transformation of a sequence of vectorwise dense
+ * preprocessors (cf. DensePreprocessor::is_vectorwise).
+ *
+ * Instead of materializing the features after every preprocessor, each
+ * feature vector is copied to a small buffer, passed through all
+ * preprocessors there and written to the single output matrix. Blocks of
+ * columns are processed in parallel.
+ *
+ * Fitting needs a pass over the data for every preprocessor whose fitting
+ * needs data statistics, as these depend on all preceding preprocessors.
+ * Every such pass transforms the vectors with the preprocessors fitted so far
+ * and accumulates the statistics of the next preprocessor on the fly, no
+ * intermediate matrix is created.
+ */
+template <class ST> class DensePreprocessorChain
+{
+	public:
+		/** constructor
+		 *
+		 * @param preprocessors vectorwise preprocessors in order of application
+		 */
+		DensePreprocessorChain(
+		    std::vector<std::shared_ptr<DensePreprocessor<ST>>> preprocessors);
+
+		/** Fits all preprocessors, every one to the output of the preceding
+		 * ones.
+		 *
+		 * @param matrix training feature matrix, not modified
+		 */
+		void fit(const SGMatrix<ST>& matrix);
+
+		/** Applies all preprocessors, which have to be fitted
+		 *
+		 * @param matrix feature matrix, not modified
+		 * @return transformed feature matrix
+		 */
+		SGMatrix<ST> transform(const SGMatrix<ST>& matrix) const;
+
+	private:
+		/** Applies the first num_stages preprocessors to a vector in place
+		 *
+		 * @return number of features of the transformed vector
+		 */
+		index_t apply(ST* vector, index_t num_features, size_t num_stages) const;
+
+		/** @return size of a buffer that holds a vector while the first
+		 * num_stages preprocessors are applied
+		 */
+		index_t buffer_size(index_t num_features, size_t num_stages) const;
+
+		/** @return number of column blocks that are processed in parallel */
+		static index_t num_blocks(index_t num_vectors);
+
+		/** @return index of the first vector of a block */
+		static index_t first_vector(index_t block, index_t num_blocks, index_t num_vectors);
+
+		std::vector<std::shared_ptr<DensePreprocessor<ST>>> m_preprocessors;
+};
+}
+#endif
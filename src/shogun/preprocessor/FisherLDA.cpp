@@ -32,6 +32,7 @@
  */
 #include <shogun/lib/config.h>
 
+#include <shogun/base/range.h>
 #include <shogun/features/DenseFeatures.h>
 #include <shogun/features/Features.h>
 #include <shogun/io/SGIO.h>
@@ -44,6 +45,7 @@
 #include <shogun/solver/LDACanVarSolver.h>
 #include <shogun/solver/LDASolver.h>
 
+#include <algorithm>
 #include <utility>
 
 using namespace std;
@@ -70,6 +72,7 @@ void FisherLDA::initialize_parameters()
 	m_num_dim=0;
 	m_gamma = 0;
 	m_bdc_svd = true;
+	m_partial_fit_num_dim = 0;
 	SG_ADD(
 	    &m_num_dim, "final_dimensions", "dimensions to be retained");
 	SG_ADD(&m_gamma, "m_gamma", "Regularization parameter");
@@ -129,6 +132,8 @@ void FisherLDA::fit(std::shared_ptr<Features> features, std::shared_ptr<Labels>
 	if ((m_num_dim <= 0) || (m_num_dim > (num_class - 1)))
 		m_num_dim = (num_class - 1);
 
+	reset_partial_fit();
+
 	bool lda_more_efficient =
 	    m_method == AUTO_FLDA && num_vectors < num_features;
 
@@ -140,6 +145,91 @@ void FisherLDA::fit(std::shared_ptr<Features> features, std::shared_ptr<Labels>
 	m_fitted.store(true);
 }
 
+void FisherLDA::partial_fit(std::shared_ptr<Features> features)
+{
+	error("Labels for the given features are not specified!");
+}
+
+void FisherLDA::partial_fit(
+    std::shared_ptr<Features> features, std::shared_ptr<Labels> labels)
+{
+	require(features, "Features are not provided!");
+
+	require(labels, "Labels for the given features are not specified!");
+
+	require(
+	    labels->get_label_type() == LT_MULTICLASS,
+	    "The labels should be of "
+	    "the type MulticlassLabels! you provided {}\n",
+	    labels->get_name());
+
+	auto dense_features = features->as<DenseFeatures<float64_t>>();
+	auto label_vector = multiclass_labels(labels)->get_int_labels();
+
+	index_t num_vectors = dense_features->get_num_vectors();
+	index_t num_features = dense_features->get_num_features();
+
+	require(
+	    label_vector.vlen == num_vectors,
+	    "The number of samples provided ({})"
+	    " must be equal to the number of labels provided({})\n",
+	    num_vectors, label_vector.vlen);
+	if (num_vectors == 0)
+		return;
+
+	if (m_partial_fit_scatter.get_num_classes() == 0)
+		m_partial_fit_num_dim = m_num_dim;
+
+	int32_t num_batch_class = 0;
+	for (auto label : label_vector)
+		num_batch_class = std::max(num_batch_class, label + 1);
+	m_partial_fit_scatter.merge(
+	    ScatterMatrix<float64_t>(*dense_features, label_vector, num_batch_class));
+
+	std::vector<SGVector<float64_t>> class_mean;
+	SGMatrix<float64_t> within_cov(num_features, num_features);
+	within_cov.zero();
+	for (auto c : range(m_partial_fit_scatter.get_num_classes()))
+	{
+		auto count = m_partial_fit_scatter.get_count(c);
+		if (count == 0)
+			continue;
+		class_mean.push_back(m_partial_fit_scatter.get_mean(c));
+		if (count > 1)
+			linalg::add(
+			    within_cov, m_partial_fit_scatter.get_scatter(c), within_cov,
+			    1.0, (float64_t)count / (count - 1));
+	}
+	int32_t num_class = class_mean.size();
+	if (num_class < 2)
+		return;
+
+	if (m_gamma > 0.0)
+	{
+		auto trace = linalg::trace(within_cov);
+		SGMatrix<float64_t> id(num_features, num_features);
+		linalg::identity(id);
+		linalg::add(
+		    within_cov, id, within_cov, 1.0 - m_gamma,
+		    trace * m_gamma / num_features);
+	}
+
+	m_num_dim = m_partial_fit_num_dim;
+	if ((m_num_dim <= 0) || (m_num_dim > (num_class - 1)))
+		m_num_dim = (num_class - 1);
+
+	solve_classic(
+	    m_partial_fit_scatter.get_total_mean(), class_mean, within_cov);
+
+	m_fitted.store(true);
+}
+
+void FisherLDA::reset_partial_fit()
+{
+	DensePreprocessor<float64_t>::reset_partial_fit();
+	m_partial_fit_scatter = ScatterMatrix<float64_t>();
+}
+
 void FisherLDA::solver_canvar(
     std::shared_ptr<DenseFeatures<float64_t>> features, std::shared_ptr<MulticlassLabels> labels)
 {
@@ -154,17 +244,23 @@ void FisherLDA::solver_canvar(
 void FisherLDA::solver_classic(
     const std::shared_ptr<DenseFeatures<float64_t>>& features, const std::shared_ptr<MulticlassLabels>& labels)
 {
-	SGMatrix<float64_t> data = features->get_feature_matrix();
-	index_t num_features = data.num_rows;
-	int32_t num_class = labels->get_num_classes();
-
 	auto solver = std::unique_ptr<LDASolver<float64_t>>(
 	    new LDASolver<float64_t>(features, labels, m_gamma));
 
-	m_mean_vector = solver->get_mean();
-	auto class_mean = solver->get_class_mean();
-	auto class_count = solver->get_class_count();
-	SGMatrix<float64_t> Sw = solver->get_within_cov();
+	solve_classic(
+	    solver->get_mean(), solver->get_class_mean(),
+	    solver->get_within_cov());
+}
+
+void FisherLDA::solve_classic(
+    const SGVector<float64_t>& mean,
+    const std::vector<SGVector<float64_t>>& class_mean,
+    const SGMatrix<float64_t>& Sw)
+{
+	index_t num_features = mean.vlen;
+	int32_t num_class = class_mean.size();
+
+	m_mean_vector = mean;
 
 	// For holding the between class scatter.
 	SGMatrix<float64_t> Sb(num_features, num_class);
@@ -38,6 +38,7 @@
 
 #include <shogun/features/Features.h>
 #include <shogun/labels/Labels.h>
+#include <shogun/mathematics/ScatterMatrix.h>
 #include <shogun/preprocessor/DensePreprocessor.h>
 #include <vector>
 
@@ -127,6 +128,19 @@ class MulticlassLabels;
 		 */
 		void fit(std::shared_ptr<Features> features, std::shared_ptr<Labels> labels) override;
 
+		void partial_fit(std::shared_ptr<Features> features) override;
+
+		/** updates fisher lda transformation with a batch of features and
+		 * labels. Class-wise counts, means and scatter matrices of all
+		 * batches are merged (Chan et al., 1979), the transformation is
+		 * then computed with the ::CLASSIC_FLDA method, whichever method
+		 * has been chosen. Until two classes have been seen the
+		 * preprocessor remains unfitted.
+		 * @param features batch of training features
+		 * @param labels multiclass labels of the batch
+		 */
+		void partial_fit(std::shared_ptr<Features> features, std::shared_ptr<Labels> labels) override;
+
 		/** apply preprocessor to feature vector
 		 * @param vector features on which the learned transformation has to be applied.
 		 * @return processed feature vector with reduced dimensions.
@@ -185,6 +199,19 @@ class MulticlassLabels;
 		void solver_classic(
 		    const std::shared_ptr<DenseFeatures<float64_t>>& features, const std::shared_ptr<MulticlassLabels>& labels);
 
+		/**
+		 * Computes the classic transformation from data statistics.
+		 * @param mean total mean.
+		 * @param class_mean mean of every class.
+		 * @param within_cov within class covariance matrix.
+		 */
+		void solve_classic(
+		    const SGVector<float64_t>& mean,
+		    const std::vector<SGVector<float64_t>>& class_mean,
+		    const SGMatrix<float64_t>& within_cov);
+
+		void reset_partial_fit() override;
+
 		/** transformation matrix */
 		SGMatrix<float64_t> m_transformation_matrix;
 		/** num dim */
@@ -201,6 +228,12 @@ class MulticlassLabels;
 		SGVector<float64_t> m_mean_vector;
 		/** eigenvalues vector */
 		SGVector<float64_t> m_eigenvalues_vector;
+
+	private:
+		/** number of dimensions to retain as set before partial_fit() */
+		int32_t m_partial_fit_num_dim;
+		/** class-wise statistics of the batches passed to partial_fit() */
+		ScatterMatrix<float64_t> m_partial_fit_scatter;
 };
 }
 #endif //ifndef
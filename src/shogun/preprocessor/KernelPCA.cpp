@@ -19,15 +19,16 @@
 #include <shogun/kernel/Kernel.h>
 #include <shogun/lib/common.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
+#include <shogun/mathematics/linalg/LinalgRandomized.h>
 
 using namespace shogun;
 
-KernelPCA::KernelPCA() : Preprocessor()
+KernelPCA::KernelPCA() : RandomMixin<Preprocessor>()
 {
 	init();
 }
 
-KernelPCA::KernelPCA(std::shared_ptr<Kernel> k) : Preprocessor()
+KernelPCA::KernelPCA(std::shared_ptr<Kernel> k) : RandomMixin<Preprocessor>()
 {
 	init();
 	set_kernel(std::move(k));
@@ -40,6 +41,9 @@ void KernelPCA::init()
 	m_bias_vector = SGVector<float64_t>();
 	m_target_dim = 1;
 	m_kernel = NULL;
+	m_method = EVD;
+	m_oversampling = 10;
+	m_power_iterations = 2;
 
 	SG_ADD(&m_transformation_matrix, "transformation_matrix",
 		"matrix used to transform data");
@@ -49,6 +53,16 @@ void KernelPCA::init()
 	    &m_target_dim, "target_dim", "target dimensionality of preprocessor",
 	    ParameterProperties::HYPER);
 	SG_ADD(&m_kernel, "kernel", "kernel to be used", ParameterProperties::HYPER);
+	SG_ADD(
+	    &m_oversampling, "oversampling",
+	    "Number of extra random projections of randomized eigensolver.");
+	SG_ADD(
+	    &m_power_iterations, "power_iterations",
+	    "Number of power iterations of randomized eigensolver.");
+	SG_ADD_OPTIONS(
+	    (machine_int_t*)&m_method, "method",
+	    "Eigendecomposition method of the kernel matrix",
+	    ParameterProperties::NONE, SG_OPTIONS(EVD, RANDOMIZED));
 }
 
 KernelPCA::~KernelPCA()
@@ -87,8 +101,7 @@ void KernelPCA::fit(std::shared_ptr<Features> features)
 
 	SGVector<float64_t> eigenvalues(m_target_dim);
 	SGMatrix<float64_t> eigenvectors(kernel_matrix.num_rows, m_target_dim);
-	linalg::eigen_solver_symmetric(
-	    kernel_matrix, eigenvalues, eigenvectors, m_target_dim);
+	compute_eigenpairs(kernel_matrix, eigenvalues, eigenvectors);
 
 	m_transformation_matrix =
 	    SGMatrix<float64_t>(kernel_matrix.num_rows, m_target_dim);
@@ -110,6 +123,29 @@ void KernelPCA::fit(std::shared_ptr<Features> features)
 	io::info("Done");
 }
 
+void KernelPCA::compute_eigenpairs(
+    const SGMatrix<float64_t>& kernel_matrix, SGVector<float64_t>& eigenvalues,
+    SGMatrix<float64_t>& eigenvectors)
+{
+	switch (m_method)
+	{
+	case EVD:
+		linalg::eigen_solver_symmetric(
+		    kernel_matrix, eigenvalues, eigenvectors, m_target_dim);
+		break;
+	case RANDOMIZED:
+		io::info(
+		    "Computing top {} eigenvectors using randomized range finder",
+		    m_target_dim);
+		linalg::randomized_eigen_solver_symmetric(
+		    kernel_matrix, eigenvalues, eigenvectors, m_target_dim, m_prng,
+		    m_oversampling, m_power_iterations);
+		break;
+	default:
+		error("Eigendecomposition method {} not supported", m_method);
+	}
+}
+
 std::shared_ptr<Features> KernelPCA::transform(std::shared_ptr<Features> features, bool inplace)
 {
 	assert_fitted();
@@ -12,7 +12,9 @@
 #include <shogun/features/Features.h>
 #include <shogun/kernel/Kernel.h>
 #include <shogun/lib/common.h>
+#include <shogun/mathematics/RandomMixin.h>
 #include <shogun/preprocessor/DensePreprocessor.h>
+#include <shogun/preprocessor/PCAMethod.h>
 
 namespace shogun
 {
@@ -27,8 +29,13 @@ class Kernel;
  * Advances in kernel methods support vector learning, 1327(3), 327-352. MIT Press.
  * Retrieved from http://citeseerx.ist.psu.edu/viewdoc/summary?doi=10.1.1.32.8744
  *
+ * The top eigenvectors of the centered kernel matrix are either computed with
+ * a (partial) symmetric eigensolver (EVD, default) or with a randomized range
+ * finder (RANDOMIZED), which only needs a few passes of products with the
+ * kernel matrix and is much cheaper when the target dimension is small
+ * compared to the number of vectors.
  */
-class KernelPCA : public Preprocessor
+class KernelPCA : public RandomMixin<Preprocessor>
 {
 public:
 		/** default constructor
@@ -113,6 +120,12 @@ public:
 		/** default init */
 		void init();
 
+		/** compute top eigenpairs of the centered kernel matrix */
+		void compute_eigenpairs(
+		    const SGMatrix<float64_t>& kernel_matrix,
+		    SGVector<float64_t>& eigenvalues,
+		    SGMatrix<float64_t>& eigenvectors);
+
 	protected:
 
 		/** features used by init. needed for apply */
@@ -129,6 +142,15 @@ public:
 
 		/** kernel to be used */
 		std::shared_ptr<Kernel> m_kernel;
+
+		/** eigendecomposition method, EVD or RANDOMIZED */
+		EPCAMethod m_method;
+
+		/** number of extra random projections for RANDOMIZED method */
+		int32_t m_oversampling;
+
+		/** number of power iterations for RANDOMIZED method */
+		int32_t m_power_iterations;
 };
 }
 #endif
@@ -48,6 +48,12 @@ SGMatrix<float64_t> LogPlusOne::apply_to_matrix(SGMatrix<float64_t> matrix)
 	return matrix;
 }
 
+void LogPlusOne::transform_vector_inplace(float64_t* vector, index_t num_features) const
+{
+	for (auto i : range(num_features))
+		vector[i] = std::log(vector[i] + 1.0);
+}
+
 /// apply preproc on single feature vector
 /// result in feature matrix
 SGVector<float64_t> LogPlusOne::apply_to_feature_vector(SGVector<float64_t> vector)
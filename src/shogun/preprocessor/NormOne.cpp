@@ -51,6 +51,12 @@ SGMatrix<float64_t> NormOne::apply_to_matrix(SGMatrix<float64_t> matrix)
 	return matrix;
 }
 
+void NormOne::transform_vector_inplace(float64_t* vector, index_t num_features) const
+{
+	SGVector<float64_t> vec(vector, num_features, false);
+	linalg::scale(vec, vec, 1.0 / linalg::norm(vec));
+}
+
 /// apply preproc on single feature vector
 /// result in feature matrix
 SGVector<float64_t> NormOne::apply_to_feature_vector(SGVector<float64_t> vector)
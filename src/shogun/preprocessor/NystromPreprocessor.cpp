@@ -0,0 +1,318 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/preprocessor/NystromPreprocessor.h>
+
+#include <shogun/io/SGIO.h>
+#include <shogun/lib/ScopeGuard.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/mathematics/UniformRealDistribution.h>
+#include <shogun/mathematics/eigen3.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+using namespace shogun;
+using namespace Eigen;
+
+NystromPreprocessor::NystromPreprocessor() : RandomMixin<Preprocessor>()
+{
+	init();
+}
+
+NystromPreprocessor::NystromPreprocessor(
+    std::shared_ptr<Kernel> kernel, int32_t num_landmarks)
+    : RandomMixin<Preprocessor>()
+{
+	init();
+	m_kernel = std::move(kernel);
+	m_num_landmarks = num_landmarks;
+}
+
+void NystromPreprocessor::init()
+{
+	m_num_landmarks = 100;
+	m_sampling = NS_UNIFORM;
+	m_leverage_regularization = 1e-3;
+	m_block_size = 1024;
+
+	SG_ADD(&m_kernel, "kernel", "kernel to approximate", ParameterProperties::HYPER);
+	SG_ADD(
+	    &m_num_landmarks, "num_landmarks", "Number of landmarks",
+	    ParameterProperties::HYPER | ParameterProperties::CONSTRAIN,
+	    SG_CONSTRAINT(positive<>()));
+	SG_ADD_OPTIONS(
+	    (machine_int_t*)&m_sampling, "sampling",
+	    "Landmark selection strategy", ParameterProperties::HYPER,
+	    SG_OPTIONS(NS_UNIFORM, NS_KMEANS_PLUSPLUS, NS_LEVERAGE_SCORE));
+	SG_ADD(
+	    &m_leverage_regularization, "leverage_regularization",
+	    "Ridge regularization of leverage scores");
+	SG_ADD(
+	    &m_block_size, "block_size",
+	    "Number of vectors whose feature map is computed at once",
+	    ParameterProperties::CONSTRAIN, SG_CONSTRAINT(positive<>()));
+	SG_ADD(&m_landmarks, "landmarks", "Landmark features");
+	SG_ADD(
+	    &m_landmark_indices, "landmark_indices",
+	    "Indices of landmarks in training features");
+	SG_ADD(
+	    &m_normalization, "normalization",
+	    "Inverse square root of landmark kernel matrix");
+}
+
+NystromPreprocessor::~NystromPreprocessor()
+{
+}
+
+void NystromPreprocessor::fit(std::shared_ptr<Features> features)
+{
+	require(m_kernel, "Kernel not set");
+	require(features, "No features provided");
+
+	auto num_vectors = features->get_num_vectors();
+	require(
+	    m_num_landmarks <= num_vectors,
+	    "Number of landmarks ({}) must not exceed the number of vectors ({}).",
+	    m_num_landmarks, num_vectors);
+
+	auto kernel = clone_kernel();
+	kernel->init(features, features);
+	m_landmark_indices = select_landmarks(kernel, num_vectors);
+	kernel->cleanup();
+
+	m_landmarks = features->copy_subset(m_landmark_indices);
+
+	kernel->init(m_landmarks, m_landmarks);
+	auto kernel_matrix = kernel->get_kernel_matrix();
+	kernel->cleanup();
+
+	// pseudo inverse square root of the landmark kernel matrix
+	Map<MatrixXd> K_mm(kernel_matrix.matrix, m_num_landmarks, m_num_landmarks);
+	SelfAdjointEigenSolver<MatrixXd> solver(K_mm);
+	require(
+	    solver.info() == Success,
+	    "Eigendecomposition of landmark kernel matrix failed.");
+
+	VectorXd eigenvalues = solver.eigenvalues();
+	const float64_t tolerance = m_num_landmarks *
+	                            std::numeric_limits<float64_t>::epsilon() *
+	                            eigenvalues.maxCoeff();
+	for (index_t i = 0; i < m_num_landmarks; ++i)
+		eigenvalues[i] =
+		    eigenvalues[i] > tolerance ? 1.0 / std::sqrt(eigenvalues[i]) : 0;
+
+	m_normalization = SGMatrix<float64_t>(m_num_landmarks, m_num_landmarks);
+	Map<MatrixXd> normalization(
+	    m_normalization.matrix, m_num_landmarks, m_num_landmarks);
+	normalization = solver.eigenvectors() * eigenvalues.asDiagonal() *
+	                solver.eigenvectors().transpose();
+
+	m_fitted.store(true);
+}
+
+std::shared_ptr<Features>
+NystromPreprocessor::transform(std::shared_ptr<Features> features, bool inplace)
+{
+	assert_fitted();
+	require(features, "No features provided");
+
+	auto num_vectors = features->get_num_vectors();
+	Map<MatrixXd> normalization(
+	    m_normalization.matrix, m_num_landmarks, m_num_landmarks);
+
+	// In-place, the feature map overwrites the storage of dense input
+	// features of at least num_landmarks dimensions. Column i of the result
+	// ends before column i of the input begins, so that blocks of vectors
+	// that are still to be mapped are never overwritten.
+	SGMatrix<float64_t> result;
+	auto dense = std::dynamic_pointer_cast<DenseFeatures<float64_t>>(features);
+	if (inplace && dense && dense->get_num_features() >= m_num_landmarks)
+		result = dense->get_feature_matrix();
+	else
+		result = SGMatrix<float64_t>(m_num_landmarks, num_vectors);
+	result.num_rows = m_num_landmarks;
+	result.num_cols = num_vectors;
+
+	auto kernel = clone_kernel();
+	kernel->init(features, m_landmarks);
+
+	// kernel rows of one block of vectors, landmarks x block
+	auto block_size = std::min<index_t>(m_block_size, num_vectors);
+	MatrixXd K_mb(m_num_landmarks, block_size);
+	for (index_t start = 0; start < num_vectors; start += block_size)
+	{
+		auto current = std::min<index_t>(block_size, num_vectors - start);
+
+#pragma omp parallel for
+		for (index_t i = 0; i < current; ++i)
+		{
+			for (index_t j = 0; j < m_num_landmarks; ++j)
+				K_mb(j, i) = kernel->kernel(start + i, j);
+		}
+
+		Map<MatrixXd> result_block(
+		    result.get_column_vector(start), m_num_landmarks, current);
+		result_block.noalias() = normalization * K_mb.leftCols(current);
+	}
+
+	kernel->cleanup();
+
+	return std::make_shared<DenseFeatures<float64_t>>(result);
+}
+
+std::shared_ptr<Kernel> NystromPreprocessor::clone_kernel() const
+{
+	auto lhs = m_kernel->get_lhs();
+	auto rhs = m_kernel->get_rhs();
+	if (!lhs || !rhs)
+		return make_clone(m_kernel);
+
+	// clone without the features and restore them afterwards
+	auto restore = make_scope_guard([&]() { m_kernel->init(lhs, rhs); });
+	m_kernel->remove_lhs_and_rhs();
+	return make_clone(m_kernel);
+}
+
+SGVector<index_t> NystromPreprocessor::select_landmarks(
+    const std::shared_ptr<Kernel>& kernel, index_t num_vectors)
+{
+	SGVector<index_t> landmarks;
+	switch (m_sampling)
+	{
+	case NS_UNIFORM:
+		landmarks = sample_uniform(num_vectors, m_num_landmarks);
+		break;
+	case NS_KMEANS_PLUSPLUS:
+		landmarks = sample_kmeans_plusplus(kernel, num_vectors);
+		break;
+	case NS_LEVERAGE_SCORE:
+		landmarks = sample_leverage_scores(kernel, num_vectors);
+		break;
+	default:
+		error("Landmark sampling strategy {} not supported", m_sampling);
+	}
+
+	std::sort(landmarks.begin(), landmarks.end());
+	return landmarks;
+}
+
+SGVector<index_t>
+NystromPreprocessor::sample_uniform(index_t num_vectors, index_t num_samples)
+{
+	SGVector<index_t> permutation(num_vectors);
+	permutation.range_fill();
+	random::shuffle(permutation, m_prng);
+
+	SGVector<index_t> samples(num_samples);
+	std::copy_n(permutation.begin(), num_samples, samples.begin());
+	return samples;
+}
+
+index_t NystromPreprocessor::sample_weighted(const SGVector<float64_t>& weights)
+{
+	auto total = std::accumulate(weights.begin(), weights.end(), 0.0);
+	require(
+	    total > 0, "Sampling weights must not all be zero, consider choosing "
+	               "fewer landmarks.");
+
+	UniformRealDistribution<float64_t> uniform(0.0, total);
+	auto threshold = uniform(m_prng);
+	float64_t cumulative = 0;
+	for (index_t i = 0; i < weights.vlen; ++i)
+	{
+		cumulative += weights[i];
+		if (weights[i] > 0 && cumulative >= threshold)
+			return i;
+	}
+
+	// guard against rounding: last index with positive weight
+	for (index_t i = weights.vlen - 1; i >= 0; --i)
+	{
+		if (weights[i] > 0)
+			return i;
+	}
+	return 0;
+}
+
+SGVector<index_t> NystromPreprocessor::sample_kmeans_plusplus(
+    const std::shared_ptr<Kernel>& kernel, index_t num_vectors)
+{
+	SGVector<index_t> landmarks(m_num_landmarks);
+	SGVector<float64_t> diagonal(num_vectors);
+	SGVector<float64_t> distances(num_vectors);
+
+#pragma omp parallel for
+	for (index_t i = 0; i < num_vectors; ++i)
+		diagonal[i] = kernel->kernel(i, i);
+	distances.set_const(std::numeric_limits<float64_t>::infinity());
+
+	landmarks[0] = sample_uniform(num_vectors, 1)[0];
+	for (index_t k = 1; k < m_num_landmarks; ++k)
+	{
+		auto last = landmarks[k - 1];
+
+		// squared feature space distance to the closest landmark
+#pragma omp parallel for
+		for (index_t i = 0; i < num_vectors; ++i)
+		{
+			auto dist = diagonal[i] + diagonal[last] -
+			            2 * kernel->kernel(i, last);
+			distances[i] = std::max(0.0, std::min(distances[i], dist));
+		}
+		for (index_t j = 0; j < k; ++j)
+			distances[landmarks[j]] = 0;
+
+		landmarks[k] = sample_weighted(distances);
+	}
+
+	return landmarks;
+}
+
+SGVector<index_t> NystromPreprocessor::sample_leverage_scores(
+    const std::shared_ptr<Kernel>& kernel, index_t num_vectors)
+{
+	// uniform pilot sample to approximate the kernel matrix
+	auto num_pilot = std::min<index_t>(num_vectors, 2 * m_num_landmarks);
+	auto pilot = sample_uniform(num_vectors, num_pilot);
+
+	MatrixXd K_np(num_vectors, num_pilot);
+	VectorXd diagonal(num_vectors);
+#pragma omp parallel for
+	for (index_t i = 0; i < num_vectors; ++i)
+	{
+		diagonal[i] = kernel->kernel(i, i);
+		for (index_t j = 0; j < num_pilot; ++j)
+			K_np(i, j) = kernel->kernel(i, pilot[j]);
+	}
+
+	MatrixXd K_pp(num_pilot, num_pilot);
+	for (index_t j = 0; j < num_pilot; ++j)
+		K_pp.row(j) = K_np.row(pilot[j]);
+
+	// ridge leverage scores
+	// l_i = (k_ii - k_ip (K_pp + lambda I)^{-1} k_pi) / lambda
+	auto lambda = m_leverage_regularization * diagonal.mean();
+	require(lambda > 0, "Leverage score regularization must be positive.");
+	K_pp.diagonal().array() += lambda;
+	MatrixXd projected = K_pp.llt().solve(K_np.transpose());
+
+	SGVector<float64_t> scores(num_vectors);
+#pragma omp parallel for
+	for (index_t i = 0; i < num_vectors; ++i)
+		scores[i] = std::max(
+		    0.0, (diagonal[i] - K_np.row(i).dot(projected.col(i))) / lambda);
+
+	SGVector<index_t> landmarks(m_num_landmarks);
+	for (index_t k = 0; k < m_num_landmarks; ++k)
+	{
+		landmarks[k] = sample_weighted(scores);
+		scores[landmarks[k]] = 0;
+	}
+
+	return landmarks;
+}
@@ -0,0 +1,185 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef NYSTROMPREPROCESSOR_H__
+#define NYSTROMPREPROCESSOR_H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/Kernel.h>
+#include <shogun/lib/common.h>
+#include <shogun/mathematics/RandomMixin.h>
+#include <shogun/preprocessor/Preprocessor.h>
+
+namespace shogun
+{
+
+/** Landmark selection strategy of NystromPreprocessor */
+enum ENystromSampling
+{
+	/** landmarks are drawn uniformly without replacement */
+	NS_UNIFORM = 10,
+	/** landmarks are drawn with kernel k-means++ seeding, i.e. with
+	 * probability proportional to the squared feature space distance to the
+	 * closest landmark chosen so far
+	 */
+	NS_KMEANS_PLUSPLUS = 20,
+	/** landmarks are drawn proportional to approximate ridge leverage
+	 * scores, estimated from a uniform pilot sample
+	 */
+	NS_LEVERAGE_SCORE = 30
+};
+
+/** @brief Preprocessor NystromPreprocessor computes an explicit low-rank
+ * feature map of an arbitrary kernel with the Nyström method.
+ *
+ * Given m landmarks \f$z_1,\dots,z_m\f$ selected from the training features,
+ * every vector x is mapped to
+ *
+ * \f[
+ * \phi(x) = K_{mm}^{-1/2} [k(x, z_1), \dots, k(x, z_m)]^\top
+ * \f]
+ *
+ * where \f$K_{mm}\f$ is the kernel matrix of the landmarks and the inverse
+ * square root is taken as a pseudo-inverse. Then \f$\phi(x)^\top\phi(y)\f$
+ * approximates \f$k(x, y)\f$, so that the resulting DenseFeatures can be fed
+ * into linear solvers (e.g. LibLinear, OnlineSVMSGD) or linear PCA instead of
+ * kernel machines, reducing training costs from \f$O(n^2)\f$ to
+ * \f$O(nm^2)\f$. The feature map is evaluated in blocks of vectors, each
+ * block being computed in parallel, so that only the output has to be stored.
+ *
+ * Landmarks are selected according to ENystromSampling.
+ *
+ * Williams, C. K. I., & Seeger, M. (2001). Using the Nyström method to speed
+ * up kernel machines. Advances in neural information processing systems.
+ *
+ * Musco, C., & Musco, C. (2017). Recursive sampling for the Nyström method.
+ * Advances in neural information processing systems.
+ */
+class NystromPreprocessor : public RandomMixin<Preprocessor>
+{
+public:
+	/** default constructor */
+	NystromPreprocessor();
+
+	/** constructor
+	 * @param kernel kernel to approximate
+	 * @param num_landmarks number of landmarks
+	 */
+	NystromPreprocessor(std::shared_ptr<Kernel> kernel, int32_t num_landmarks);
+
+	~NystromPreprocessor() override;
+
+	/** Selects the landmarks and computes the normalization of the feature
+	 * map.
+	 *
+	 * @param features training features
+	 */
+	void fit(std::shared_ptr<Features> features) override;
+
+	/** Apply the feature map. The kernel is not modified, a copy is
+	 * initialized with the features and the landmarks.
+	 *
+	 * @param features features to transform, must be compatible with the
+	 * kernel
+	 * @param inplace whether the feature matrix of dense features with at
+	 * least num_landmarks dimensions may be overwritten by the result
+	 * @return dense features of dimension num_landmarks
+	 */
+	std::shared_ptr<Features>
+	transform(std::shared_ptr<Features> features, bool inplace = true) override;
+
+	/** @return indices of the training vectors chosen as landmarks */
+	SGVector<index_t> get_landmark_indices() const
+	{
+		return m_landmark_indices;
+	}
+
+	/** @return the inverse square root of the landmark kernel matrix */
+	SGMatrix<float64_t> get_normalization() const
+	{
+		return m_normalization;
+	}
+
+	EFeatureClass get_feature_class() override
+	{
+		return C_ANY;
+	}
+
+	EFeatureType get_feature_type() override
+	{
+		return F_ANY;
+	}
+
+	/** @return object name */
+	const char* get_name() const override
+	{
+		return "NystromPreprocessor";
+	}
+
+	/** @return the type of preprocessor */
+	EPreprocessorType get_type() const override
+	{
+		return P_NYSTROM;
+	}
+
+protected:
+	/** select landmarks from the training features
+	 *
+	 * @param kernel kernel initialized on the training features
+	 * @param num_vectors number of training vectors
+	 * @return sorted indices of the landmarks
+	 */
+	virtual SGVector<index_t> select_landmarks(
+	    const std::shared_ptr<Kernel>& kernel, index_t num_vectors);
+
+private:
+	void init();
+
+	/** @return copy of the kernel without its features */
+	std::shared_ptr<Kernel> clone_kernel() const;
+
+	/** uniform sampling without replacement */
+	SGVector<index_t> sample_uniform(index_t num_vectors, index_t num_samples);
+
+	/** kernel k-means++ seeding */
+	SGVector<index_t> sample_kmeans_plusplus(
+	    const std::shared_ptr<Kernel>& kernel, index_t num_vectors);
+
+	/** approximate ridge leverage score sampling */
+	SGVector<index_t> sample_leverage_scores(
+	    const std::shared_ptr<Kernel>& kernel, index_t num_vectors);
+
+	/** draw an index proportional to the non-negative weights */
+	index_t sample_weighted(const SGVector<float64_t>& weights);
+
+protected:
+	/** kernel to approximate */
+	std::shared_ptr<Kernel> m_kernel;
+
+	/** number of landmarks */
+	int32_t m_num_landmarks;
+
+	/** landmark selection strategy */
+	ENystromSampling m_sampling;
+
+	/** ridge regularization of leverage scores, relative to the mean of the
+	 * kernel diagonal */
+	float64_t m_leverage_regularization;
+
+	/** number of vectors whose feature map is computed at once */
+	int32_t m_block_size;
+
+	/** landmarks, copied from the training features */
+	std::shared_ptr<Features> m_landmarks;
+
+	/** indices of landmarks in training features */
+	SGVector<index_t> m_landmark_indices;
+
+	/** pseudo inverse square root of landmark kernel matrix */
+	SGMatrix<float64_t> m_normalization;
+};
+}
+#endif
@@ -10,6 +10,7 @@
 #include <shogun/io/SGIO.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/LinalgRandomized.h>
 #include <shogun/preprocessor/DensePreprocessor.h>
 #include <shogun/preprocessor/PCA.h>
 
@@ -19,7 +20,7 @@ using namespace Eigen;
 PCA::PCA(
     bool do_whitening, EPCAMode mode, float64_t thresh, EPCAMethod method,
     EPCAMemoryMode mem_mode)
-    : DensePreprocessor<float64_t>()
+    : RandomMixin<DensePreprocessor<float64_t>>()
 {
 	init();
 	m_whitening = do_whitening;
@@ -30,7 +31,7 @@ PCA::PCA(
 }
 
 PCA::PCA(EPCAMethod method, bool do_whitening, EPCAMemoryMode mem_mode)
-    : DensePreprocessor<float64_t>()
+    : RandomMixin<DensePreprocessor<float64_t>>()
 {
 	init();
 	m_whitening = do_whitening;
@@ -51,6 +52,9 @@ void PCA::init()
 	m_method = AUTO;
 	m_eigenvalue_zero_tolerance = 1e-15;
 	m_target_dim = 1;
+	m_oversampling = 10;
+	m_power_iterations = 2;
+	m_num_samples_seen = 0;
 
 	SG_ADD(
 	    &m_transformation_matrix, "transformation_matrix",
@@ -72,6 +76,15 @@ void PCA::init()
 	SG_ADD(
 	    &m_target_dim, "target_dim", "target dimensionality of preprocessor",
 	    ParameterProperties::HYPER);
+	SG_ADD(
+	    &m_oversampling, "oversampling",
+	    "Number of extra random projections of randomized SVD.");
+	SG_ADD(
+	    &m_power_iterations, "power_iterations",
+	    "Number of power iterations of randomized SVD.");
+	SG_ADD(
+	    &m_num_samples_seen, "num_samples_seen",
+	    "Number of vectors seen by incremental fitting.");
 	SG_ADD_OPTIONS(
 	    (machine_int_t*)&m_mode, "mode", "PCA Mode.",
 	    ParameterProperties::HYPER,
@@ -83,7 +96,7 @@ void PCA::init()
 	SG_ADD_OPTIONS(
 	    (machine_int_t*)&m_method, "method",
 	    "Method used for PCA calculation", ParameterProperties::NONE,
-	    SG_OPTIONS(AUTO, SVD, EVD));
+	    SG_OPTIONS(AUTO, SVD, EVD, RANDOMIZED));
 }
 
 PCA::~PCA()
@@ -100,6 +113,7 @@ void PCA::fit_impl(const SGMatrix<float64_t>& feature_matrix)
 	// max target dim allowed
 	auto max_dim_allowed = std::min(num_vectors, num_features);
 	num_dim = 0;
+	m_num_samples_seen = 0;
 
 	require(
 	    m_target_dim <= max_dim_allowed,
@@ -113,15 +127,21 @@ void PCA::fit_impl(const SGMatrix<float64_t>& feature_matrix)
 	data_mean = fmatrix.rowwise().sum() / (float64_t)num_vectors;
 	fmatrix = fmatrix.colwise() - data_mean;
 
-	m_eigenvalues_vector = SGVector<float64_t>(max_dim_allowed);
-
 	if (m_method == AUTO)
 		m_method = (num_vectors > num_features) ? EVD : SVD;
 
-	if (m_method == EVD)
-		init_with_evd(feature_matrix, max_dim_allowed);
+	if (m_method == RANDOMIZED)
+	{
+		init_with_randomized_svd(feature_matrix);
+	}
 	else
-		init_with_svd(feature_matrix, max_dim_allowed);
+	{
+		m_eigenvalues_vector = SGVector<float64_t>(max_dim_allowed);
+		if (m_method == EVD)
+			init_with_evd(feature_matrix, max_dim_allowed);
+		else
+			init_with_svd(feature_matrix, max_dim_allowed);
+	}
 
 	// restore feature matrix
 	fmatrix = fmatrix.colwise() + data_mean;
@@ -263,25 +283,180 @@ void PCA::init_with_svd(const SGMatrix<float64_t> &feature_matrix, int32_t max_d
 	transformMatrix = svd.matrixV().block(0, 0, num_features, num_dim);
 
 	if (m_whitening)
+		whiten(num_vectors);
+}
+
+void PCA::init_with_randomized_svd(const SGMatrix<float64_t>& feature_matrix)
+{
+	auto num_vectors = feature_matrix.num_cols;
+	auto num_features = feature_matrix.num_rows;
+
+	require(
+	    m_mode == FIXED_NUMBER,
+	    "Randomized PCA only computes the top {} components and thus only "
+	    "supports FIXED_NUMBER mode.",
+	    m_target_dim);
+
+	num_dim = m_target_dim;
+	num_old_dim = num_features;
+	io::info(
+	    "Computing top {} components using randomized SVD with {} "
+	    "oversampling and {} power iterations",
+	    num_dim, m_oversampling, m_power_iterations);
+
+	// left singular vectors of the DxN data matrix form the eigenvectors
+	m_eigenvalues_vector = SGVector<float64_t>(num_dim);
+	m_transformation_matrix = SGMatrix<float64_t>(num_features, num_dim);
+	SGMatrix<float64_t> right_vectors;
+	linalg::randomized_svd(
+	    feature_matrix, m_eigenvalues_vector, m_transformation_matrix,
+	    right_vectors, num_dim, m_prng, m_oversampling, m_power_iterations);
+
+	Map<VectorXd> eigenValues(m_eigenvalues_vector.vector, num_dim);
+	eigenValues = eigenValues.cwiseProduct(eigenValues) / (num_vectors - 1);
+
+	if (m_whitening)
+		whiten(num_vectors);
+}
+
+void PCA::whiten(int64_t num_vectors)
+{
+	auto num_features = m_transformation_matrix.num_rows;
+	Map<MatrixXd> transformMatrix(
+	    m_transformation_matrix.matrix, num_features, num_dim);
+
+	for (int32_t i = 0; i < num_dim; i++)
 	{
-		for (int32_t i = 0; i < num_dim; i++)
+		if (Math::fequals_abs<float64_t>(
+		        0.0, m_eigenvalues_vector[i], m_eigenvalue_zero_tolerance))
 		{
-			if (Math::fequals_abs<float64_t>(0.0, eigenValues[i], m_eigenvalue_zero_tolerance))
-			{
+			io::warn(
+			    "Covariance matrix has almost zero Eigenvalue (ie "
+			    "Eigenvalue within a tolerance of {:E} around 0) at "
+			    "dimension {}. Consider reducing its dimension.",
+			    m_eigenvalue_zero_tolerance, i + 1);
+
+			transformMatrix.col(i) = MatrixXd::Zero(num_features, 1);
+			continue;
+		}
 
-				io::warn("Covariance matrix has almost zero Eigenvalue (ie "
-					"Eigenvalue within a tolerance of {:E} around 0) at "
-					"dimension {}. Consider reducing its dimension.",
-					m_eigenvalue_zero_tolerance, i + 1);
+		transformMatrix.col(i) /=
+		    std::sqrt(m_eigenvalues_vector[i] * (num_vectors - 1));
+	}
+}
 
-				transformMatrix.col(i) = MatrixXd::Zero(num_features, 1);
-				continue;
-			}
+void PCA::partial_fit(std::shared_ptr<Features> features)
+{
+	require(features, "No features provided");
+	require(
+	    features->get_feature_class() == C_DENSE &&
+	        features->get_feature_type() == F_DREAL,
+	    "Provided features ({}) have to be dense real valued features.",
+	    features->get_name());
+
+	partial_fit_impl(
+	    features->as<DenseFeatures<float64_t>>()->get_feature_matrix());
+	m_fitted.store(true);
+}
 
-			transformMatrix.col(i) /=
-			    std::sqrt(eigenValues[i] * (num_vectors - 1));
-		}
+void PCA::reset_partial_fit()
+{
+	DensePreprocessor<float64_t>::reset_partial_fit();
+	m_num_samples_seen = 0;
+}
+
+void PCA::partial_fit_impl(const SGMatrix<float64_t>& feature_matrix)
+{
+	auto num_vectors = feature_matrix.num_cols;
+	auto num_features = feature_matrix.num_rows;
+
+	require(
+	    m_mode == FIXED_NUMBER,
+	    "Incremental PCA only supports FIXED_NUMBER mode.");
+	if (m_num_samples_seen == 0)
+	{
+		require(
+		    num_vectors >= m_target_dim,
+		    "First batch ({} vectors) must contain at least as many vectors "
+		    "as the target dimension ({}).",
+		    num_vectors, m_target_dim);
+		require(
+		    m_target_dim <= num_features,
+		    "Target dimension ({}) must not exceed the number of features "
+		    "({}).",
+		    m_target_dim, num_features);
+	}
+	else
+	{
+		require(
+		    num_features == num_old_dim,
+		    "Number of features of batch ({}) does not match number of "
+		    "features seen so far ({}).",
+		    num_features, num_old_dim);
+	}
+	if (num_vectors == 0)
+		return;
+
+	Map<MatrixXd> fmatrix(feature_matrix.matrix, num_features, num_vectors);
+	VectorXd batch_mean = fmatrix.rowwise().sum() / (float64_t)num_vectors;
+
+	// stack previous components (scaled by their singular values), the
+	// centered batch and a mean correction term, then re-decompose
+	auto num_prev_dim = m_num_samples_seen > 0 ? num_dim : 0;
+	auto num_rows = num_vectors + (m_num_samples_seen > 0 ? num_dim + 1 : 0);
+	MatrixXd stacked(num_rows, num_features);
+	stacked.bottomRows(num_vectors) =
+	    (fmatrix.colwise() - batch_mean).transpose();
+
+	auto num_total = m_num_samples_seen + num_vectors;
+	if (m_num_samples_seen > 0)
+	{
+		Map<MatrixXd> transformMatrix(
+		    m_transformation_matrix.matrix, num_features, num_dim);
+		Map<VectorXd> eigenValues(m_eigenvalues_vector.vector, num_dim);
+		Map<VectorXd> mean(m_mean_vector.vector, num_features);
+
+		// singular values are sqrt(ev * (n - 1)), whitened columns have
+		// been divided by them once
+		VectorXd scale =
+		    (eigenValues * std::max<float64_t>(m_num_samples_seen - 1, 1))
+		        .cwiseSqrt();
+		if (m_whitening)
+			scale = scale.cwiseProduct(scale);
+		stacked.topRows(num_prev_dim) =
+		    scale.asDiagonal() * transformMatrix.transpose();
+		stacked.row(num_prev_dim) =
+		    std::sqrt(
+		        (float64_t)m_num_samples_seen * num_vectors / num_total) *
+		    (mean - batch_mean).transpose();
+
+		mean = (mean * m_num_samples_seen + batch_mean * num_vectors) /
+		       (float64_t)num_total;
+	}
+	else
+	{
+		m_mean_vector = SGVector<float64_t>(num_features);
+		Map<VectorXd>(m_mean_vector.vector, num_features) = batch_mean;
 	}
+
+	BDCSVD<MatrixXd> svd(stacked, ComputeThinV);
+
+	num_old_dim = num_features;
+	num_dim = std::min<index_t>(m_target_dim, svd.singularValues().size());
+	m_num_samples_seen = num_total;
+
+	m_eigenvalues_vector = SGVector<float64_t>(num_dim);
+	Map<VectorXd> eigenValues(m_eigenvalues_vector.vector, num_dim);
+	eigenValues = svd.singularValues().head(num_dim);
+	eigenValues = eigenValues.cwiseProduct(eigenValues) /
+	              std::max<float64_t>(num_total - 1, 1);
+
+	m_transformation_matrix = SGMatrix<float64_t>(num_features, num_dim);
+	Map<MatrixXd>(m_transformation_matrix.matrix, num_features, num_dim) =
+	    svd.matrixV().leftCols(num_dim);
+
+	if (m_whitening)
+		whiten(std::max<int64_t>(num_total, 2));
 }
 
 SGMatrix<float64_t> PCA::apply_to_matrix(SGMatrix<float64_t> matrix)
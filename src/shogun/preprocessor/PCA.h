@@ -12,26 +12,14 @@
 #include <shogun/lib/config.h>
 
 #include <shogun/features/Features.h>
+#include <shogun/features/streaming/StreamingDenseFeatures.h>
 #include <shogun/lib/common.h>
+#include <shogun/mathematics/RandomMixin.h>
 #include <shogun/preprocessor/DensePreprocessor.h>
+#include <shogun/preprocessor/PCAMethod.h>
 
 namespace shogun
 {
-/** Matrix decomposition method for PCA */
-enum EPCAMethod
-{
-	/** if N>D then EVD is chosen automatically else SVD is chosen
-	 * (D-dimensions N-number of vectors)
-	 */
-	AUTO = 10,
-	/** SVD based PCA. Time complexity ~14dn^2 (d-dimensions n-number of vectors) */
-	SVD = 20,
-	/** Eigenvalue decomposition of covariance matrix.
-	 * Time complexity ~10d^3 (d-dimensions n-number of vectors)
-	 */
-	EVD = 30
-};
-
 /** mode of pca */
 enum EPCAMode
 {
@@ -83,9 +71,23 @@ enum EPCAMemoryMode
  * using the formula \f$e_i = \frac{\sqrt{d_i}}{N-1}\f$.
  * The time complexity of this method is \f$~14DN^2\f$ and should be used when N < D.
  *
+ * <em>RANDOMIZED</em> : Randomized truncated SVD of feature matrix X.
+ * The range of X is approximated by projecting it onto T+p random directions
+ * and refining the projection with q power iterations, after which only a
+ * small (T+p)xN matrix has to be decomposed. This is the method of choice when
+ * only a few components of a large matrix are needed. Requires FIXED_NUMBER
+ * mode, p and q are set through the "oversampling" and "power_iterations"
+ * parameters.
+ *
  * <em>AUTO</em> : This mode automagically chooses one of the above modes for the user
  * based on whether N > D (chooses EVD) or N < D (chooses SVD).
  *
+ * Alternatively, the transformation can be fitted incrementally on
+ * mini-batches via partial_fit() or fit_streaming(), which keeps only the
+ * current T components and the mean in memory (Ross et al., 2008,
+ * Incremental Learning for Robust Visual Tracking). This always works in
+ * FIXED_NUMBER mode.
+ *
  * This class provides 3 modes to determine the value of T :
  *
  * <em>FIXED_NUMBER</em> : T is supplied by user directly using set_target_dims method
@@ -104,7 +106,7 @@ enum EPCAMemoryMode
  *
  * Note that vectors/matrices don't have to have zero mean as it is substracted within the class.
  */
-class PCA : public DensePreprocessor<float64_t>
+class PCA : public RandomMixin<DensePreprocessor<float64_t>>
 {
 	public:
 
@@ -136,6 +138,15 @@ class PCA : public DensePreprocessor<float64_t>
 		 */
 		SGVector<float64_t> apply_to_feature_vector(SGVector<float64_t> vector) override;
 
+		/** Update the transformation with a mini-batch of vectors, using an
+		 * incremental SVD of the current components stacked with the
+		 * centered batch. A preceding call to fit() is discarded; calling
+		 * fit() afterwards restarts from scratch.
+		 *
+		 * @param features dense batch of feature vectors
+		 */
+		void partial_fit(std::shared_ptr<Features> features) override;
+
 		/** get transformation matrix, i.e. eigenvectors (potentially scaled if
 		 * do_whitening is true)
 		 */
@@ -191,6 +202,11 @@ class PCA : public DensePreprocessor<float64_t>
 
 		void fit_impl(const SGMatrix<float64_t>& feature_matrix) override;
 
+		/** incremental update of the transformation with a batch */
+		void partial_fit_impl(const SGMatrix<float64_t>& feature_matrix);
+
+		void reset_partial_fit() override;
+
 	protected:
 
 		/** transformation matrix */
@@ -222,11 +238,24 @@ class PCA : public DensePreprocessor<float64_t>
 		/** target dimension */
 		int32_t m_target_dim;
 
+		/** number of extra random projections for RANDOMIZED method */
+		int32_t m_oversampling;
+
+		/** number of power iterations for RANDOMIZED method */
+		int32_t m_power_iterations;
+
+		/** number of vectors seen so far by partial_fit */
+		int64_t m_num_samples_seen;
+
 	private:
 		/** Computes the transformation matrix using an eigenvalue decomposition. */
 		void init_with_evd(const SGMatrix<float64_t>& feature_matrix, int32_t max_dim_allowed);
 		/** Computes the transformation matrix using svd */
 		void init_with_svd(const SGMatrix<float64_t>& feature_matrix, int32_t max_dim_allowed);
+		/** Computes the transformation matrix using randomized svd */
+		void init_with_randomized_svd(const SGMatrix<float64_t>& feature_matrix);
+		/** Whitens the columns of the transformation matrix */
+		void whiten(int64_t num_vectors);
 };
 }
 #endif // PCA_H_
@@ -0,0 +1,33 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef PCAMETHOD_H_
+#define PCAMETHOD_H_
+
+#include <shogun/lib/config.h>
+
+namespace shogun
+{
+/** Matrix decomposition method for PCA */
+enum EPCAMethod
+{
+	/** if N>D then EVD is chosen automatically else SVD is chosen
+	 * (D-dimensions N-number of vectors)
+	 */
+	AUTO = 10,
+	/** SVD based PCA. Time complexity ~14dn^2 (d-dimensions n-number of vectors) */
+	SVD = 20,
+	/** Eigenvalue decomposition of covariance matrix.
+	 * Time complexity ~10d^3 (d-dimensions n-number of vectors)
+	 */
+	EVD = 30,
+	/** Randomized SVD of the feature matrix, computing only the top T
+	 * components with a randomized range finder (Halko et al., 2011).
+	 * Time complexity ~4dn(T+p)(q+1) (p oversampling, q power iterations).
+	 * Only available in FIXED_NUMBER mode.
+	 */
+	RANDOMIZED = 40
+};
+}
+#endif // PCAMETHOD_H_
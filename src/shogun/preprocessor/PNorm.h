@@ -55,6 +55,13 @@ class PNorm : public DensePreprocessor<float64_t>
 		/// return a type of preprocessor
 		EPreprocessorType get_type () const override { return P_PNORM; }
 
+		bool is_vectorwise () const override
+		{
+			return true;
+		}
+
+		void transform_vector_inplace (float64_t* vector, index_t num_features) const override;
+
 		/**
 		 * Set norm
 		 * @param pnorm norm value
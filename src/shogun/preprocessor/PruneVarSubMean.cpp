@@ -29,36 +29,68 @@ PruneVarSubMean::~PruneVarSubMean()
 
 void PruneVarSubMean::fit_impl(const SGMatrix<float64_t>& feature_matrix)
 {
+	fit_with_statistics(feature_matrix);
+}
 
-	auto num_examples = feature_matrix.num_cols;
-	auto num_features = feature_matrix.num_rows;
-
-	m_idx = SGVector<int32_t>();
-	m_std = SGVector<float64_t>();
-
-	SGVector<float64_t> var(num_features);
+SGVector<float64_t> PruneVarSubMean::init_fit_statistics(index_t num_features) const
+{
+	// number of vectors, means and sums of squared deviations from the means
+	SGVector<float64_t> statistics(1 + 2 * num_features);
+	statistics.zero();
+	return statistics;
+}
 
-	// compute mean
-	m_mean = linalg::rowwise_sum(feature_matrix);
-	linalg::scale(m_mean, m_mean, 1.0 / num_examples);
+void PruneVarSubMean::accumulate_fit_statistics(
+    SGVector<float64_t>& statistics, const float64_t* vector,
+    index_t num_features) const
+{
+	// Welford's update
+	auto count = ++statistics[0];
+	auto mean = statistics.vector + 1;
+	auto m2 = mean + num_features;
+	for (auto j : range(num_features))
+	{
+		auto delta = vector[j] - mean[j];
+		mean[j] += delta / count;
+		m2[j] += delta * (vector[j] - mean[j]);
+	}
+}
 
-	// compute var
-	for (auto i : range(num_examples))
+void PruneVarSubMean::merge_fit_statistics(
+    SGVector<float64_t>& statistics, const SGVector<float64_t>& other) const
+{
+	auto num_features = (statistics.vlen - 1) / 2;
+	auto count = statistics[0], other_count = other[0];
+	if (other_count == 0)
+		return;
+
+	auto total = count + other_count;
+	auto mean = statistics.vector + 1;
+	auto m2 = mean + num_features;
+	for (auto j : range(num_features))
 	{
-		for (auto j : range(num_features))
-		{
-			auto diff =
-			    linalg::add(m_mean, feature_matrix.get_column(i), 1.0, -1.0);
-			var[j] += linalg::dot(diff, diff);
-		}
+		auto delta = other[1 + j] - mean[j];
+		mean[j] += delta * other_count / total;
+		m2[j] += other[1 + num_features + j] + delta * delta * count * other_count / total;
 	}
+	statistics[0] = total;
+}
+
+void PruneVarSubMean::fit_statistics(
+    const SGVector<float64_t>& statistics, index_t num_features,
+    int64_t num_vectors)
+{
+	require(num_vectors > 0, "No feature vectors provided");
+	const float64_t* mean = statistics.vector + 1;
+	const float64_t* m2 = mean + num_features;
 
 	int32_t num_ok = 0;
 	auto idx_ok = SGVector<int32_t>(num_features);
+	SGVector<float64_t> var(num_features);
 
 	for (auto j : range(num_features))
 	{
-		var[j] /= num_examples;
+		var[j] = m2[j] / num_vectors;
 
 		if (var[j] >= 1e-14)
 		{
@@ -69,19 +101,39 @@ void PruneVarSubMean::fit_impl(const SGMatrix<float64_t>& feature_matrix)
 
 	io::info("Reducing number of features from {} to {}", num_features, num_ok);
 
-	m_idx.resize_vector(num_ok);
-	SGVector<float64_t> new_mean(num_ok);
-	m_std.resize_vector(num_ok);
+	m_idx = SGVector<int32_t>(num_ok);
+	m_mean = SGVector<float64_t>(num_ok);
+	m_std = SGVector<float64_t>(num_ok);
 
 	for (auto j : range(num_ok))
 	{
 		m_idx[j] = idx_ok[j];
-		new_mean[j] = m_mean[idx_ok[j]];
+		m_mean[j] = mean[idx_ok[j]];
 		m_std[j] = std::sqrt(var[idx_ok[j]]);
 	}
 	m_num_idx = num_ok;
-	m_mean = new_mean;
 
+	DensePreprocessor<float64_t>::fit_statistics(statistics, num_features, num_vectors);
+}
+
+index_t PruneVarSubMean::get_num_transformed_features(index_t num_features) const
+{
+	require(
+	    m_num_idx == 0 || m_idx[m_num_idx - 1] < num_features,
+	    "Number of features ({}) is less than fitted", num_features);
+	return m_num_idx;
+}
+
+void PruneVarSubMean::transform_vector_inplace(float64_t* vector, index_t num_features) const
+{
+	// kept features are in increasing order, so none is overwritten
+	// before it is read
+	for (auto feat : range(m_num_idx))
+	{
+		vector[feat] = vector[m_idx[feat]] - m_mean[feat];
+		if (m_divide_by_std)
+			vector[feat] /= m_std[feat];
+	}
 }
 
 SGMatrix<float64_t>
@@ -5,6 +5,7 @@
  */
 
 #include <algorithm>
+#include <limits>
 #include <shogun/base/range.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 #include <shogun/preprocessor/RescaleFeatures.h>
@@ -23,10 +24,49 @@ RescaleFeatures::~RescaleFeatures()
 
 void RescaleFeatures::fit_impl(const SGMatrix<float64_t>& feature_matrix)
 {
-	int32_t num_examples = feature_matrix.num_cols;
-	int32_t num_features = feature_matrix.num_rows;
+	fit_with_statistics(feature_matrix);
+}
+
+SGVector<float64_t> RescaleFeatures::init_fit_statistics(index_t num_features) const
+{
+	// minimum values followed by maximum values
+	SGVector<float64_t> statistics(2 * num_features);
+	for (auto i : range(num_features))
+	{
+		statistics[i] = std::numeric_limits<float64_t>::infinity();
+		statistics[num_features + i] = -std::numeric_limits<float64_t>::infinity();
+	}
+	return statistics;
+}
+
+void RescaleFeatures::accumulate_fit_statistics(
+    SGVector<float64_t>& statistics, const float64_t* vector,
+    index_t num_features) const
+{
+	for (auto i : range(num_features))
+	{
+		statistics[i] = std::min(vector[i], statistics[i]);
+		statistics[num_features + i] = std::max(vector[i], statistics[num_features + i]);
+	}
+}
+
+void RescaleFeatures::merge_fit_statistics(
+    SGVector<float64_t>& statistics, const SGVector<float64_t>& other) const
+{
+	auto num_features = statistics.vlen / 2;
+	for (auto i : range(num_features))
+	{
+		statistics[i] = std::min(other[i], statistics[i]);
+		statistics[num_features + i] = std::max(other[num_features + i], statistics[num_features + i]);
+	}
+}
+
+void RescaleFeatures::fit_statistics(
+    const SGVector<float64_t>& statistics, index_t num_features,
+    int64_t num_vectors)
+{
 	require(
-	    num_examples > 1, "number of feature vectors should be at least 2!");
+	    num_vectors > 1, "number of feature vectors should be at least 2!");
 
 	io::info("Extracting min and range values for each feature");
 
@@ -34,16 +74,8 @@ void RescaleFeatures::fit_impl(const SGMatrix<float64_t>& feature_matrix)
 	m_range = SGVector<float64_t>(num_features);
 	for (index_t i = 0; i < num_features; i++)
 	{
-		SGVector<float64_t> vec = feature_matrix.get_row_vector(i);
-		float64_t cur_min = vec[0];
-		float64_t cur_max = vec[0];
-
-		/* find the max and min values in one loop */
-		for (index_t j = 1; j < vec.vlen; j++)
-		{
-			cur_min = std::min(vec[j], cur_min);
-			cur_max = std::max(vec[j], cur_max);
-		}
+		float64_t cur_min = statistics[i];
+		float64_t cur_max = statistics[num_features + i];
 
 		/* only rescale if range > 0 */
 		if ((cur_max - cur_min) > 0)
@@ -58,6 +90,7 @@ void RescaleFeatures::fit_impl(const SGMatrix<float64_t>& feature_matrix)
 		}
 	}
 
+	DensePreprocessor<float64_t>::fit_statistics(statistics, num_features, num_vectors);
 }
 
 SGMatrix<float64_t>
@@ -91,6 +124,20 @@ SGVector<float64_t> RescaleFeatures::apply_to_feature_vector(SGVector<float64_t>
 	return ret;
 }
 
+index_t RescaleFeatures::get_num_transformed_features(index_t num_features) const
+{
+	require(
+	    num_features == m_min.vlen, "Number of features ({}) must match the "
+	    "fitted number of features ({})", num_features, m_min.vlen);
+	return num_features;
+}
+
+void RescaleFeatures::transform_vector_inplace(float64_t* vector, index_t num_features) const
+{
+	for (auto i : range(num_features))
+		vector[i] = (vector[i] - m_min[i]) * m_range[i];
+}
+
 void RescaleFeatures::register_parameters()
 {
 	SG_ADD(&m_min, "min", "minimum values of each feature");
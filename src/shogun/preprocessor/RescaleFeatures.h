@@ -50,6 +50,29 @@ namespace shogun
 			return P_RESCALEFEATURES;
 		}
 
+		bool is_vectorwise() const override
+		{
+			return true;
+		}
+
+		index_t get_num_transformed_features(index_t num_features) const override;
+
+		void transform_vector_inplace(float64_t* vector, index_t num_features) const override;
+
+		SGVector<float64_t> init_fit_statistics(index_t num_features) const override;
+
+		void accumulate_fit_statistics(
+		    SGVector<float64_t>& statistics, const float64_t* vector,
+		    index_t num_features) const override;
+
+		void merge_fit_statistics(
+		    SGVector<float64_t>& statistics,
+		    const SGVector<float64_t>& other) const override;
+
+		void fit_statistics(
+		    const SGVector<float64_t>& statistics, index_t num_features,
+		    int64_t num_vectors) override;
+
 	private:
 		void register_parameters();
 
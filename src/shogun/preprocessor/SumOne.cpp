@@ -48,6 +48,12 @@ SGMatrix<float64_t> SumOne::apply_to_matrix(SGMatrix<float64_t> matrix)
 	return matrix;
 }
 
+void SumOne::transform_vector_inplace(float64_t* vector, index_t num_features) const
+{
+	SGVector<float64_t> vec(vector, num_features, false);
+	linalg::scale(vec, vec, 1.0 / linalg::sum(vec));
+}
+
 /// apply preproc on single feature vector
 /// result in feature matrix
 SGVector<float64_t> SumOne::apply_to_feature_vector(SGVector<float64_t> vector)
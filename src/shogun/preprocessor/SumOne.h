@@ -50,6 +50,13 @@ class SumOne : public DensePreprocessor<float64_t>
 		/// return a type of preprocessor
 		EPreprocessorType get_type() const override { return P_SUMONE; }
 
+		bool is_vectorwise() const override
+		{
+			return true;
+		}
+
+		void transform_vector_inplace(float64_t* vector, index_t num_features) const override;
+
 	protected:
 		SGMatrix<float64_t> apply_to_matrix(SGMatrix<float64_t> matrix) override;
 };
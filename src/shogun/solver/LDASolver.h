@@ -37,8 +37,8 @@
 #include <shogun/features/DenseFeatures.h>
 #include <shogun/labels/MulticlassLabels.h>
 #include <shogun/lib/config.h>
+#include <shogun/mathematics/ScatterMatrix.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
-#include <shogun/util/enumerate.h>
 #include <vector>
 
 namespace shogun
@@ -60,10 +60,12 @@ namespace shogun
 		SGVector<T> m_mean;
 		// Within covariance matrix
 		SGMatrix<T> m_within_cov;
+		// Class-wise means and scatter matrices
+		ScatterMatrix<T> m_scatter;
 
 		/**
-		 * Compute the total mean and for each class the number of data points
-		 * and its mean.
+		 * Compute the total mean and for each class the number of data points,
+		 * its mean and its scatter matrix.
 		 */
 		virtual void compute_means();
 
@@ -106,30 +108,17 @@ namespace shogun
 	{
 		index_t num_class = m_labels->get_num_classes();
 
+		m_scatter = ScatterMatrix<T>(
+		    *m_features, m_labels->get_int_labels(), num_class);
+
 		m_class_mean = std::vector<SGVector<T>>(num_class);
 		m_class_count = std::vector<index_t>(num_class);
 		for (index_t i = 0; i < num_class; ++i)
 		{
-			m_class_mean[i] = SGVector<T>(m_features->get_num_features());
-			linalg::zero(m_class_mean[i]);
-		}
-		m_mean = SGVector<T>(m_features->get_num_features());
-		linalg::zero(m_mean);
-
-		for (const auto& [data_i, label_i] : zip_iterator(m_features, m_labels))
-		{
-			auto c = static_cast<index_t>(label_i);
-			++m_class_count[c];
-			linalg::add(data_i, m_class_mean[c], m_class_mean[c]);
-		}
-
-		for (index_t i = 0; i < num_class; ++i)
-		{
-			linalg::add(m_mean, m_class_mean[i], m_mean);
-			linalg::scale(
-			    m_class_mean[i], m_class_mean[i], 1 / (T)m_class_count[i]);
+			m_class_mean[i] = m_scatter.get_mean(i);
+			m_class_count[i] = m_scatter.get_count(i);
 		}
-		linalg::scale(m_mean, m_mean, 1 / (T)m_features->get_num_vectors());
+		m_mean = m_scatter.get_total_mean();
 	}
 
 	template <typename T>
@@ -138,41 +127,12 @@ namespace shogun
 		index_t num_features = m_features->get_num_features();
 		index_t num_class = m_labels->get_num_classes();
 
-		auto mean_matrix =
-		    SGMatrix<T>(num_features, m_features->get_num_vectors());
-
-		// Center data with respect to each data point's class
-		for (const auto& [idx, data_i, label_i] : enumerate(m_features, m_labels))
-		{
-			mean_matrix.set_column(
-			    idx, linalg::add(
-			                 m_class_mean.at(label_i), data_i,
-			                 static_cast<T>(1), static_cast<T>(-1)));
-		}
-		// holds the feature matrix for each class
-		std::vector<SGMatrix<T>> centered_class(num_class);
-		std::vector<index_t> centered_class_col(num_class);
-
 		m_within_cov = SGMatrix<T>(num_features, num_features);
 		linalg::zero(m_within_cov);
-		for (auto i = 0; i < num_class; ++i)
-		{
-			centered_class[i] = SGMatrix<T>(num_features, m_class_count[i]);
-			linalg::zero(centered_class[i]);
-		}
-		for (const auto& [idx, label_i] : enumerate(*m_labels))
-		{
-			auto c = static_cast<index_t>(label_i);
-			centered_class[c].set_column(
-			    centered_class_col[c], mean_matrix.get_column(idx));
-			++centered_class_col[c];
-		}
 		for (index_t i = 0; i < num_class; ++i)
 		{
-			auto tmp = linalg::matrix_prod(
-			    centered_class[i], centered_class[i], false, true);
 			linalg::add(
-			    m_within_cov, tmp, m_within_cov, (T)1.0,
+			    m_within_cov, m_scatter.get_scatter(i), m_within_cov, (T)1.0,
 			    ((T)m_class_count[i] / (m_class_count[i] - 1)));
 		}
 
@@ -65,6 +65,7 @@ struct QuadraticTimeMMD::Self
 
 	SGVector<float64_t> sample_null_spectrum();
 	SGVector<float64_t> sample_null_permutation();
+	float64_t compute_p_value_permutation(float64_t statistic);
 	SGVector<float64_t> gamma_fit_null();
 
 	~Self() {}
@@ -308,7 +309,7 @@ float64_t QuadraticTimeMMD::normalize_statistic(float64_t statistic) const
 {
 	const index_t Nx=get_num_samples_p();
 	const index_t Ny=get_num_samples_q();
-	return Nx*Ny*statistic/(Nx+Ny);
+	return int64_t(Nx)*Ny*statistic/(Nx+Ny);
 }
 
 
@@ -371,6 +372,35 @@ SGVector<float64_t> QuadraticTimeMMD::Self::sample_null_permutation()
 	return null_samples;
 }
 
+float64_t QuadraticTimeMMD::Self::compute_p_value_permutation(float64_t statistic)
+{
+	SG_TRACE("Entering");
+	require(owner.get_kernel(), "Kernel is not set!");
+
+	init_permutation_job();
+	init_kernel();
+
+	// null samples are compared to the statistic before normalization
+	const index_t Nx=owner.get_num_samples_p();
+	const index_t Ny=owner.get_num_samples_q();
+	float32_t unnormalized_statistic=statistic*(Nx+Ny)/(int64_t(Nx)*Ny);
+
+	float64_t result=0;
+	if (precompute)
+	{
+		SGMatrix<float32_t> kernel_matrix=get_kernel_matrix();
+		result=permutation_job.p_value(kernel_matrix, unnormalized_statistic, prng);
+	}
+	else
+	{
+		auto kernel_functor=internal::Kernel(owner.get_kernel());
+		result=permutation_job.p_value(kernel_functor, unnormalized_statistic, prng);
+	}
+
+	SG_TRACE("Leaving");
+	return result;
+}
+
 SGVector<float64_t> QuadraticTimeMMD::Self::sample_null_spectrum()
 {
 	SG_TRACE("Entering");
@@ -543,6 +573,9 @@ float64_t QuadraticTimeMMD::compute_p_value(float64_t statistic)
 			result=Statistics::gamma_cdf(statistic, params[0], params[1]);
 			break;
 		}
+		case NAM_PERMUTATION:
+			result=self->compute_p_value_permutation(statistic);
+			break;
 		default:
 			result=HypothesisTest::compute_p_value(statistic);
 		break;
@@ -630,6 +663,28 @@ SGMatrix<index_t> QuadraticTimeMMD::get_permutation_inds() const
 	return self->permutation_job.m_all_inds;
 }
 
+void QuadraticTimeMMD::permutation_set_num_exceedances(index_t num_exceedances)
+{
+	require(num_exceedances>=0, "Number of exceedances ({}) cannot be negative!", num_exceedances);
+	self->permutation_job.m_num_exceedances=num_exceedances;
+}
+
+index_t QuadraticTimeMMD::permutation_get_num_exceedances() const
+{
+	return self->permutation_job.m_num_exceedances;
+}
+
+void QuadraticTimeMMD::permutation_set_block_size(index_t block_size)
+{
+	require(block_size>0, "Block size ({}) has to be > 0!", block_size);
+	self->permutation_job.m_block_size=block_size;
+}
+
+index_t QuadraticTimeMMD::permutation_get_block_size() const
+{
+	return self->permutation_job.m_block_size;
+}
+
 const char* QuadraticTimeMMD::get_name() const
 {
 	return "QuadraticTimeMMD";
@@ -259,6 +259,35 @@ public:
 	 */
 	SGMatrix<index_t> get_permutation_inds() const;
 
+	/**
+	 * Method that enables early stopping of the permutation test while computing
+	 * p-values. The permutations stop as soon as the given number of null-samples
+	 * exceeded the statistic, and the p-value is estimated from the permutations
+	 * done so far. Setting it to ceil(alpha*num_null_samples) yields the same test
+	 * decision at significance level alpha as running all the permutations, while
+	 * clearly non-significant tests stop early. By default, it is 0, which means
+	 * that early stopping is disabled.
+	 *
+	 * @param num_exceedances Number of exceeding null-samples after which the
+	 * permutation test is stopped, 0 to disable early stopping.
+	 */
+	void permutation_set_num_exceedances(index_t num_exceedances);
+
+	/** @return The number of exceeding null-samples for early stopping */
+	index_t permutation_get_num_exceedances() const;
+
+	/**
+	 * Method that sets the number of permutations that are evaluated together in
+	 * a single pass over the kernel matrix. Larger blocks need fewer passes but
+	 * more memory, which is linear in the block size and the number of samples.
+	 *
+	 * @param block_size Number of permutations per pass. Default is 64.
+	 */
+	void permutation_set_block_size(index_t block_size);
+
+	/** @return The number of permutations per pass over the kernel matrix */
+	index_t permutation_get_block_size() const;
+
 	/** @return The name of the class */
 	const char* get_name() const override;
 
@@ -31,6 +31,7 @@
 #include <shogun/lib/SGMatrix.h>
 #include <shogun/statistical_testing/internals/ComputationManager.h>
 
+#include <exception>
 #include <utility>
 
 using namespace shogun;
@@ -108,16 +109,28 @@ void ComputationManager::compute_task_parallel_jobs()
 	}
 	else
 	{
-		// TODO figure out other ways to deal with the parallelization in presence of
-		// eigen3. presently due to that, using OpenMP here messes things up!
-//#pragma omp parallel for
-		for (size_t j=0; j<job_array.size(); ++j)
+		// every job writes into its own preallocated results, exceptions
+		// must not leave the parallel region and are rethrown after it
+		std::exception_ptr exception;
+#pragma omp parallel for schedule(dynamic, 1)
+		for (int64_t j=0; j<(int64_t)job_array.size(); ++j)
 		{
-			const auto& compute_job=job_array[j];
-			// result_array[j][i] is contiguous, cache miss is minimized
-			for (size_t i=0; i<data_array.size(); ++i)
-				result_array[j][i]=compute_job(data_array[i]);
+			try
+			{
+				const auto& compute_job=job_array[j];
+				// result_array[j][i] is contiguous, cache miss is minimized
+				for (size_t i=0; i<data_array.size(); ++i)
+					result_array[j][i]=compute_job(data_array[i]);
+			}
+			catch (...)
+			{
+#pragma omp critical
+				if (!exception)
+					exception=std::current_exception();
+			}
 		}
+		if (exception)
+			std::rethrow_exception(exception);
 	}
 }
 
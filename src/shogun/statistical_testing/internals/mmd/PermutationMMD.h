@@ -33,11 +33,14 @@
 #define PERMUTATION_MMD_H_
 
 #include <algorithm>
+#include <functional>
 #include <numeric>
+#include <vector>
 #include <shogun/lib/SGVector.h>
 #include <shogun/lib/SGMatrix.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/mathematics/eigen3.h>
 #include <shogun/statistical_testing/internals/mmd/ComputeMMD.h>
 
 namespace shogun
@@ -49,9 +52,26 @@ namespace internal
 namespace mmd
 {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
+/**
+ * Computes MMD estimates under the null hypothesis by permuting the joint
+ * samples. Permutations are processed in blocks of m_block_size: for a block,
+ * the indicator vectors a of the samples that are permuted into the first
+ * set form the columns of a matrix A, and a single blocked pass over the
+ * kernel matrix computes KA, from which the within and cross terms of all the
+ * permutations in the block follow as a'Ka, a'K1 and 1'K1. This replaces
+ * one pass over the kernel matrix per permutation with dense matrix products.
+ *
+ * If m_num_exceedances is positive, p-value computation stops as soon as that
+ * many null samples exceeded the statistic (Besag & Clifford, 1991, Sequential
+ * Monte Carlo p-values, Biometrika), in which case the p-value is estimated
+ * from the permutations done so far. Choosing m_num_exceedances as
+ * ceil(alpha*m_num_null_samples) gives the same test decision at level alpha
+ * as running all permutations.
+ */
 struct PermutationMMD : ComputeMMD
 {
-	PermutationMMD() : m_save_inds(false)
+	PermutationMMD() : m_num_null_samples(0), m_save_inds(false),
+		m_num_exceedances(0), m_block_size(DEFAULT_BLOCK_SIZE)
 	{
 	}
 
@@ -60,29 +80,14 @@ struct PermutationMMD : ComputeMMD
 	{
 		ASSERT(m_n_x>0 && m_n_y>0);
 		ASSERT(m_num_null_samples>0);
-		precompute_permutation_inds(prng);
+		allocate_permutation_inds();
 
-		const index_t size=m_n_x+m_n_y;
 		SGVector<float32_t> null_samples(m_num_null_samples);
-#pragma omp parallel for
-		for (auto n=0; n<m_num_null_samples; ++n)
+		for (index_t begin=0; begin<m_num_null_samples; begin+=m_block_size)
 		{
-			terms_t terms;
-			for (auto j=0; j<size; ++j)
-			{
-				auto inverted_col=m_inverted_permuted_inds(j, n);
-				for (auto i=j; i<size; ++i)
-				{
-					auto inverted_row=m_inverted_permuted_inds(i, n);
-
-					if (inverted_row>=inverted_col)
-						add_term_lower(terms, kernel(i, j), inverted_row, inverted_col);
-					else
-						add_term_lower(terms, kernel(i, j), inverted_col, inverted_row);
-				}
-			}
-			null_samples[n]=compute(terms);
-			SG_DEBUG("null_samples[{}] = {}!", n, null_samples[n]);
+			auto end=std::min(begin+m_block_size, m_num_null_samples);
+			precompute_permutation_inds(begin, end, prng);
+			compute_null_samples(kernel, begin, end, null_samples.vector+begin);
 		}
 		return null_samples;
 	}
@@ -92,45 +97,19 @@ struct PermutationMMD : ComputeMMD
 	{
 		ASSERT(m_n_x>0 && m_n_y>0);
 		ASSERT(m_num_null_samples>0);
-		precompute_permutation_inds(prng);
 
-		const index_t size=m_n_x+m_n_y;
 		SGMatrix<float32_t> null_samples(m_num_null_samples, kernel_mgr.num_kernels());
-		SGVector<float32_t> km(size*(size+1)/2);
+		SGVector<float32_t> km;
+		// all kernels use the same permutations
+		const PRNG initial_prng=prng;
 		for (auto k=0; k<kernel_mgr.num_kernels(); ++k)
 		{
-			auto kernel=kernel_mgr.kernel_at(k);
-			terms_t terms;
-			for (auto i=0; i<size; ++i)
-			{
-				for (auto j=i; j<size; ++j)
-				{
-					auto index=i*size-i*(i+1)/2+j;
-					km[index]=kernel->kernel(i, j);
-				}
-			}
+			precompute_kernel_matrix(kernel_mgr, k, km);
+			auto kernel=packed_kernel(km);
 
-#pragma omp parallel for
-			for (auto n=0; n<m_num_null_samples; ++n)
-			{
-				terms_t null_terms;
-				for (auto i=0; i<size; ++i)
-				{
-					auto inverted_row=m_inverted_permuted_inds(i, n);
-					auto index_base=i*size-i*(i+1)/2;
-					for (auto j=i; j<size; ++j)
-					{
-						auto index=index_base+j;
-						auto inverted_col=m_inverted_permuted_inds(j, n);
-
-						if (inverted_row<=inverted_col)
-							add_term_upper(null_terms, km[index], inverted_row, inverted_col);
-						else
-							add_term_upper(null_terms, km[index], inverted_col, inverted_row);
-					}
-				}
-				null_samples(n, k)=compute(null_terms);
-			}
+			prng=initial_prng;
+			auto result=operator()(kernel, prng);
+			std::copy(result.data(), result.data()+result.size(), null_samples.get_column_vector(k));
 		}
 		return null_samples;
 	}
@@ -139,8 +118,38 @@ struct PermutationMMD : ComputeMMD
 	float64_t p_value(const Kernel& kernel, PRNG& prng)
 	{
 		auto statistic=ComputeMMD::operator()(kernel);
-		auto null_samples=operator()(kernel, prng);
-		return compute_p_value(null_samples, statistic);
+		return p_value(kernel, statistic, prng);
+	}
+
+	/**
+	 * Computes the fraction of null samples that exceed the statistic,
+	 * stopping early as soon as m_num_exceedances of them did, if set.
+	 */
+	template <class Kernel, class PRNG>
+	float64_t p_value(const Kernel& kernel, float32_t statistic, PRNG& prng)
+	{
+		ASSERT(m_n_x>0 && m_n_y>0);
+		ASSERT(m_num_null_samples>0);
+		allocate_permutation_inds();
+
+		SGVector<float32_t> null_samples(m_block_size);
+		index_t exceedances=0;
+		for (index_t begin=0; begin<m_num_null_samples; begin+=m_block_size)
+		{
+			auto end=std::min(begin+m_block_size, m_num_null_samples);
+			precompute_permutation_inds(begin, end, prng);
+			compute_null_samples(kernel, begin, end, null_samples.vector);
+
+			exceedances+=std::count_if(null_samples.data(), null_samples.data()+end-begin,
+				[statistic](float32_t null_sample) { return null_sample>statistic; });
+			if (m_num_exceedances>0 && exceedances>=m_num_exceedances)
+			{
+				SG_DEBUG("Stopping after {} of {} permutations, {} exceedances!",
+					end, m_num_null_samples, exceedances);
+				return float64_t(exceedances)/end;
+			}
+		}
+		return float64_t(exceedances)/m_num_null_samples;
 	}
 
 	template <class PRNG>
@@ -148,63 +157,105 @@ struct PermutationMMD : ComputeMMD
 	{
 		ASSERT(m_n_x>0 && m_n_y>0);
 		ASSERT(m_num_null_samples>0);
-		precompute_permutation_inds(prng);
 
-		const index_t size=m_n_x+m_n_y;
-		SGVector<float32_t> null_samples(m_num_null_samples);
 		SGVector<float64_t> result(kernel_mgr.num_kernels());
-
-		SGVector<float32_t> km(size*(size+1)/2);
+		SGVector<float32_t> km;
+		const PRNG initial_prng=prng;
 		for (auto k=0; k<kernel_mgr.num_kernels(); ++k)
 		{
-			auto kernel=kernel_mgr.kernel_at(k);
-			terms_t terms;
-			for (auto i=0; i<size; ++i)
+			precompute_kernel_matrix(kernel_mgr, k, km);
+			auto kernel=packed_kernel(km);
+
+			float32_t statistic=ComputeMMD::operator()(kernel);
+			SG_DEBUG("Kernel({}): statistic={}", k, statistic);
+
+			prng=initial_prng;
+			result[k]=p_value(kernel, statistic, prng);
+			SG_DEBUG("Kernel({}): p_value={}", k, result[k]);
+		}
+
+		return result;
+	}
+
+	/**
+	 * Computes the null samples of the permutations [begin, end), whose
+	 * inverted indices are stored in the first end-begin columns of
+	 * m_inverted_permuted_inds.
+	 */
+	template <class Kernel>
+	void compute_null_samples(const Kernel& kernel, index_t begin, index_t end, float32_t* null_samples) const
+	{
+		const index_t size=m_n_x+m_n_y;
+		const index_t num_permutations=end-begin;
+
+		// permutation indicators of the first set, plus a column of ones
+		// that yields the row sums of the kernel matrix
+		Eigen::MatrixXd A(size, num_permutations+1);
+		for (index_t n=0; n<num_permutations; ++n)
+		{
+			for (index_t i=0; i<size; ++i)
+				A(i, n)=m_inverted_permuted_inds(i, n)<m_n_x ? 1.0 : 0.0;
+		}
+		A.col(num_permutations).setOnes();
+
+		Eigen::MatrixXd KA(size, num_permutations+1);
+		Eigen::VectorXd diag(size);
+		const index_t num_panels=(size+PANEL_SIZE-1)/PANEL_SIZE;
+#pragma omp parallel for schedule(dynamic)
+		for (index_t p=0; p<num_panels; ++p)
+		{
+			const index_t start=p*PANEL_SIZE;
+			const index_t cols=std::min(PANEL_SIZE, size-start);
+
+			// kernel matrix is symmetric, so columns are read instead of rows
+			Eigen::MatrixXd panel(size, cols);
+			for (index_t c=0; c<cols; ++c)
 			{
-				for (auto j=i; j<size; ++j)
-				{
-					auto index=i*size-i*(i+1)/2+j;
-					km[index]=kernel->kernel(i, j);
-					add_term_upper(terms, km[index], i, j);
-				}
+				for (index_t j=0; j<size; ++j)
+					panel(j, c)=kernel(j, start+c);
+				diag[start+c]=panel(start+c, c);
 			}
-			float32_t statistic=compute(terms);
-			SG_DEBUG("Kernel({}): statistic={}", k, statistic);
+			KA.middleRows(start, cols).noalias()=panel.transpose()*A;
+		}
+
+		const auto& row_sums=KA.col(num_permutations);
+		const float64_t total=row_sums.sum();
+		const float64_t diag_total=diag.sum();
 
 #pragma omp parallel for
-			for (auto n=0; n<m_num_null_samples; ++n)
+		for (index_t n=0; n<num_permutations; ++n)
+		{
+			const auto& a=A.col(n);
+			const float64_t within_x=a.dot(KA.col(n));
+			const float64_t x_to_all=a.dot(row_sums);
+			const float64_t diag_x=a.dot(diag);
+
+			terms_t terms;
+			terms.diag[0]=diag_x;
+			terms.diag[1]=diag_total-diag_x;
+			// terms hold the sums over the upper triangle, see add_term_upper
+			terms.term[0]=(within_x-terms.diag[0])/2+terms.diag[0];
+			terms.term[1]=(total-2*x_to_all+within_x-terms.diag[1])/2+terms.diag[1];
+			terms.term[2]=x_to_all-within_x;
+
+			if (m_stype==ST_UNBIASED_INCOMPLETE)
 			{
-				terms_t null_terms;
-				for (auto i=0; i<size; ++i)
-				{
-					auto inverted_row=m_inverted_permuted_inds(i, n);
-					auto index_base=i*size-i*(i+1)/2;
-					for (auto j=i; j<size; ++j)
-					{
-						auto index=index_base+j;
-						auto inverted_col=m_inverted_permuted_inds(j, n);
-
-						if (inverted_row<=inverted_col)
-							add_term_upper(null_terms, km[index], inverted_row, inverted_col);
-						else
-							add_term_upper(null_terms, km[index], inverted_col, inverted_row);
-					}
-				}
-				null_samples[n]=compute(null_terms);
+				std::vector<index_t> permuted_inds(size);
+				for (index_t i=0; i<size; ++i)
+					permuted_inds[m_inverted_permuted_inds(i, n)]=i;
+				for (index_t i=0; i<m_n_x; ++i)
+					terms.diag[2]+=kernel(permuted_inds[i], permuted_inds[i+m_n_x]);
 			}
-			result[k]=compute_p_value(null_samples, statistic);
-			SG_DEBUG("Kernel({}): p_value={}", k, result[k]);
-		}
 
-		return result;
+			null_samples[n]=compute(terms);
+			SG_DEBUG("null_samples[{}] = {}!", begin+n, null_samples[n]);
+		}
 	}
 
 	template <class PRNG>
-	inline void precompute_permutation_inds(PRNG& prng)
+	inline void precompute_permutation_inds(index_t begin, index_t end, PRNG& prng)
 	{
-		ASSERT(m_num_null_samples>0);
-		allocate_permutation_inds();
-		for (auto n=0; n<m_num_null_samples; ++n)
+		for (auto n=begin; n<end; ++n)
 		{
 			std::iota(m_permuted_inds.data(), m_permuted_inds.data()+m_permuted_inds.size(), 0);
 			random::shuffle(m_permuted_inds, prng);
@@ -214,10 +265,39 @@ struct PermutationMMD : ComputeMMD
 				std::copy(m_permuted_inds.data(), m_permuted_inds.data()+m_permuted_inds.size(), &m_all_inds.matrix[offset]);
 			}
 			for (index_t i=0; i<m_permuted_inds.size(); ++i)
-				m_inverted_permuted_inds(m_permuted_inds[i], n)=i;
+				m_inverted_permuted_inds(m_permuted_inds[i], n-begin)=i;
 		}
 	}
 
+	/** computes the upper triangle of the k-th kernel matrix, packed row-wise */
+	inline void precompute_kernel_matrix(const KernelManager& kernel_mgr, index_t k, SGVector<float32_t>& km) const
+	{
+		const index_t size=m_n_x+m_n_y;
+		if (km.size()!=size*(size+1)/2)
+			km=SGVector<float32_t>(size*(size+1)/2);
+
+		auto kernel=kernel_mgr.kernel_at(k);
+#pragma omp parallel for schedule(dynamic)
+		for (auto i=0; i<size; ++i)
+		{
+			auto index_base=i*size-i*(i+1)/2;
+			for (auto j=i; j<size; ++j)
+				km[index_base+j]=kernel->kernel(i, j);
+		}
+	}
+
+	/** @return accessor of a packed kernel matrix, see precompute_kernel_matrix */
+	inline std::function<float32_t(index_t, index_t)> packed_kernel(const SGVector<float32_t>& km) const
+	{
+		const index_t size=m_n_x+m_n_y;
+		return [km, size](index_t i, index_t j)
+		{
+			if (i>j)
+				std::swap(i, j);
+			return km[i*size-i*(i+1)/2+j];
+		};
+	}
+
 	inline float64_t compute_p_value(SGVector<float32_t>& null_samples, float32_t statistic) const
 	{
 		std::sort(null_samples.data(), null_samples.data()+null_samples.size());
@@ -227,12 +307,13 @@ struct PermutationMMD : ComputeMMD
 
 	inline void allocate_permutation_inds()
 	{
+		ASSERT(m_block_size>0);
 		const index_t size=m_n_x+m_n_y;
 		if (m_permuted_inds.size()!=size)
 			m_permuted_inds=SGVector<index_t>(size);
 
-		if (m_inverted_permuted_inds.num_cols!=m_num_null_samples || m_inverted_permuted_inds.num_rows!=size)
-			m_inverted_permuted_inds=SGMatrix<index_t>(size, m_num_null_samples);
+		if (m_inverted_permuted_inds.num_cols!=m_block_size || m_inverted_permuted_inds.num_rows!=size)
+			m_inverted_permuted_inds=SGMatrix<index_t>(size, m_block_size);
 
 		if (m_save_inds && (m_all_inds.num_cols!=m_num_null_samples || m_all_inds.num_rows!=size))
 			m_all_inds=SGMatrix<index_t>(size, m_num_null_samples);
@@ -240,9 +321,14 @@ struct PermutationMMD : ComputeMMD
 
 	index_t m_num_null_samples;
 	bool m_save_inds;
+	index_t m_num_exceedances;
+	index_t m_block_size;
 	SGVector<index_t> m_permuted_inds;
 	SGMatrix<index_t> m_inverted_permuted_inds;
 	SGMatrix<index_t> m_all_inds;
+
+	static constexpr index_t DEFAULT_BLOCK_SIZE=64;
+	static constexpr index_t PANEL_SIZE=64;
 };
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 }
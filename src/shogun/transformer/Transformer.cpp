@@ -1,3 +1,4 @@
+#include <shogun/features/streaming/StreamingFeatures.h>
 #include <shogun/lib/exception/NotFittedException.h>
 #include <shogun/transformer/Transformer.h>
 
@@ -16,4 +17,32 @@ namespace shogun
 		require<NotFittedException>(
 		    m_fitted, "Transformer has not been fitted.");
 	}
+
+	void Transformer::fit_streaming(
+	    std::shared_ptr<StreamingFeatures> features, index_t batch_size)
+	{
+		require(features, "No features provided");
+		require(
+		    batch_size > 0, "Batch size ({}) must be positive", batch_size);
+		require(
+		    !train_require_labels(),
+		    "{} needs labels, which are not streamed in batches. Call "
+		    "partial_fit() with features and labels instead.",
+		    get_name());
+
+		reset_partial_fit();
+		int64_t num_vectors = 0;
+		features->start_parser();
+		while (true)
+		{
+			auto batch = features->get_streamed_features(batch_size);
+			if (batch->get_num_vectors() == 0)
+				break;
+			partial_fit(batch);
+			num_vectors += batch->get_num_vectors();
+		}
+		features->end_parser();
+
+		require(num_vectors > 0, "No vectors could be read from the stream");
+	}
 }
@@ -17,6 +17,7 @@ namespace shogun
 {
 
 	class Features;
+	class StreamingFeatures;
 
 	/** @brief class Transformer defines a transformer interface
 	 *
@@ -71,6 +72,39 @@ namespace shogun
 			not_implemented(SOURCE_LOCATION);;
 		}
 
+		/** Update transformer with a further batch of training features, so
+		 * that it can be fitted to data which does not fit into memory. The
+		 * transformer is fitted to all batches seen since the last call of
+		 * fit() or fit_streaming(), which both discard earlier batches.
+		 *
+		 * @param features batch of training features
+		 */
+		virtual void partial_fit(std::shared_ptr<Features> features)
+		{
+			not_implemented(SOURCE_LOCATION);
+		}
+
+		/** Update transformer with a further batch of training features and
+		 * labels, see partial_fit(std::shared_ptr<Features>).
+		 *
+		 * @param features batch of training features
+		 * @param labels training labels of the batch
+		 */
+		virtual void partial_fit(
+		    std::shared_ptr<Features> features, std::shared_ptr<Labels> labels)
+		{
+			not_implemented(SOURCE_LOCATION);
+		}
+
+		/** Fit transformer to a stream in a single pass, by calling
+		 * partial_fit() on consecutive batches read from it.
+		 *
+		 * @param features streaming features to read from
+		 * @param batch_size number of vectors per batch
+		 */
+		void fit_streaming(
+		    std::shared_ptr<StreamingFeatures> features, index_t batch_size);
+
 		/** Apply transformation to features. If transformation is performed in
 		 *  place, underlying data of input features will be reused if possible.
 		 *	@param features features to transform
@@ -107,6 +141,11 @@ namespace shogun
 		 */
 		void assert_fitted() const;
 
+		/** Discards the batches seen by partial_fit() so far */
+		virtual void reset_partial_fit()
+		{
+		}
+
 		std::atomic<bool> m_fitted{false};
 	};
 }
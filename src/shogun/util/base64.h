@@ -0,0 +1,114 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+#ifndef __UTIL_BASE64_H__
+#define __UTIL_BASE64_H__
+
+#include <shogun/lib/common.h>
+
+#include <string>
+
+namespace shogun
+{
+	namespace utils
+	{
+		/** Encodes bytes as base64 (RFC 4648) with padding
+		 *
+		 * @param data bytes to encode
+		 * @param size number of bytes
+		 * @return encoded text
+		 */
+		inline std::string base64_encode(const void* data, size_t size)
+		{
+			static const char* const alphabet =
+			    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+			const auto* bytes = static_cast<const uint8_t*>(data);
+			std::string result;
+			result.reserve((size + 2) / 3 * 4);
+			size_t i = 0;
+			for (; i + 2 < size; i += 3)
+			{
+				uint32_t n = (bytes[i] << 16) | (bytes[i + 1] << 8) | bytes[i + 2];
+				result.push_back(alphabet[(n >> 18) & 63]);
+				result.push_back(alphabet[(n >> 12) & 63]);
+				result.push_back(alphabet[(n >> 6) & 63]);
+				result.push_back(alphabet[n & 63]);
+			}
+			if (i < size)
+			{
+				uint32_t n = bytes[i] << 16;
+				if (i + 1 < size)
+					n |= bytes[i + 1] << 8;
+				result.push_back(alphabet[(n >> 18) & 63]);
+				result.push_back(alphabet[(n >> 12) & 63]);
+				result.push_back(i + 1 < size ? alphabet[(n >> 6) & 63] : '=');
+				result.push_back('=');
+			}
+			return result;
+		}
+
+		/** Number of bytes encoded by padded base64 text
+		 *
+		 * @param text encoded text
+		 * @param size length of the text
+		 * @return number of bytes
+		 */
+		inline size_t base64_decoded_size(const char* text, size_t size)
+		{
+			if (size < 4)
+				return 0;
+			return size / 4 * 3 - (text[size - 1] == '=') - (text[size - 2] == '=');
+		}
+
+		/** Decodes padded base64 text
+		 *
+		 * @param text text to decode
+		 * @param size length of the text
+		 * @param data decoded bytes, must hold base64_decoded_size bytes
+		 * @return number of decoded bytes or -1 if the text is not valid
+		 * base64
+		 */
+		inline int64_t base64_decode(const char* text, size_t size, void* data)
+		{
+			auto value = [](char c) -> int32_t {
+				if (c >= 'A' && c <= 'Z')
+					return c - 'A';
+				if (c >= 'a' && c <= 'z')
+					return c - 'a' + 26;
+				if (c >= '0' && c <= '9')
+					return c - '0' + 52;
+				if (c == '+')
+					return 62;
+				if (c == '/')
+					return 63;
+				return -1;
+			};
+			if (size % 4 != 0)
+				return -1;
+
+			auto* bytes = static_cast<uint8_t*>(data);
+			int64_t length = 0;
+			for (size_t i = 0; i < size; i += 4)
+			{
+				const bool last = i + 4 == size;
+				const int32_t padding = last ? (text[i + 3] == '=') + (text[i + 2] == '=') : 0;
+				uint32_t n = 0;
+				for (int32_t j = 0; j < 4 - padding; ++j)
+				{
+					int32_t v = value(text[i + j]);
+					if (v < 0)
+						return -1;
+					n |= v << (18 - 6 * j);
+				}
+				bytes[length++] = (n >> 16) & 255;
+				if (padding < 2)
+					bytes[length++] = (n >> 8) & 255;
+				if (padding < 1)
+					bytes[length++] = n & 255;
+			}
+			return length;
+		}
+	} // namespace utils
+} // namespace shogun
+
+#endif
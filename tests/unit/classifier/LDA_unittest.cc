@@ -194,6 +194,29 @@ TEST(LDA, DISABLED_CheckProjection_SVD)
 	EXPECT_NEAR(+7.96084156, projection_SVD[9], epsilon);
 }
 
+TEST(LDA, classic_regularized)
+{
+	SGVector<float64_t> lab;
+	SGMatrix<float64_t> feat;
+	generate_test_data<float64_t>(lab, feat);
+
+	auto features = std::make_shared<DenseFeatures<float64_t>>(feat);
+	std::shared_ptr<Labels> labels = std::make_shared<BinaryLabels>(lab);
+
+	auto lda = std::make_shared<LDA>(0.1, FLD_LDA);
+	lda->put("labels", labels);
+	lda->train(features);
+
+	// the within class covariance Sw is summed over all classes and then
+	// regularized once to (1 - gamma) * Sw + gamma * trace(Sw) / d * I
+	auto w = lda->get<SGVector<float64_t>>("w");
+	float64_t epsilon = 1e-9;
+	EXPECT_NEAR(0.24955067430430973, w[0], epsilon);
+	EXPECT_NEAR(2.4676579153456174, w[1], epsilon);
+	EXPECT_NEAR(0.45868058290856119, w[2], epsilon);
+	EXPECT_NEAR(-1.6363504633379505, lda->get<float64_t>("bias"), epsilon);
+}
+
 // label type exception test
 TEST(LDA, num_classes_in_labels_exception)
 {
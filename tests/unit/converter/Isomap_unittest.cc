@@ -147,6 +147,78 @@ TEST(DISABLED_IsomapTest,neighbors_preserving)
 
 
 
+}
+
+TEST(IsomapTest,nndescent_approximates_exact)
+{
+	const index_t n_samples = 100;
+	const index_t n_dimensions = 3;
+	const index_t n_target_dimensions = 2;
+	const index_t n_neighbors = 10;
+
+	SGMatrix<float64_t> matrix(n_dimensions, n_samples);
+	std::mt19937_64 prng(100);
+	fill_matrix_with_test_data(matrix, prng);
+	auto features = std::make_shared<DenseFeatures<float64_t>>(matrix);
+
+	auto isomap = std::make_shared<Isomap>();
+	isomap->set_k(n_neighbors);
+	isomap->set_target_dim(n_target_dimensions);
+	auto exact = isomap->transform(features)->as<DenseFeatures<float64_t>>();
+
+	isomap->set_neighbors_method(NEIGHBORS_NN_DESCENT);
+	EXPECT_EQ(NEIGHBORS_NN_DESCENT, isomap->get_neighbors_method());
+	auto approximate = isomap->transform(features)->as<DenseFeatures<float64_t>>();
+	EXPECT_EQ(n_target_dimensions, approximate->get_dim_feature_space());
+	EXPECT_EQ(n_samples, approximate->get_num_vectors());
+
+	/* the search is randomized and its updates depend on the thread
+	 * schedule, so only require the embedding to be close to the exact one */
+	auto exact_distances = std::make_shared<EuclideanDistance>(exact, exact)->get_distance_matrix();
+	auto approximate_distances =
+		std::make_shared<EuclideanDistance>(approximate, approximate)->get_distance_matrix();
+	float64_t error = 0, total = 0;
+	for (index_t i=0; i<n_samples*n_samples; i++)
+	{
+		error += std::abs(exact_distances[i] - approximate_distances[i]);
+		total += exact_distances[i];
+	}
+	EXPECT_LT(error / total, 0.05);
+}
+
+TEST(IsomapTest,landmark_approximates_exact)
+{
+	const index_t n_samples = 100;
+	const index_t n_dimensions = 3;
+	const index_t n_target_dimensions = 2;
+	const index_t n_neighbors = 10;
+
+	SGMatrix<float64_t> matrix(n_dimensions, n_samples);
+	std::mt19937_64 prng(100);
+	fill_matrix_with_test_data(matrix, prng);
+	auto features = std::make_shared<DenseFeatures<float64_t>>(matrix);
+
+	auto isomap = std::make_shared<Isomap>();
+	isomap->set_k(n_neighbors);
+	isomap->set_target_dim(n_target_dimensions);
+	auto exact = isomap->transform(features)->as<DenseFeatures<float64_t>>();
+
+	isomap->set_landmark(true);
+	isomap->set_landmark_number(20);
+	auto landmark = isomap->transform(features)->as<DenseFeatures<float64_t>>();
+	EXPECT_EQ(n_target_dimensions, landmark->get_dim_feature_space());
+	EXPECT_EQ(n_samples, landmark->get_num_vectors());
+
+	auto exact_distances = std::make_shared<EuclideanDistance>(exact, exact)->get_distance_matrix();
+	auto landmark_distances =
+		std::make_shared<EuclideanDistance>(landmark, landmark)->get_distance_matrix();
+	float64_t error = 0, total = 0;
+	for (index_t i=0; i<n_samples*n_samples; i++)
+	{
+		error += std::abs(exact_distances[i] - landmark_distances[i]);
+		total += exact_distances[i];
+	}
+	EXPECT_LT(error / total, 0.01);
 }
 
 std::set<index_t> get_neighbors_indices(const std::shared_ptr<Distance>& distance_object, index_t feature_vector_index, index_t n_neighbors)
@@ -40,5 +40,62 @@ TEST(TDistributedStochasticNeighborEmbeddingTest,basic)
 	EXPECT_EQ(n_target_dimensions,low_dimensional_features->get_dim_feature_space());
 	EXPECT_EQ(high_dimensional_features->get_num_vectors(),low_dimensional_features->get_num_vectors());
 }
+
+TEST(TDistributedStochasticNeighborEmbeddingTest, interpolation)
+{
+	std::mt19937_64 prng(24);
+
+	const index_t n_samples = 60;
+	const index_t n_dimensions = 3;
+	const index_t n_target_dimensions = 2;
+	auto high_dimensional_features =
+		std::make_shared<DenseFeatures<float64_t>>(DataGenerator::generate_gaussians(n_samples / 2, 2, n_dimensions, prng));
+
+	auto embedder =
+		std::make_shared<TDistributedStochasticNeighborEmbedding>();
+	embedder->set_target_dim(n_target_dimensions);
+	embedder->set_perplexity(10.0);
+	embedder->set_interpolation(true);
+	EXPECT_TRUE(embedder->get_interpolation());
+
+	auto low_dimensional_features =
+	    embedder->transform(high_dimensional_features)
+	        ->as<DenseFeatures<float64_t>>();
+
+	EXPECT_EQ(n_target_dimensions,low_dimensional_features->get_dim_feature_space());
+	EXPECT_EQ(n_samples,low_dimensional_features->get_num_vectors());
+
+	/* the two gaussians stay apart */
+	auto embedding = low_dimensional_features->get_feature_matrix();
+	float64_t within = 0, between = 0;
+	for (index_t i = 0; i < n_samples; i++)
+	{
+		for (index_t j = 0; j < n_samples; j++)
+		{
+			float64_t dist = 0;
+			for (index_t d = 0; d < n_target_dimensions; d++)
+				dist += std::pow(embedding(d, i) - embedding(d, j), 2);
+			if ((i < n_samples / 2) == (j < n_samples / 2))
+				within += std::sqrt(dist);
+			else
+				between += std::sqrt(dist);
+		}
+	}
+	EXPECT_LT(within, between);
+}
+
+TEST(TDistributedStochasticNeighborEmbeddingTest, barnes_hut_requires_two_dimensions)
+{
+	std::mt19937_64 prng(24);
+
+	auto high_dimensional_features =
+		std::make_shared<DenseFeatures<float64_t>>(DataGenerator::generate_gaussians(15, 1, 3, prng));
+
+	auto embedder =
+		std::make_shared<TDistributedStochasticNeighborEmbedding>();
+	embedder->set_target_dim(3);
+	embedder->set_perplexity(3.0);
+	EXPECT_THROW(embedder->transform(high_dimensional_features), std::exception);
+}
 #endif // HAVE_LAPACK
 
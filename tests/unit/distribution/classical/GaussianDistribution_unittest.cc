@@ -31,6 +31,7 @@
  */
 #include <gtest/gtest.h>
 
+#include <shogun/base/ShogunEnv.h>
 #include <shogun/distributions/classical/GaussianDistribution.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/eigen3.h>
@@ -179,6 +180,30 @@ TEST(GaussianDistribution,sample_2d)
 
 }
 
+TEST(GaussianDistribution,sample_independent_of_threads)
+{
+	SGVector<float64_t> mean(2);
+	SGMatrix<float64_t> cov(2,2);
+	mean.zero();
+	cov(0,0)=2.4;
+	cov(0,1)=1.3;
+	cov(1,0)=1.3;
+	cov(1,1)=2.4;
+
+	auto num_threads=env()->get_num_threads();
+	SGMatrix<float64_t> samples[2];
+	for (auto i : {0, 1})
+	{
+		env()->set_num_threads(i ? 4 : 1);
+		auto gauss=std::make_shared<GaussianDistribution>(mean,cov);
+		gauss->put(random::kSeed, 5);
+		samples[i]=gauss->sample(10000);
+	}
+	env()->set_num_threads(num_threads);
+
+	EXPECT_TRUE(samples[0].equals(samples[1]));
+}
+
 TEST(GaussianDistribution,univariate_log_pdf)
 {
 	float64_t mu, sigma2, sample;
@@ -192,3 +192,38 @@ TYPED_TEST(CrossValidationTests, single_multi_same_result)
 
 	EXPECT_NEAR(single, multi, 1e-7);
 }
+
+TEST(CrossValidation, precomputed_kernel)
+{
+	std::mt19937_64 prng(23);
+	NormalDistribution<float64_t> randn;
+
+	SGMatrix<float64_t> X(2, 60);
+	SGVector<float64_t> y(60);
+	for (auto i : range(60))
+	{
+		y[i] = i % 2 ? 1 : -1;
+		X(0, i) = randn(prng) + y[i];
+		X(1, i) = randn(prng);
+	}
+	auto features = std::make_shared<DenseFeatures<float64_t>>(X);
+	auto labels = std::make_shared<BinaryLabels>(y);
+
+	float64_t means[2];
+	for (auto precompute : {false, true})
+	{
+		auto svm = std::make_shared<LibSVM>();
+		svm->set_kernel(std::make_shared<GaussianKernel>(2.0));
+		auto cv = std::make_shared<CrossValidation>(
+		    svm, features, labels,
+		    std::make_shared<CrossValidationSplitting>(labels, 5),
+		    std::make_shared<AccuracyMeasure>());
+		cv->set_num_runs(3);
+		cv->set_precompute_kernel(precompute);
+		cv->put("seed", 1);
+		means[precompute] = cv->evaluate()->get<float64_t>("mean");
+	}
+
+	// the shared kernel matrix is single precision
+	EXPECT_NEAR(means[0], means[1], 0.02);
+}
@@ -0,0 +1,172 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+#include <shogun/classifier/Perceptron.h>
+#include <shogun/classifier/svm/LibLinear.h>
+#include <shogun/classifier/svm/LibSVM.h>
+#include <shogun/evaluation/ContingencyTableEvaluation.h>
+#include <shogun/evaluation/CrossValidationSplitting.h>
+#include <shogun/evaluation/HyperParameterSearch.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/labels/BinaryLabels.h>
+#include <shogun/mathematics/NormalDistribution.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace shogun;
+
+class HyperParameterSearchTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		std::mt19937_64 prng(17);
+		NormalDistribution<float64_t> normal;
+
+		// two overlapping gaussian blobs
+		SGMatrix<float64_t> data(num_features, num_vectors);
+		SGVector<float64_t> lab(num_vectors);
+		for (index_t i = 0; i < num_vectors; ++i)
+		{
+			lab[i] = i % 2 ? 1 : -1;
+			for (index_t j = 0; j < num_features; ++j)
+				data(j, i) = normal(prng) + lab[i];
+		}
+		features = std::make_shared<DenseFeatures<float64_t>>(data);
+		labels = std::make_shared<BinaryLabels>(lab);
+		splitting = std::make_shared<CrossValidationSplitting>(labels, 4);
+		splitting->put(random::kSeed, 3);
+	}
+
+	const index_t num_features = 2;
+	const index_t num_vectors = 80;
+	std::shared_ptr<DenseFeatures<float64_t>> features;
+	std::shared_ptr<BinaryLabels> labels;
+	std::shared_ptr<CrossValidationSplitting> splitting;
+};
+
+TEST_F(HyperParameterSearchTest, grid_precomputed_kernel)
+{
+	SGVector<float64_t> C({0.1, 1.0, 10.0});
+	SGVector<float64_t> width({0.5, 2.0});
+
+	std::shared_ptr<HyperParameterSearchResult> results[2];
+	for (auto precompute : {false, true})
+	{
+		auto svm = std::make_shared<LibSVM>();
+		svm->set_kernel(std::make_shared<GaussianKernel>(1.0));
+
+		auto search = std::make_shared<HyperParameterSearch>(
+		    svm, features, labels, make_clone(splitting),
+		    std::make_shared<AccuracyMeasure>());
+		search->add_parameter("C1", C);
+		search->add_parameter("C2", C);
+		search->add_parameter("kernel::width", width);
+		search->put(HyperParameterSearch::kPrecomputeKernel, precompute);
+
+		results[precompute] =
+		    search->evaluate()->as<HyperParameterSearchResult>();
+	}
+
+	for (const auto& result : results)
+	{
+		auto candidates = result->get_candidates();
+		ASSERT_EQ(3, candidates.num_rows);
+		ASSERT_EQ(C.vlen * C.vlen * width.vlen, candidates.num_cols);
+
+		auto scores = result->get_scores();
+		EXPECT_EQ(
+		    *std::max_element(scores.begin(), scores.end()),
+		    result->get_best_score());
+		EXPECT_GT(result->get_best_score(), 0.7);
+
+		auto best = result->get_best_machine();
+		ASSERT_NE(nullptr, best);
+		EXPECT_EQ(result->get_best_parameters()[0], best->get<float64_t>("C1"));
+		EXPECT_EQ(
+		    result->get_best_parameters()[2],
+		    best->get<Kernel>("kernel")->get<float64_t>("width"));
+	}
+
+	// shared kernel matrices are single precision
+	auto scores = results[0]->get_scores();
+	auto shared_scores = results[1]->get_scores();
+	for (index_t i = 0; i < scores.vlen; ++i)
+		EXPECT_NEAR(scores[i], shared_scores[i], 0.05);
+}
+
+TEST_F(HyperParameterSearchTest, random_successive_halving)
+{
+	auto perceptron = std::make_shared<Perceptron>();
+	perceptron->put("max_iterations", 9);
+
+	auto search = std::make_shared<HyperParameterSearch>(
+	    perceptron, features, labels, splitting,
+	    std::make_shared<AccuracyMeasure>());
+	search->add_parameter_range("learn_rate", 1e-3, 1.0, true);
+	search->put(HyperParameterSearch::kStrategy, HPS_RANDOM);
+	search->put(HyperParameterSearch::kNumCandidates, 9);
+	search->put(HyperParameterSearch::kSuccessiveHalving, true);
+	search->put(HyperParameterSearch::kMinIterations, 1);
+	search->put(HyperParameterSearch::kReductionFactor, 3);
+	search->put(random::kSeed, 7);
+
+	auto result = search->evaluate()->as<HyperParameterSearchResult>();
+
+	auto candidates = result->get_candidates();
+	ASSERT_EQ(9, candidates.num_cols);
+	for (auto rate : candidates)
+	{
+		EXPECT_GE(rate, 1e-3);
+		EXPECT_LE(rate, 1.0);
+	}
+
+	// 9 candidates with 1 iteration, 3 with 3 and 1 with 9
+	auto budgets = result->get_budgets();
+	EXPECT_EQ(6, std::count(budgets.begin(), budgets.end(), 1));
+	EXPECT_EQ(2, std::count(budgets.begin(), budgets.end(), 3));
+	EXPECT_EQ(1, std::count(budgets.begin(), budgets.end(), 9));
+	EXPECT_EQ(9, budgets[result->get_best_index()]);
+
+	EXPECT_EQ(
+	    9, result->get_best_machine()->get<int32_t>("max_iterations"));
+}
+
+TEST_F(HyperParameterSearchTest, option_parameter)
+{
+	SGVector<float64_t> solvers({L2R_L2LOSS_SVC_DUAL, L2R_L1LOSS_SVC_DUAL});
+	auto search = std::make_shared<HyperParameterSearch>(
+	    std::make_shared<LibLinear>(), features, labels, splitting,
+	    std::make_shared<AccuracyMeasure>());
+	search->add_parameter("liblinear_solver_type", solvers);
+	auto result = search->evaluate()->as<HyperParameterSearchResult>();
+
+	auto best = result->get_best_machine()->get<machine_int_t>(
+	    "liblinear_solver_type");
+	EXPECT_EQ(result->get_best_parameters()[0], best);
+
+	search = std::make_shared<HyperParameterSearch>(
+	    std::make_shared<LibLinear>(), features, labels, splitting,
+	    std::make_shared<AccuracyMeasure>());
+	search->add_parameter("liblinear_solver_type", SGVector<float64_t>({-1}));
+	EXPECT_THROW(search->evaluate(), ShogunException);
+}
+
+TEST_F(HyperParameterSearchTest, unknown_parameter)
+{
+	auto search = std::make_shared<HyperParameterSearch>(
+	    std::make_shared<Perceptron>(), features, labels, splitting,
+	    std::make_shared<AccuracyMeasure>());
+	search->add_parameter("kernel::width", SGVector<float64_t>({1.0}));
+	EXPECT_THROW(search->evaluate(), ShogunException);
+
+	search = std::make_shared<HyperParameterSearch>(
+	    std::make_shared<Perceptron>(), features, labels, splitting,
+	    std::make_shared<AccuracyMeasure>());
+	search->add_parameter_range("learn_rate", 0.1, 1.0);
+	EXPECT_THROW(search->evaluate(), ShogunException);
+}
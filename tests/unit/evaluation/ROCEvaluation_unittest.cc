@@ -4,10 +4,18 @@
  * Authors: Thoralf Klein, Heiko Strathmann, Viktor Gal
  */
 
+#include <shogun/base/ShogunEnv.h>
 #include <shogun/labels/BinaryLabels.h>
+#include <shogun/evaluation/PRCEvaluation.h>
 #include <shogun/evaluation/ROCEvaluation.h>
+#include <shogun/evaluation/StreamingAUCEvaluation.h>
+#include <shogun/lib/View.h>
+#include <shogun/mathematics/NormalDistribution.h>
 #include <gtest/gtest.h>
 
+#include <limits>
+#include <random>
+
 using namespace shogun;
 
 TEST(ROCEvaluation,one)
@@ -29,3 +37,99 @@ TEST(ROCEvaluation,one)
 	
 	
 }
+
+static void generate_scores(
+    index_t num_labels, std::shared_ptr<BinaryLabels>& predicted,
+    std::shared_ptr<BinaryLabels>& ground_truth)
+{
+	std::mt19937_64 prng(31);
+	NormalDistribution<float64_t> normal;
+
+	SGVector<float64_t> truth(num_labels);
+	SGVector<float64_t> outputs(num_labels);
+	for (index_t i = 0; i < num_labels; i++)
+	{
+		truth[i] = i % 3 == 0 ? 1 : -1;
+		// rounding creates ties
+		outputs[i] = std::round((normal(prng) + 0.5 * truth[i]) * 100) / 100;
+	}
+	ground_truth = std::make_shared<BinaryLabels>(truth);
+	predicted = std::make_shared<BinaryLabels>(outputs);
+}
+
+TEST(ROCEvaluation, parallel_sort)
+{
+	std::shared_ptr<BinaryLabels> predicted, ground_truth;
+	generate_scores(300000, predicted, ground_truth);
+
+	auto num_threads = env()->get_num_threads();
+	env()->set_num_threads(1);
+	auto roc = std::make_shared<ROCEvaluation>();
+	auto prc = std::make_shared<PRCEvaluation>();
+	auto auc = roc->evaluate(predicted, ground_truth);
+	auto auprc = prc->evaluate(predicted, ground_truth);
+	auto graph = roc->get_ROC();
+
+	env()->set_num_threads(4);
+	auto parallel_roc = std::make_shared<ROCEvaluation>();
+	auto parallel_prc = std::make_shared<PRCEvaluation>();
+	EXPECT_EQ(auc, parallel_roc->evaluate(predicted, ground_truth));
+	EXPECT_EQ(auprc, parallel_prc->evaluate(predicted, ground_truth));
+	EXPECT_TRUE(graph.equals(parallel_roc->get_ROC()));
+	env()->set_num_threads(num_threads);
+
+	auto thresholds = roc->get_thresholds();
+	EXPECT_TRUE(std::is_sorted(
+	    thresholds.begin(), thresholds.end(), std::greater<float64_t>()));
+}
+
+TEST(StreamingAUCEvaluation, batches_within_bound)
+{
+	std::shared_ptr<BinaryLabels> predicted, ground_truth;
+	generate_scores(5000, predicted, ground_truth);
+
+	auto exact = std::make_shared<ROCEvaluation>()->evaluate(
+	    predicted, ground_truth);
+
+	auto streaming = std::make_shared<StreamingAUCEvaluation>(-4.0, 4.0, 200);
+	auto single = streaming->evaluate(predicted, ground_truth);
+	EXPECT_LE(std::abs(single - exact), streaming->get_error_bound());
+	EXPECT_GT(streaming->get_error_bound(), 0);
+
+	// adding in batches gives the same histograms
+	streaming->reset();
+	for (index_t start = 0; start < 5000; start += 1000)
+	{
+		SGVector<index_t> batch(1000);
+		batch.range_fill(start);
+		streaming->add_batch(
+		    view(predicted, batch), view(ground_truth, batch));
+	}
+	EXPECT_EQ(5000, streaming->get_num_examples());
+	EXPECT_NEAR(single, streaming->get_auROC(), 1E-12);
+
+	// one bin per distinct output is exact
+	auto fine =
+	    std::make_shared<StreamingAUCEvaluation>(-8.005, 7.995, 1600);
+	EXPECT_NEAR(exact, fine->evaluate(predicted, ground_truth), 1E-12);
+}
+
+TEST(StreamingAUCEvaluation, nan_output)
+{
+	std::shared_ptr<BinaryLabels> predicted, ground_truth;
+	generate_scores(100, predicted, ground_truth);
+	predicted->set_value(std::numeric_limits<float64_t>::quiet_NaN(), 42);
+
+	auto streaming = std::make_shared<StreamingAUCEvaluation>(-4.0, 4.0, 200);
+	EXPECT_THROW(streaming->add_batch(predicted, ground_truth), ShogunException);
+	EXPECT_EQ(0, streaming->get_num_examples());
+}
+
+TEST(StreamingAUCEvaluation, bins_are_readonly)
+{
+	auto streaming = std::make_shared<StreamingAUCEvaluation>(-4.0, 4.0, 200);
+	EXPECT_THROW(streaming->put("num_bins", 400), ShogunException);
+	EXPECT_THROW(streaming->put("low", -8.0), ShogunException);
+	EXPECT_THROW(streaming->put("high", 8.0), ShogunException);
+	EXPECT_EQ(200, streaming->get<int32_t>("num_bins"));
+}
@@ -302,6 +302,35 @@ TEST(DenseFeaturesTest, view)
 	}
 }
 
+TEST(DenseFeaturesTest, materialize_subset)
+{
+	auto num_feats = 3;
+	auto num_vectors = 6;
+	SGMatrix<float64_t> data(num_feats, num_vectors);
+	for (auto i : range(num_feats * num_vectors))
+		data[i] = i;
+	auto feats_original = std::make_shared<DenseFeatures<float64_t>>(data);
+
+	// without subset, nothing is copied
+	EXPECT_EQ(feats_original, feats_original->materialize_subset());
+
+	SGVector<index_t> subset{5, 1, 1, 3};
+	auto feats_subset = view(feats_original, subset);
+	auto materialized = feats_subset->materialize_subset()
+	                        ->as<DenseFeatures<float64_t>>();
+	ASSERT_NE(feats_subset, materialized);
+	EXPECT_FALSE(materialized->get_subset_stack()->has_subsets());
+	ASSERT_EQ(subset.vlen, materialized->get_num_vectors());
+
+	auto matrix = materialized->get_feature_matrix();
+	ASSERT_NE(data.matrix, matrix.matrix);
+	for (auto j : range(subset.vlen))
+	{
+		for (auto i : range(num_feats))
+			EXPECT_EQ(data(i, subset[j]), matrix(i, j));
+	}
+}
+
 TEST(DenseFeaturesTest, iterator)
 {
     SGVector<float64_t> vals(20);
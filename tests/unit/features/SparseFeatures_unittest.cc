@@ -11,6 +11,7 @@
 #include <shogun/io/stream/FileInputStream.h>
 #include <shogun/io/stream/FileOutputStream.h>
 #include <shogun/lib/SGMatrix.h>
+#include <shogun/features/DenseFeatures.h>
 #include <shogun/features/SparseFeatures.h>
 #include <string>
 
@@ -412,3 +413,155 @@ TEST(SparseFeaturesTest,subset_get_full_feature_vector_smaller)
 
 
 }
+
+TEST(SparseFeaturesTest,compressed_storage)
+{
+	SGMatrix<float64_t> data(4, 5);
+	for (index_t i=0; i<data.size(); ++i)
+		data.matrix[i]=i%3==0 ? 0 : i;
+
+	auto features=std::make_shared<SparseFeatures<float64_t>>(data);
+	auto compressed=std::make_shared<SparseFeatures<float64_t>>(data);
+	compressed->compress();
+
+	ASSERT_TRUE(compressed->is_compressed());
+	EXPECT_FALSE(features->is_compressed());
+	EXPECT_EQ(features->get_num_vectors(), compressed->get_num_vectors());
+	EXPECT_EQ(features->get_num_features(), compressed->get_num_features());
+	EXPECT_EQ(
+		features->get_num_nonzero_entries(),
+		compressed->get_num_nonzero_entries());
+	EXPECT_TRUE(compressed->get_full_feature_matrix().equals(data));
+
+	SGVector<float64_t> w(data.num_rows);
+	w.range_fill(1.0);
+	for (index_t i=0; i<data.num_cols; ++i)
+	{
+		EXPECT_EQ(
+			features->get_nnz_features_for_vector(i),
+			compressed->get_nnz_features_for_vector(i));
+		EXPECT_DOUBLE_EQ(features->dot(i, w), compressed->dot(i, w));
+		EXPECT_DOUBLE_EQ(
+			features->dense_dot(2.0, i, w.vector, w.vlen, 1.0),
+			compressed->dense_dot(2.0, i, w.vector, w.vlen, 1.0));
+		for (index_t j=0; j<data.num_cols; ++j)
+			EXPECT_DOUBLE_EQ(
+				features->dot(i, features, j), compressed->dot(i, compressed, j));
+
+		SGVector<float64_t> a(data.num_rows), b(data.num_rows);
+		a.zero();
+		b.zero();
+		features->add_to_dense_vec(0.5, i, a.vector, a.vlen);
+		compressed->add_to_dense_vec(0.5, i, b.vector, b.vlen);
+		EXPECT_TRUE(a.equals(b));
+
+		auto sv=compressed->get_sparse_feature_vector(i);
+		EXPECT_TRUE(sv.equals(features->get_sparse_feature_vector(i)));
+	}
+
+	auto transposed=compressed->get_transposed();
+	EXPECT_TRUE(transposed->is_compressed());
+	EXPECT_TRUE(transposed->get_full_feature_matrix().equals(
+		features->get_transposed()->get_full_feature_matrix()));
+
+	EXPECT_TRUE(compressed->get_sparse_feature_matrix().equals(
+		features->get_sparse_feature_matrix()));
+}
+
+TEST(SparseFeaturesTest,compressed_storage_subset)
+{
+	SGMatrix<int32_t> data(3, 6);
+	for (index_t i=0; i<data.size(); ++i)
+		data.matrix[i]=i%2==0 ? 0 : i;
+
+	SGSparseMatrix<int32_t> sparse(data);
+	SGVector<index_t> indptr, indices;
+	SGVector<int32_t> values;
+	sparse.to_compressed(indptr, indices, values);
+	EXPECT_EQ(data.num_cols+1, indptr.vlen);
+
+	auto features=std::make_shared<SparseFeatures<int32_t>>(
+		indptr, indices, values, data.num_rows);
+	ASSERT_TRUE(features->is_compressed());
+
+	SGVector<index_t> subset_idx(3);
+	subset_idx[0]=4;
+	subset_idx[1]=1;
+	subset_idx[2]=4;
+	features->add_subset(subset_idx);
+
+	EXPECT_EQ(features->get_num_vectors(), subset_idx.vlen);
+	for (index_t i=0; i<subset_idx.vlen; ++i)
+	{
+		// subsets are views into the compressed arrays
+		const index_t* current_indices;
+		const int32_t* current_values;
+		features->get_compressed_feature_vector(i, current_indices, current_values);
+		EXPECT_EQ(indices.vector+indptr[subset_idx[i]], current_indices);
+		EXPECT_EQ(values.vector+indptr[subset_idx[i]], current_values);
+
+		SGVector<int32_t> vec=features->get_full_feature_vector(i);
+		for (index_t j=0; j<vec.vlen; ++j)
+			EXPECT_EQ(vec[j], data(j,subset_idx[i]));
+	}
+
+	features->remove_subset();
+	auto copy=features->copy_subset(subset_idx)->as<SparseFeatures<int32_t>>();
+	EXPECT_TRUE(copy->is_compressed());
+	SGMatrix<int32_t> full=copy->get_full_feature_matrix();
+	for (index_t i=0; i<subset_idx.vlen; ++i)
+	{
+		for (index_t j=0; j<data.num_rows; ++j)
+			EXPECT_EQ(full(j,i), data(j,subset_idx[i]));
+	}
+}
+
+TEST(SparseFeaturesTest,compressed_storage_unsorted)
+{
+	// vector 0 has unsorted indices, vector 1 a repeated index
+	SGVector<index_t> indptr({0, 3, 6, 7});
+	SGVector<index_t> indices({3, 0, 2, 1, 1, 4, 2});
+	SGVector<float64_t> values({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0});
+	auto original_indices=indices.clone();
+
+	SGMatrix<float64_t> data(5, 3);
+	data.zero();
+	for (index_t i=0; i<indptr.vlen-1; ++i)
+	{
+		for (index_t k=indptr[i]; k<indptr[i+1]; ++k)
+			data(indices[k], i)+=values[k];
+	}
+
+	auto features=std::make_shared<SparseFeatures<float64_t>>(
+		indptr, indices, values, data.num_rows);
+	ASSERT_TRUE(features->is_compressed());
+	// the arrays of the caller are not modified
+	EXPECT_TRUE(indices.equals(original_indices));
+	EXPECT_TRUE(features->get_full_feature_matrix().equals(data));
+
+	// unsorted sparse vectors are sorted when compressing
+	SGSparseMatrix<float64_t> sparse(data.num_rows, data.num_cols);
+	for (index_t i=0; i<indptr.vlen-1; ++i)
+	{
+		SGSparseVector<float64_t> sv(indptr[i+1]-indptr[i]);
+		for (index_t k=indptr[i]; k<indptr[i+1]; ++k)
+		{
+			sv.features[k-indptr[i]].feat_index=indices[k];
+			sv.features[k-indptr[i]].entry=values[k];
+		}
+		sparse[i]=sv;
+	}
+	auto compressed=std::make_shared<SparseFeatures<float64_t>>(sparse);
+	compressed->compress();
+
+	auto dense=std::make_shared<DenseFeatures<float64_t>>(data);
+	for (index_t i=0; i<data.num_cols; ++i)
+	{
+		for (index_t j=0; j<data.num_cols; ++j)
+		{
+			auto expected=dense->dot(i, dense, j);
+			EXPECT_DOUBLE_EQ(expected, features->dot(i, features, j));
+			EXPECT_DOUBLE_EQ(expected, compressed->dot(i, compressed, j));
+		}
+	}
+}
@@ -1,8 +1,13 @@
+#include "utils/Utils.h"
 #include <gtest/gtest.h>
 
 #include <algorithm>
 
+#include <shogun/base/ShogunEnv.h>
+#include <shogun/io/MemoryMappedFile.h>
 #include <shogun/io/ShogunErrc.h>
+#include <shogun/io/fs/FileSystem.h>
+#include <shogun/io/stream/FileOutputStream.h>
 #include <shogun/io/serialization/BitserySerializer.h>
 #include <shogun/io/serialization/BitseryDeserializer.h>
 
@@ -145,3 +150,135 @@ TYPED_TEST(SerializationTest, serialize)
 
 	ASSERT_TRUE(obj->equals(deser_obj));
 }
+
+TEST(JsonSerializer, base64_arrays)
+{
+	SGMatrix<float64_t> data {{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+	auto df = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto obj = std::make_shared<GaussianKernel>(df, df, 2.0);
+
+	auto serializer = std::make_shared<JsonSerializer>();
+	serializer->set_base64_arrays(true);
+	auto stream = std::make_shared<DummyOutputStream>();
+	serializer->attach(stream);
+	serializer->write(obj);
+	EXPECT_NE(string::npos, stream->buffer().find("\"base64\""));
+
+	auto deserializer = std::make_shared<JsonDeserializer>();
+	auto istream = std::make_shared<DummyInputStream>(stream->buffer());
+	deserializer->attach(istream);
+	auto deser_obj = deserializer->read_object();
+
+	ASSERT_TRUE(obj->equals(deser_obj));
+}
+
+TEST(BitserySerializer, page_aligned_arrays)
+{
+	SGMatrix<float64_t> data(64, 64);
+	data.set_const(1.0);
+	data(3, 5) = 2.0;
+	auto obj = std::make_shared<DenseFeatures<float64_t>>(data);
+
+	auto serializer = std::make_shared<BitserySerializer>();
+	serializer->set_page_aligned_arrays(true);
+	auto stream = std::make_shared<DummyOutputStream>();
+	serializer->attach(stream);
+	serializer->write(obj);
+	EXPECT_GT(stream->buffer().size(), 2 * 4096);
+
+	auto deserializer = std::make_shared<BitseryDeserializer>();
+	auto istream = std::make_shared<DummyInputStream>(stream->buffer());
+	deserializer->attach(istream);
+	auto deser_obj = deserializer->read_object();
+
+	ASSERT_TRUE(obj->equals(deser_obj));
+}
+
+TEST(BitseryDeserializer, memory_mapped)
+{
+	SGMatrix<float64_t> data(64, 64);
+	data.set_const(1.0);
+	data(3, 5) = 2.0;
+	auto obj = std::make_shared<DenseFeatures<float64_t>>(data);
+
+	std::string filename = "serialization-bitsery-mapped.XXXXXX";
+	generate_temp_filename(const_cast<char*>(filename.c_str()));
+	auto fs = env();
+	{
+		std::unique_ptr<io::WritableFile> file;
+		ASSERT_TRUE(!fs->new_writable_file(filename, &file));
+		auto fos = std::make_shared<io::FileOutputStream>(file.get());
+		auto serializer = std::make_shared<BitserySerializer>();
+		serializer->set_page_aligned_arrays(true);
+		serializer->attach(fos);
+		serializer->write(obj);
+	}
+
+	auto deserializer = std::make_shared<BitseryDeserializer>();
+	/* only copy-on-write mappings can be written safely */
+	EXPECT_THROW(
+		deserializer->attach_mapped(
+			std::make_shared<MemoryMappedFile<char>>(filename.c_str(), 'r')),
+		ShogunException);
+
+	auto file = std::make_shared<MemoryMappedFile<char>>(filename.c_str(), 'c');
+	deserializer->attach_mapped(file);
+	auto deser_obj = deserializer->read_object()->as<DenseFeatures<float64_t>>();
+	ASSERT_TRUE(obj->equals(deser_obj));
+
+	/* the matrix refers to the mapped file */
+	auto matrix = deser_obj->get_feature_matrix();
+	EXPECT_GE(matrix.matrix, (float64_t*)file->get_map());
+	EXPECT_LE(
+		matrix.matrix + matrix.num_rows * matrix.num_cols,
+		(float64_t*)(file->get_map() + file->get_size()));
+
+	/* modifications do not change the file */
+	matrix(3, 5) = 3.0;
+	auto other = std::make_shared<BitseryDeserializer>();
+	other->attach_mapped(std::make_shared<MemoryMappedFile<char>>(filename.c_str(), 'c'));
+	EXPECT_TRUE(obj->equals(other->read_object()));
+	EXPECT_FALSE(obj->equals(deser_obj));
+	ASSERT_TRUE(!fs->delete_file(filename));
+}
+
+TEST(BitseryDeserializer, memory_mapped_lifetime)
+{
+	SGMatrix<float64_t> data(64, 64);
+	data.set_const(1.0);
+	data(3, 5) = 2.0;
+	auto obj = std::make_shared<DenseFeatures<float64_t>>(data);
+
+	std::string filename = "serialization-bitsery-lifetime.XXXXXX";
+	generate_temp_filename(const_cast<char*>(filename.c_str()));
+	auto fs = env();
+	{
+		std::unique_ptr<io::WritableFile> file;
+		ASSERT_TRUE(!fs->new_writable_file(filename, &file));
+		auto fos = std::make_shared<io::FileOutputStream>(file.get());
+		auto serializer = std::make_shared<BitserySerializer>();
+		serializer->set_page_aligned_arrays(true);
+		serializer->attach(fos);
+		serializer->write(obj);
+	}
+
+	auto file = std::make_shared<MemoryMappedFile<char>>(filename.c_str(), 'c');
+	std::weak_ptr<MemoryMappedFile<char>> mapping = file;
+	auto deserializer = std::make_shared<BitseryDeserializer>();
+	deserializer->attach_mapped(file);
+	auto deser_obj = deserializer->read_object()->as<DenseFeatures<float64_t>>();
+
+	/* the loaded matrix keeps the mapping alive */
+	file.reset();
+	deserializer.reset();
+	EXPECT_FALSE(mapping.expired());
+	ASSERT_TRUE(obj->equals(deser_obj));
+	auto matrix = deser_obj->get_feature_matrix();
+	EXPECT_EQ(2.0, matrix(3, 5));
+
+	deser_obj.reset();
+	EXPECT_FALSE(mapping.expired());
+	matrix = SGMatrix<float64_t>();
+	EXPECT_TRUE(mapping.expired());
+	ASSERT_TRUE(!fs->delete_file(filename));
+}
@@ -13,6 +13,7 @@
 #include <shogun/kernel/CustomKernel.h>
 #include <shogun/kernel/GaussianKernel.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/NormalDistribution.h>
 #include <shogun/mathematics/RandomNamespace.h>
 
 using namespace shogun;
@@ -192,6 +193,112 @@ TEST(CombinedKernelTest,weights)
 
 }
 
+TEST(CombinedKernelTest, subkernel_quadratic_forms)
+{
+	std::mt19937_64 prng(23);
+	SGMatrix<float64_t> data(2, 20);
+	random::fill_array(data, NormalDistribution<float64_t>(), prng);
+	auto feats = std::make_shared<DenseFeatures<float64_t>>(data);
+
+	auto combined = std::make_shared<CombinedKernel>();
+	combined->append_kernel(std::make_shared<GaussianKernel>(1.0));
+	combined->append_kernel(std::make_shared<GaussianKernel>(5.0));
+	combined->init(feats, feats);
+
+	SGVector<index_t> all(20);
+	all.range_fill();
+	auto matrices = combined->get_subkernel_matrices(all, all);
+	ASSERT_EQ(2, matrices.size());
+
+	// second index set shares some vectors with the first one, which are
+	// taken from the cache
+	SGVector<index_t> idx_1({0, 3, 4, 7, 11});
+	SGVector<index_t> idx_2({4, 5, 11, 0, 19, 2});
+	for (const auto& idx : {idx_1, idx_2, idx_2})
+	{
+		SGVector<float64_t> weights(idx.vlen);
+		random::fill_array(weights, NormalDistribution<float64_t>(), prng);
+
+		auto forms = combined->compute_subkernel_quadratic_forms(idx, weights);
+		ASSERT_EQ(2, forms.vlen);
+		for (index_t k = 0; k < 2; ++k)
+		{
+			float64_t expected = 0;
+			for (index_t i = 0; i < idx.vlen; ++i)
+				for (index_t j = 0; j < idx.vlen; ++j)
+					expected += weights[i] * weights[j] *
+					            matrices[k](idx[i], idx[j]);
+			EXPECT_NEAR(expected, forms[k], 1e-10);
+		}
+	}
+}
+
+TEST(CombinedKernelTest, subkernel_quadratic_forms_uncached)
+{
+	std::mt19937_64 prng(29);
+	SGMatrix<float64_t> data(2, 150);
+	random::fill_array(data, NormalDistribution<float64_t>(), prng);
+	auto feats = std::make_shared<DenseFeatures<float64_t>>(data);
+
+	auto cached = std::make_shared<CombinedKernel>();
+	cached->append_kernel(std::make_shared<GaussianKernel>(1.0));
+	cached->append_kernel(std::make_shared<GaussianKernel>(5.0));
+	cached->init(feats, feats);
+	auto uncached = cached->clone()->as<CombinedKernel>();
+	uncached->put("subkernel_cache_size", 0);
+	uncached->init(feats, feats);
+
+	// more vectors than fit into one tile
+	SGVector<index_t> idx(130);
+	for (index_t i = 0; i < idx.vlen; ++i)
+		idx[i] = 149 - i;
+	SGVector<float64_t> weights(idx.vlen);
+	random::fill_array(weights, NormalDistribution<float64_t>(), prng);
+
+	auto expected = cached->compute_subkernel_quadratic_forms(idx, weights);
+	auto forms = uncached->compute_subkernel_quadratic_forms(idx, weights);
+	ASSERT_EQ(expected.vlen, forms.vlen);
+	for (index_t k = 0; k < forms.vlen; ++k)
+		EXPECT_NEAR(expected[k], forms[k], 1e-9);
+}
+
+TEST(CombinedKernelTest, compute_batch)
+{
+	std::mt19937_64 prng(31);
+	SGMatrix<float64_t> data(2, 150);
+	random::fill_array(data, NormalDistribution<float64_t>(), prng);
+	auto feats = std::make_shared<DenseFeatures<float64_t>>(data);
+
+	auto combined = std::make_shared<CombinedKernel>();
+	combined->append_kernel(std::make_shared<GaussianKernel>(1.0));
+	combined->append_kernel(std::make_shared<GaussianKernel>(5.0));
+	combined->set_subkernel_weights(SGVector<float64_t>({0.3, 0.7}));
+	combined->init(feats, feats);
+
+	// more vectors and support vectors than fit into one tile
+	SGVector<int32_t> vec_idx(150);
+	vec_idx.range_fill();
+	SGVector<int32_t> sv_idx(100);
+	for (index_t i = 0; i < sv_idx.vlen; ++i)
+		sv_idx[i] = 149 - i;
+	SGVector<float64_t> alphas(sv_idx.vlen);
+	random::fill_array(alphas, NormalDistribution<float64_t>(), prng);
+
+	SGVector<float64_t> result(vec_idx.vlen);
+	result.zero();
+	combined->compute_batch(
+	    vec_idx.vlen, vec_idx.vector, result.vector, sv_idx.vlen,
+	    sv_idx.vector, alphas.vector);
+
+	for (index_t i = 0; i < vec_idx.vlen; ++i)
+	{
+		float64_t expected = 0;
+		for (index_t j = 0; j < sv_idx.vlen; ++j)
+			expected += alphas[j] * combined->kernel(sv_idx[j], vec_idx[i]);
+		EXPECT_NEAR(expected, result[i], 1e-10);
+	}
+}
+
 //FIXME
 TEST(CombinedKernelTest, DISABLED_serialization)
 {
@@ -34,6 +34,7 @@
 #include <shogun/lib/SGMatrix.h>
 #include <shogun/features/DenseFeatures.h>
 #include <shogun/kernel/GaussianKernel.h>
+#include <shogun/kernel/GaussianShiftKernel.h>
 #include <shogun/mathematics/NormalDistribution.h>
 
 using namespace shogun;
@@ -370,3 +371,59 @@ TEST(Kernel, gaussian_get_kernel_matrix)
 
 
 }
+
+TEST(Kernel, gaussian_compute_kernel_block)
+{
+	const int32_t seed = 100;
+	const index_t num_feats_p=30;
+	const index_t num_feats_q=20;
+	const index_t dim=3;
+
+	std::mt19937_64 prng(seed);
+	SGMatrix<float64_t> data_p = generate_std_norm_matrix(num_feats_p, dim, prng);
+	SGMatrix<float64_t> data_q = generate_std_norm_matrix(num_feats_q, dim, prng);
+	auto feats_p=std::make_shared<DenseFeatures<float64_t>>(data_p);
+	auto feats_q=std::make_shared<DenseFeatures<float64_t>>(data_q);
+
+	auto kernel=std::make_shared<GaussianKernel>(feats_p, feats_q, 2);
+
+	SGVector<index_t> idx_a({3, 17, 0, 29, 8});
+	SGVector<index_t> idx_b({19, 2, 2, 11});
+	SGMatrix<float64_t> block(idx_a.vlen, idx_b.vlen);
+	kernel->compute_kernel_block(idx_a, idx_b, block);
+	for (index_t i=0; i<idx_a.vlen; i++)
+		for (index_t j=0; j<idx_b.vlen; ++j)
+			EXPECT_NEAR(kernel->kernel(idx_a[i], idx_b[j]), block(i, j), 1E-12);
+
+	// generic evaluation on precomputed distances
+	kernel->precompute_distance();
+	SGMatrix<float64_t> precomputed_block(idx_a.vlen, idx_b.vlen);
+	kernel->compute_kernel_block(idx_a, idx_b, precomputed_block);
+	for (index_t i=0; i<block.size(); i++)
+		EXPECT_NEAR(block[i], precomputed_block[i], 1E-6);
+}
+
+TEST(Kernel, gaussian_shift_compute_kernel_block)
+{
+	const int32_t seed = 100;
+	const index_t num_feats_p=30;
+	const index_t num_feats_q=20;
+	const index_t dim=6;
+
+	std::mt19937_64 prng(seed);
+	SGMatrix<float64_t> data_p = generate_std_norm_matrix(num_feats_p, dim, prng);
+	SGMatrix<float64_t> data_q = generate_std_norm_matrix(num_feats_q, dim, prng);
+	auto feats_p=std::make_shared<DenseFeatures<float64_t>>(data_p);
+	auto feats_q=std::make_shared<DenseFeatures<float64_t>>(data_q);
+
+	// subclasses of GaussianKernel must not take its fast path
+	auto kernel=std::make_shared<GaussianShiftKernel>(feats_p, feats_q, 2, 2, 1);
+
+	SGVector<index_t> idx_a({3, 17, 0, 29, 8});
+	SGVector<index_t> idx_b({19, 2, 2, 11});
+	SGMatrix<float64_t> block(idx_a.vlen, idx_b.vlen);
+	kernel->compute_kernel_block(idx_a, idx_b, block);
+	for (index_t i=0; i<idx_a.vlen; i++)
+		for (index_t j=0; j<idx_b.vlen; ++j)
+			EXPECT_NEAR(kernel->kernel(idx_a[i], idx_b[j]), block(i, j), 1E-12);
+}
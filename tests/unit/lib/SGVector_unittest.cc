@@ -370,6 +370,32 @@ TEST(SGVectorTest, resize_vector_larger)
 		EXPECT_EQ(m[i], 0);
 }
 
+TEST(SGVectorTest, resize_vector_owned_elsewhere)
+{
+	auto memory = std::make_shared<std::vector<index_t>>(
+		std::initializer_list<index_t>{0, 1, 2});
+	std::weak_ptr<std::vector<index_t>> owner = memory;
+	SGVector<index_t> m(memory->data(), 3, memory);
+	SGVector<index_t> view(m);
+	memory.reset();
+	EXPECT_FALSE(owner.expired());
+
+	m.resize_vector(5);
+	EXPECT_EQ(m.vlen, 5);
+	EXPECT_NE(m.vector, view.vector);
+	for (index_t i=0; i<3; i++)
+		EXPECT_EQ(m[i], i);
+	for (index_t i=3; i<5; i++)
+		EXPECT_EQ(m[i], 0);
+
+	// other copies still refer to the memory, which they keep alive
+	EXPECT_EQ(view.vlen, 3);
+	EXPECT_EQ(view[2], 2);
+	EXPECT_FALSE(owner.expired());
+	view = SGVector<index_t>();
+	EXPECT_TRUE(owner.expired());
+}
+
 TEST(SGVectorTest,iterator)
 {
 	SGVector<float64_t> t {1.0, 2.0, 3.0, 4.0, 5.0};
@@ -0,0 +1,86 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+#include <shogun/lib/ScratchArena.h>
+
+#include <cstdint>
+
+using namespace shogun;
+
+TEST(ScratchArena, scope_releases)
+{
+	ScratchArena arena;
+	float64_t* first;
+	{
+		ScratchArena::Scope scratch(arena);
+		auto vec = scratch.vector<float64_t>(100);
+		EXPECT_EQ(100, vec.vlen);
+		EXPECT_EQ(-1, vec.ref_count());
+		first = vec.vector;
+		for (index_t i = 0; i < vec.vlen; ++i)
+			vec[i] = i;
+
+		// nested scopes do not touch outer buffers
+		{
+			ScratchArena::Scope inner(arena);
+			auto other = inner.vector<float64_t>(100);
+			EXPECT_NE(first, other.vector);
+			for (index_t i = 0; i < other.vlen; ++i)
+				other[i] = -1;
+		}
+		for (index_t i = 0; i < vec.vlen; ++i)
+			EXPECT_EQ(i, vec[i]);
+	}
+
+	// memory is reused after release
+	auto capacity = arena.capacity();
+	{
+		ScratchArena::Scope scratch(arena);
+		auto vec = scratch.vector<float64_t>(100);
+		EXPECT_EQ(first, vec.vector);
+	}
+	EXPECT_EQ(capacity, arena.capacity());
+}
+
+TEST(ScratchArena, alignment_and_growth)
+{
+	ScratchArena arena;
+	ScratchArena::Scope scratch(arena);
+
+	auto flags = scratch.vector<bool>(3);
+	auto small = scratch.vector<float64_t>(7);
+	EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(small.vector) % 64);
+	EXPECT_GE(
+	    reinterpret_cast<char*>(small.vector),
+	    reinterpret_cast<char*>(flags.vector) + 3);
+
+	// larger than a block
+	auto mat = scratch.matrix<index_t>(1000, 100);
+	EXPECT_EQ(1000, mat.num_rows);
+	EXPECT_EQ(100, mat.num_cols);
+	EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(mat.matrix) % 64);
+	for (index_t i = 0; i < mat.num_rows * mat.num_cols; ++i)
+		mat.matrix[i] = i;
+	for (index_t i = 0; i < small.vlen; ++i)
+		small[i] = 1.0;
+	for (index_t i = 0; i < mat.num_rows * mat.num_cols; ++i)
+		ASSERT_EQ(i, mat.matrix[i]);
+	EXPECT_GE(arena.capacity(), 1000 * 100 * sizeof(index_t));
+}
+
+TEST(ScratchArena, thread_local_arena)
+{
+	auto& arena = ScratchArena::thread_local_arena();
+	EXPECT_EQ(&arena, &ScratchArena::thread_local_arena());
+
+	auto marker = arena.mark();
+	{
+		ScratchArena::Scope scratch;
+		scratch.vector<int32_t>(10);
+	}
+	auto after = arena.mark();
+	EXPECT_EQ(marker.block, after.block);
+	EXPECT_EQ(marker.offset, after.offset);
+}
@@ -0,0 +1,111 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+#include <shogun/base/ShogunEnv.h>
+#include <shogun/evaluation/MeanSquaredError.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/labels/RegressionLabels.h>
+#include <shogun/loss/AbsoluteDeviationLoss.h>
+#include <shogun/loss/SquaredLoss.h>
+#include <shogun/machine/HistogramGBMachine.h>
+#include <shogun/mathematics/RandomNamespace.h>
+
+using namespace shogun;
+
+class HistogramGBMachineTest : public ::testing::Test
+{
+protected:
+	const int32_t num_train_samples = 1000;
+	const int32_t num_test_samples = 200;
+	const int32_t dim = 3;
+	std::mt19937_64 prng;
+
+	/** the label depends on the first feature only */
+	void load_sinusoid_samples(
+	    int32_t num_samples, std::shared_ptr<DenseFeatures<float64_t>>& feats,
+	    std::shared_ptr<RegressionLabels>& labels)
+	{
+		SGMatrix<float64_t> mat(dim, num_samples);
+		random::fill_array(mat, 0.0, 15.0, prng);
+
+		SGVector<float64_t> lab(num_samples);
+		for (int32_t i = 0; i < num_samples; i++)
+			lab[i] = std::sin(mat(0, i));
+
+		feats = std::make_shared<DenseFeatures<float64_t>>(mat);
+		labels = std::make_shared<RegressionLabels>(lab);
+	}
+
+	void SetUp() override
+	{
+		prng.seed(835);
+		load_sinusoid_samples(num_train_samples, train_feats, train_labels);
+		load_sinusoid_samples(num_test_samples, test_feats, test_labels);
+	}
+
+	float64_t test_error(const std::shared_ptr<HistogramGBMachine>& machine)
+	{
+		auto mse = std::make_shared<MeanSquaredError>();
+		return mse->evaluate(machine->apply(test_feats), test_labels);
+	}
+
+	std::shared_ptr<DenseFeatures<float64_t>> train_feats;
+	std::shared_ptr<DenseFeatures<float64_t>> test_feats;
+	std::shared_ptr<RegressionLabels> train_labels;
+	std::shared_ptr<RegressionLabels> test_labels;
+};
+
+TEST_F(HistogramGBMachineTest, sinusoid_curve_fitting)
+{
+	auto sq = std::make_shared<SquaredLoss>();
+	auto machine = std::make_shared<HistogramGBMachine>(sq, 100, 0.1, 1.0);
+	machine->put("seed", 2855);
+	machine->put(HistogramGBMachine::kMaxLeaves, 8);
+	machine->set_labels(train_labels);
+	machine->train(train_feats);
+
+	EXPECT_LT(test_error(machine), 0.02);
+	EXPECT_GT(machine->get_num_nodes(), 100);
+	EXPECT_LE(machine->get_num_nodes(), 100 * (2 * 8 - 1));
+}
+
+TEST_F(HistogramGBMachineTest, subsampling_and_absolute_loss)
+{
+	auto loss = std::make_shared<AbsoluteDeviationLoss>();
+	auto machine = std::make_shared<HistogramGBMachine>(loss, 100, 0.1, 0.6);
+	machine->put("seed", 2855);
+	machine->put(HistogramGBMachine::kFeatureFraction, 0.7);
+	machine->put(HistogramGBMachine::kMaxBins, 32);
+	machine->put(HistogramGBMachine::kMaxDepth, 3);
+	machine->set_labels(train_labels);
+	machine->train(train_feats);
+
+	EXPECT_LT(test_error(machine), 0.1);
+	// depth 3 allows at most 8 leaves
+	EXPECT_LE(machine->get_num_nodes(), 100 * (2 * 8 - 1));
+}
+
+TEST_F(HistogramGBMachineTest, independent_of_num_threads)
+{
+	auto train = [&](int32_t num_threads) {
+		env()->set_num_threads(num_threads);
+		auto machine = std::make_shared<HistogramGBMachine>(
+		    std::make_shared<SquaredLoss>(), 20, 0.1, 0.8);
+		machine->put("seed", 7);
+		machine->put(HistogramGBMachine::kFeatureFraction, 0.5);
+		machine->set_labels(train_labels);
+		machine->train(train_feats);
+		return machine->apply_regression(test_feats)->get_labels();
+	};
+
+	auto num_threads = env()->get_num_threads();
+	auto serial = train(1);
+	auto parallel = train(4);
+	env()->set_num_threads(num_threads);
+
+	ASSERT_EQ(serial.vlen, parallel.vlen);
+	for (index_t i = 0; i < serial.vlen; ++i)
+		EXPECT_EQ(serial[i], parallel[i]);
+}
@@ -6,12 +6,17 @@
 #include <gtest/gtest.h>
 #include <shogun/lib/exception/InvalidStateException.h>
 #include <shogun/machine/Pipeline.h>
+#include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/preprocessor/NormOne.h>
+#include <shogun/preprocessor/RescaleFeatures.h>
 #include <stdexcept>
 
 using namespace shogun;
 using ::testing::Mock;
 using ::testing::NiceMock;
 using ::testing::Return;
+using ::testing::DoAll;
+using ::testing::SaveArg;
 using ::testing::_;
 using ::testing::InSequence;
 
@@ -93,3 +98,49 @@ TEST_F(PipelineTest, get)
 	EXPECT_EQ(pipeline->get_transformer(transformer_name), transformer2);
 	EXPECT_EQ(pipeline->get_machine(), machine);
 }
+
+TEST_F(PipelineTest, fuse_preprocessors)
+{
+	SGMatrix<float64_t> data(4, 30);
+	std::mt19937_64 prng(7);
+	random::fill_array(data, -1.0, 1.0, prng);
+	auto original = data.clone();
+	auto features = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto labels = std::make_shared<NiceMock<MockLabels>>();
+
+	auto pipeline = std::make_shared<PipelineBuilder>()
+	                    ->over(std::make_shared<RescaleFeatures>())
+	                    ->over(std::make_shared<NormOne>())
+	                    ->then(machine);
+	pipeline->set_fuse_preprocessors(true);
+	EXPECT_TRUE(pipeline->get_fuse_preprocessors());
+
+	std::shared_ptr<Features> trained, applied;
+	EXPECT_CALL(*machine, train_machine(_))
+	    .WillOnce(DoAll(SaveArg<0>(&trained), Return(true)));
+	EXPECT_CALL(*machine, apply(_))
+	    .WillOnce(DoAll(SaveArg<0>(&applied), Return(nullptr)));
+	pipeline->set_labels(labels);
+	pipeline->train(features);
+	pipeline->apply(features);
+
+	// input is not modified
+	EXPECT_TRUE(data.equals(original));
+
+	std::shared_ptr<Features> expected =
+	    std::make_shared<DenseFeatures<float64_t>>(original);
+	auto rescale = std::make_shared<RescaleFeatures>();
+	rescale->fit(expected);
+	expected = rescale->transform(expected);
+	expected = std::make_shared<NormOne>()->transform(expected);
+	auto expected_matrix =
+	    expected->as<DenseFeatures<float64_t>>()->get_feature_matrix();
+	for (const auto& result : {trained, applied})
+	{
+		auto matrix = result->as<DenseFeatures<float64_t>>()->get_feature_matrix();
+		ASSERT_EQ(expected_matrix.num_rows, matrix.num_rows);
+		ASSERT_EQ(expected_matrix.num_cols, matrix.num_cols);
+		for (auto i : range(matrix.size()))
+			EXPECT_NEAR(expected_matrix[i], matrix[i], 1e-14);
+	}
+}
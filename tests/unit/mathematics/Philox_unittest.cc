@@ -0,0 +1,98 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+#include <shogun/base/ShogunEnv.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/mathematics/NormalDistribution.h>
+#include <shogun/mathematics/Philox.h>
+#include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/mathematics/UniformRealDistribution.h>
+
+using namespace shogun;
+
+TEST(Philox, known_answer)
+{
+	// Philox4x32-10 of counter 0 under key 0, reference implementation
+	Philox prng;
+	EXPECT_EQ(0x6627e8d5e169c58dULL, prng());
+	EXPECT_EQ(0xbc57ac4c9b00dbd8ULL, prng());
+}
+
+TEST(Philox, discard)
+{
+	for (uint64_t n : {0, 1, 2, 5, 1000})
+	{
+		Philox a(42), b(42);
+		for (uint64_t i = 0; i < n; ++i)
+			a();
+		b.discard(n);
+		EXPECT_EQ(a(), b());
+		EXPECT_EQ(a(), b());
+	}
+
+	// discard from the middle of a block
+	Philox a(42), b(42);
+	a();
+	b();
+	for (auto i = 0; i < 3; ++i)
+		a();
+	b.discard(3);
+	EXPECT_EQ(a(), b());
+}
+
+TEST(Philox, substreams)
+{
+	Philox prng(7);
+	auto s0 = prng.substream(0);
+	auto s1 = prng.substream(1);
+	auto s1_copy = prng.substream(1);
+
+	EXPECT_EQ(Philox(7), s0);
+	EXPECT_NE(s0, s1);
+	EXPECT_EQ(s1, s1_copy);
+	for (auto i = 0; i < 10; ++i)
+	{
+		auto x = s1();
+		EXPECT_NE(s0(), x);
+		EXPECT_EQ(x, s1_copy());
+	}
+
+	EXPECT_NE(Philox(7)(), Philox(8)());
+}
+
+TEST(Philox, distribution)
+{
+	Philox prng(3);
+	UniformRealDistribution<float64_t> uniform(0.0, 1.0);
+	const int32_t n = 100000;
+	float64_t mean = 0;
+	for (int32_t i = 0; i < n; ++i)
+	{
+		auto x = uniform(prng);
+		EXPECT_GE(x, 0.0);
+		EXPECT_LT(x, 1.0);
+		mean += x;
+	}
+	EXPECT_NEAR(0.5, mean / n, 1e-2);
+}
+
+TEST(Philox, fill_array_parallel_independent_of_threads)
+{
+	auto num_threads = env()->get_num_threads();
+	Philox prng(11);
+	SGVector<float64_t> serial(10000), parallel(10000);
+
+	env()->set_num_threads(1);
+	random::fill_array_parallel(
+	    serial, NormalDistribution<float64_t>(), prng);
+	env()->set_num_threads(4);
+	random::fill_array_parallel(
+	    parallel, NormalDistribution<float64_t>(), prng);
+	env()->set_num_threads(num_threads);
+
+	for (index_t i = 0; i < serial.vlen; ++i)
+		EXPECT_EQ(serial[i], parallel[i]);
+	EXPECT_NE(serial[0], serial[4096]);
+}
@@ -0,0 +1,169 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+#include <shogun/base/ShogunEnv.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/features/SparseFeatures.h>
+#include <shogun/lib/exception/ShogunException.h>
+#include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/mathematics/ScatterMatrix.h>
+#include <shogun/mathematics/eigen3.h>
+
+#include <random>
+
+using namespace shogun;
+using namespace Eigen;
+
+class ScatterMatrixTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		std::mt19937_64 prng(17);
+		data = SGMatrix<float64_t>(num_features, num_vectors);
+		random::fill_array(data, -1.0, 1.0, prng);
+		labels = SGVector<int32_t>(num_vectors);
+		for (auto i : range(num_vectors))
+		{
+			labels[i] = i % num_classes;
+			// large offset to check the numerical stability
+			data(0, i) += 1e6;
+		}
+		// sparse feature
+		for (auto i : range(num_vectors))
+		{
+			if (i % 3)
+				data(num_features - 1, i) = 0;
+		}
+	}
+
+	MatrixXd reference_scatter(int32_t c) const
+	{
+		Map<MatrixXd> X(data.matrix, num_features, num_vectors);
+		VectorXd mean = VectorXd::Zero(num_features);
+		index_t count = 0;
+		for (auto i : range(num_vectors))
+		{
+			if (labels[i] == c)
+			{
+				mean += X.col(i);
+				count++;
+			}
+		}
+		mean /= count;
+		MatrixXd scatter = MatrixXd::Zero(num_features, num_features);
+		for (auto i : range(num_vectors))
+		{
+			if (labels[i] == c)
+				scatter += (X.col(i) - mean) * (X.col(i) - mean).transpose();
+		}
+		return scatter;
+	}
+
+	const index_t num_features = 5;
+	const index_t num_vectors = 1500;
+	const int32_t num_classes = 3;
+	SGMatrix<float64_t> data;
+	SGVector<int32_t> labels;
+};
+
+TEST_F(ScatterMatrixTest, class_scatter)
+{
+	auto features = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto old_num_threads = env()->get_num_threads();
+	for (auto num_threads : {1, 4})
+	{
+		env()->set_num_threads(num_threads);
+		ScatterMatrix<float64_t> scatter(*features, labels, num_classes);
+		ASSERT_EQ(num_classes, scatter.get_num_classes());
+		for (auto c : range(num_classes))
+		{
+			EXPECT_EQ(num_vectors / num_classes, scatter.get_count(c));
+			auto result = scatter.get_scatter(c);
+			auto reference = reference_scatter(c);
+			for (auto i : range(num_features))
+			{
+				for (auto j : range(num_features))
+					EXPECT_NEAR(reference(i, j), result(i, j), 1e-7);
+			}
+		}
+	}
+	env()->set_num_threads(old_num_threads);
+}
+
+TEST_F(ScatterMatrixTest, independent_of_threads)
+{
+	auto features = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto old_num_threads = env()->get_num_threads();
+	env()->set_num_threads(1);
+	ScatterMatrix<float64_t> reference(*features);
+	for (auto num_threads : {2, 3, 4})
+	{
+		env()->set_num_threads(num_threads);
+		ScatterMatrix<float64_t> scatter(*features);
+		auto mean = scatter.get_mean();
+		auto result = scatter.get_scatter();
+		for (auto i : range(num_features))
+		{
+			EXPECT_EQ(reference.get_mean()[i], mean[i]);
+			for (auto j : range(num_features))
+				EXPECT_EQ(reference.get_scatter()(i, j), result(i, j));
+		}
+	}
+	env()->set_num_threads(old_num_threads);
+}
+
+TEST_F(ScatterMatrixTest, sparse_equals_dense)
+{
+	auto dense = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto sparse = std::make_shared<SparseFeatures<float64_t>>(data);
+	ScatterMatrix<float64_t> dense_scatter(*dense, labels, num_classes);
+	ScatterMatrix<float64_t> sparse_scatter(*sparse, labels, num_classes);
+	for (auto c : range(num_classes))
+	{
+		EXPECT_TRUE(dense_scatter.get_mean(c).equals(sparse_scatter.get_mean(c)));
+		EXPECT_TRUE(dense_scatter.get_scatter(c).equals(sparse_scatter.get_scatter(c)));
+	}
+}
+
+TEST_F(ScatterMatrixTest, diagonal)
+{
+	auto features = std::make_shared<DenseFeatures<float64_t>>(data);
+	ScatterMatrix<float64_t> scatter(*features, labels, num_classes);
+	ScatterMatrix<float64_t> diagonal(*features, labels, num_classes, true);
+	for (auto c : range(num_classes))
+	{
+		auto expected = scatter.get_scatter(c).get_diagonal_vector();
+		auto result = diagonal.get_scatter_diagonal(c);
+		for (auto i : range(num_features))
+			EXPECT_NEAR(expected[i], result[i], 1e-9);
+	}
+	EXPECT_THROW(diagonal.get_scatter(0), ShogunException);
+}
+
+TEST_F(ScatterMatrixTest, merge)
+{
+	auto features = std::make_shared<DenseFeatures<float64_t>>(data);
+	ScatterMatrix<float64_t> scatter(*features);
+
+	auto half = num_vectors / 2;
+	ScatterMatrix<float64_t> merged;
+	auto first = std::make_shared<DenseFeatures<float64_t>>(data.slice(0, half));
+	auto second =
+	    std::make_shared<DenseFeatures<float64_t>>(data.slice(half, num_vectors));
+	merged.merge(ScatterMatrix<float64_t>(*first));
+	merged.merge(ScatterMatrix<float64_t>(*second));
+
+	EXPECT_EQ(num_vectors, merged.get_count());
+	auto mean = scatter.get_mean(), merged_mean = merged.get_mean();
+	for (auto i : range(num_features))
+		EXPECT_NEAR(mean[i], merged_mean[i], 1e-9);
+	auto result = scatter.get_scatter(), merged_result = merged.get_scatter();
+	for (auto i : range(num_features))
+	{
+		for (auto j : range(num_features))
+			EXPECT_NEAR(result(i, j), merged_result(i, j), 1e-7);
+	}
+}
@@ -0,0 +1,138 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+#include <gtest/gtest.h>
+#include <shogun/features/SparseFeatures.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGSparseMatrix.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/mathematics/NormalDistribution.h>
+#include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/mathematics/UniformRealDistribution.h>
+#include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/LinalgSparse.h>
+
+#include <random>
+
+using namespace shogun;
+using namespace Eigen;
+
+class LinalgSparseTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		std::mt19937_64 prng(23);
+		UniformRealDistribution<float64_t> uniform(0.0, 1.0);
+
+		// rows of the dense matrix are the sparse vectors
+		dense = SGMatrix<float64_t>(num_vectors, num_features);
+		for (index_t i = 0; i < dense.size(); ++i)
+			dense[i] = uniform(prng) < 0.3 ? uniform(prng) - 0.5 : 0;
+		sparse = SGSparseMatrix<float64_t>(dense.clone());
+		sparse = sparse.get_transposed();
+
+		x = SGVector<float64_t>(num_features);
+		y = SGVector<float64_t>(num_vectors);
+		B = SGMatrix<float64_t>(num_features, 4);
+		C = SGMatrix<float64_t>(num_vectors, 3);
+		random::fill_array(x, NormalDistribution<float64_t>(), prng);
+		random::fill_array(y, NormalDistribution<float64_t>(), prng);
+		random::fill_array(B, NormalDistribution<float64_t>(), prng);
+		random::fill_array(C, NormalDistribution<float64_t>(), prng);
+	}
+
+	const index_t num_vectors = 17;
+	const index_t num_features = 11;
+	SGMatrix<float64_t> dense;
+	SGSparseMatrix<float64_t> sparse;
+	SGVector<float64_t> x, y;
+	SGMatrix<float64_t> B, C;
+};
+
+TEST_F(LinalgSparseTest, matrix_vector_prod)
+{
+	Map<MatrixXd> A(dense.matrix, num_vectors, num_features);
+	Map<VectorXd> x_eig(x.vector, x.vlen);
+	Map<VectorXd> y_eig(y.vector, y.vlen);
+
+	VectorXd expected = A * x_eig;
+	auto result = linalg::matrix_prod(sparse, x);
+	ASSERT_EQ(num_vectors, result.vlen);
+	for (index_t i = 0; i < result.vlen; ++i)
+		EXPECT_NEAR(expected[i], result[i], 1E-12);
+
+	expected = A.transpose() * y_eig;
+	result = linalg::matrix_prod(sparse, y, true);
+	ASSERT_EQ(num_features, result.vlen);
+	for (index_t i = 0; i < result.vlen; ++i)
+		EXPECT_NEAR(expected[i], result[i], 1E-12);
+}
+
+TEST_F(LinalgSparseTest, matrix_matrix_prod)
+{
+	Map<MatrixXd> A(dense.matrix, num_vectors, num_features);
+	Map<MatrixXd> B_eig(B.matrix, B.num_rows, B.num_cols);
+	Map<MatrixXd> C_eig(C.matrix, C.num_rows, C.num_cols);
+
+	MatrixXd expected = A * B_eig;
+	auto result = linalg::matrix_prod(sparse, B);
+	ASSERT_EQ(num_vectors, result.num_rows);
+	ASSERT_EQ(B.num_cols, result.num_cols);
+	for (index_t i = 0; i < result.size(); ++i)
+		EXPECT_NEAR(expected.data()[i], result[i], 1E-12);
+
+	expected = A.transpose() * C_eig;
+	result = linalg::matrix_prod(sparse, C, true);
+	ASSERT_EQ(num_features, result.num_rows);
+	ASSERT_EQ(C.num_cols, result.num_cols);
+	for (index_t i = 0; i < result.size(); ++i)
+		EXPECT_NEAR(expected.data()[i], result[i], 1E-12);
+}
+
+TEST_F(LinalgSparseTest, gram_matrix)
+{
+	Map<MatrixXd> A(dense.matrix, num_vectors, num_features);
+	MatrixXd expected = A * A.transpose();
+
+	auto result = linalg::gram_matrix(sparse, sparse);
+	ASSERT_EQ(num_vectors, result.num_rows);
+	ASSERT_EQ(num_vectors, result.num_cols);
+	for (index_t i = 0; i < result.size(); ++i)
+		EXPECT_NEAR(expected.data()[i], result[i], 1E-12);
+}
+
+TEST_F(LinalgSparseTest, sparse_features)
+{
+	auto features = std::make_shared<SparseFeatures<float64_t>>(sparse);
+	auto compressed = std::make_shared<SparseFeatures<float64_t>>(sparse);
+	compressed->compress();
+
+	auto expected_prod = linalg::matrix_prod(sparse, x);
+	auto expected_gram = linalg::gram_matrix(sparse, sparse);
+	for (const auto& f : {features, compressed})
+	{
+		auto prod = linalg::matrix_prod(f, x);
+		for (index_t i = 0; i < prod.vlen; ++i)
+			EXPECT_NEAR(expected_prod[i], prod[i], 1E-12);
+
+		auto gram = linalg::gram_matrix(f, f);
+		for (index_t i = 0; i < gram.size(); ++i)
+			EXPECT_NEAR(expected_gram[i], gram[i], 1E-12);
+	}
+
+	// subsets select rows
+	SGVector<index_t> subset(3);
+	subset[0] = 5;
+	subset[1] = 0;
+	subset[2] = 5;
+	compressed->add_subset(subset);
+	auto prod = linalg::matrix_prod(compressed, B);
+	ASSERT_EQ(subset.vlen, prod.num_rows);
+	auto expected = linalg::matrix_prod(sparse, B);
+	for (index_t i = 0; i < subset.vlen; ++i)
+	{
+		for (index_t j = 0; j < B.num_cols; ++j)
+			EXPECT_NEAR(expected(subset[i], j), prod(i, j), 1E-12);
+	}
+}
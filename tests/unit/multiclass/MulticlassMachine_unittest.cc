@@ -0,0 +1,155 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+#include <shogun/base/ShogunEnv.h>
+#include <shogun/classifier/svm/LibLinear.h>
+#include <shogun/classifier/svm/LibSVM.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/labels/MulticlassLabels.h>
+#include <shogun/machine/KernelMulticlassMachine.h>
+#include <shogun/machine/LinearMulticlassMachine.h>
+#include <shogun/mathematics/NormalDistribution.h>
+#include <shogun/multiclass/MulticlassOneVsOneStrategy.h>
+#include <shogun/multiclass/MulticlassOneVsRestStrategy.h>
+#include <shogun/multiclass/ecoc/ECOCEDDecoder.h>
+#include <shogun/multiclass/ecoc/ECOCOVREncoder.h>
+#include <shogun/multiclass/ecoc/ECOCStrategy.h>
+
+using namespace shogun;
+
+class MulticlassMachineTest : public ::testing::Test
+{
+protected:
+	const index_t num_vec = 60;
+	const index_t num_class = 4;
+	const float64_t distance = 10;
+
+	/** linearly separable data, one class per feature */
+	void SetUp() override
+	{
+		std::mt19937_64 prng(100);
+		NormalDistribution<float64_t> normal_dist;
+		SGMatrix<float64_t> matrix(num_class, num_vec);
+		auto labels = std::make_shared<MulticlassLabels>(num_vec);
+		for (index_t i = 0; i < num_vec; ++i)
+		{
+			index_t label = i % num_class;
+			for (index_t j = 0; j < num_class; ++j)
+				matrix(j, i) = normal_dist(prng);
+			matrix(label, i) += distance;
+			labels->set_label(i, label);
+		}
+		features = std::make_shared<DenseFeatures<float64_t>>(matrix);
+		train_labels = labels;
+	}
+
+	std::shared_ptr<DenseFeatures<float64_t>> features;
+	std::shared_ptr<MulticlassLabels> train_labels;
+};
+
+TEST_F(MulticlassMachineTest, linear_parallel_training_equals_serial)
+{
+	for (auto strategy : std::vector<std::shared_ptr<MulticlassStrategy>>{
+	         std::make_shared<MulticlassOneVsRestStrategy>(),
+	         std::make_shared<MulticlassOneVsOneStrategy>()})
+	{
+		auto svm = std::make_shared<LibLinear>();
+		svm->put("seed", 1);
+		auto machine = std::make_shared<LinearMulticlassMachine>(
+		    strategy, features, svm, train_labels);
+
+		machine->train();
+		auto serial = machine->apply_multiclass(features);
+		EXPECT_EQ(strategy->get_num_machines(), machine->get_num_machines());
+
+		machine->set_parallel_training(true);
+		machine->train();
+		auto parallel = machine->apply_multiclass(features);
+		EXPECT_EQ(strategy->get_num_machines(), machine->get_num_machines());
+
+		for (index_t i = 0; i < num_vec; ++i)
+		{
+			EXPECT_EQ(train_labels->get_label(i), parallel->get_label(i));
+			EXPECT_EQ(serial->get_label(i), parallel->get_label(i));
+		}
+		// base machine keeps the full features
+		EXPECT_EQ(features, svm->get_features());
+	}
+}
+
+TEST_F(MulticlassMachineTest, kernel_one_vs_one_parallel_training)
+{
+	auto kernel = std::make_shared<GaussianKernel>(10.0);
+	auto svm = std::make_shared<LibSVM>();
+	auto machine = std::make_shared<KernelMulticlassMachine>(
+	    std::make_shared<MulticlassOneVsOneStrategy>(), kernel, svm,
+	    train_labels);
+	machine->set_parallel_training(true);
+	machine->train(features);
+
+	// support vectors index the full training data
+	for (index_t m = 0; m < machine->get_num_machines(); ++m)
+	{
+		auto sub = machine->get_machine(m)->as<KernelMachine>();
+		EXPECT_EQ(kernel, sub->get_kernel());
+		EXPECT_GT(sub->get_num_support_vectors(), 0);
+		for (index_t j = 0; j < sub->get_num_support_vectors(); ++j)
+		{
+			auto sv = sub->get_support_vector(j);
+			EXPECT_GE(sv, 0);
+			EXPECT_LT(sv, num_vec);
+		}
+	}
+
+	auto result = machine->apply_multiclass(features);
+	for (index_t i = 0; i < num_vec; ++i)
+		EXPECT_EQ(train_labels->get_label(i), result->get_label(i));
+	EXPECT_EQ(features, kernel->get_lhs());
+}
+
+TEST_F(MulticlassMachineTest, linear_batched_outputs)
+{
+	auto strategy = std::make_shared<ECOCStrategy>(
+	    std::make_shared<ECOCOVREncoder>(), std::make_shared<ECOCEDDecoder>());
+	auto machine = std::make_shared<LinearMulticlassMachine>(
+	    strategy, features, std::make_shared<LibLinear>(), train_labels);
+	machine->train();
+
+	auto result = machine->apply_multiclass(features);
+	auto outputs = machine->get_submachine_outputs_matrix(num_vec);
+	ASSERT_EQ(machine->get_num_machines(), outputs.num_rows);
+	ASSERT_EQ(num_vec, outputs.num_cols);
+	for (index_t m = 0; m < outputs.num_rows; ++m)
+	{
+		auto values = machine->get_submachine_outputs(m)->get_values();
+		for (index_t i = 0; i < num_vec; ++i)
+			EXPECT_NEAR(values[i], outputs(m, i), 1e-10);
+	}
+	for (index_t i = 0; i < num_vec; ++i)
+		EXPECT_EQ(train_labels->get_label(i), result->get_label(i));
+}
+
+TEST_F(MulticlassMachineTest, kernel_batched_outputs)
+{
+	auto kernel = std::make_shared<GaussianKernel>(10.0);
+	auto machine = std::make_shared<KernelMulticlassMachine>(
+	    std::make_shared<MulticlassOneVsRestStrategy>(), kernel,
+	    std::make_shared<LibSVM>(), train_labels);
+	machine->train(features);
+
+	auto result = machine->apply_multiclass(features);
+	auto outputs = machine->get_submachine_outputs_matrix(num_vec);
+	ASSERT_EQ(num_class, outputs.num_rows);
+	ASSERT_EQ(num_vec, outputs.num_cols);
+	for (index_t m = 0; m < outputs.num_rows; ++m)
+	{
+		auto values = machine->get_submachine_outputs(m)->get_values();
+		for (index_t i = 0; i < num_vec; ++i)
+			EXPECT_NEAR(values[i], outputs(m, i), 1e-10);
+	}
+	for (index_t i = 0; i < num_vec; ++i)
+		EXPECT_EQ(train_labels->get_label(i), result->get_label(i));
+}
@@ -1,9 +1,13 @@
 #include <shogun/multiclass/MulticlassOneVsOneStrategy.h>
 #include <shogun/multiclass/MulticlassOneVsRestStrategy.h>
+#include <shogun/multiclass/ecoc/ECOCEDDecoder.h>
+#include <shogun/multiclass/ecoc/ECOCHDDecoder.h>
 #include <shogun/labels/BinaryLabels.h>
 #include <shogun/labels/MulticlassLabels.h>
 #include <gtest/gtest.h>
 
+#include <random>
+
 using namespace shogun;
 
 TEST(MulticlassStrategy,rescale_ova_norm)
@@ -128,3 +132,33 @@ TEST(MulticlassStrategy,rescale_ova_hamamura)
 	EXPECT_NEAR(scores[1],0.3333333333333333,1E-5);
 	EXPECT_NEAR(scores[2],0.3333333333333333,1E-5);
 }
+
+TEST(MulticlassStrategy,ecoc_decide_labels)
+{
+	const int32_t num_machines=7;
+	const int32_t num_classes=5;
+	const int32_t num_vectors=50;
+
+	std::mt19937_64 prng(17);
+	std::uniform_int_distribution<int32_t> code(-1, 1);
+	std::uniform_real_distribution<float64_t> output(-2, 2);
+
+	SGMatrix<int32_t> codebook(num_machines, num_classes);
+	for (int32_t i=0; i<codebook.num_rows*codebook.num_cols; i++)
+		codebook.matrix[i] = code(prng);
+	SGMatrix<float64_t> outputs(num_machines, num_vectors);
+	for (int32_t i=0; i<outputs.num_rows*outputs.num_cols; i++)
+		outputs.matrix[i] = output(prng);
+
+	ECOCEDDecoder ed;
+	ECOCHDDecoder hd;
+	auto ed_labels = ed.decide_labels(outputs, codebook);
+	auto hd_labels = hd.decide_labels(outputs, codebook);
+	ASSERT_EQ(num_vectors, ed_labels.vlen);
+	ASSERT_EQ(num_vectors, hd_labels.vlen);
+	for (int32_t i=0; i<num_vectors; i++)
+	{
+		EXPECT_EQ(ed.decide_label(outputs.get_column(i), codebook), ed_labels[i]);
+		EXPECT_EQ(hd.decide_label(outputs.get_column(i), codebook), hd_labels[i]);
+	}
+}
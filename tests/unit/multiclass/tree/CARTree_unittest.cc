@@ -30,7 +30,9 @@
 
 #include <gtest/gtest.h>
 #include <shogun/features/DenseFeatures.h>
+#include <shogun/base/ShogunEnv.h>
 #include <shogun/lib/SGMatrix.h>
+#include <shogun/mathematics/NormalDistribution.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 #include <shogun/multiclass/tree/CARTree.h>
 
@@ -665,3 +667,47 @@ TEST(CARTree,cv_prune_simple)
 
 
 }
+
+TEST(CARTree, parallel_training_equals_serial)
+{
+	std::mt19937_64 prng(57);
+	NormalDistribution<float64_t> gaussian;
+
+	// one nominal and three continuous features, some values missing
+	const index_t num_vecs = 400;
+	SGMatrix<float64_t> data(4, num_vecs);
+	SGVector<float64_t> lab(num_vecs);
+	for (index_t i = 0; i < num_vecs; ++i)
+	{
+		lab[i] = i % 3;
+		data(0, i) = (i / 3) % 4;
+		for (index_t j = 1; j < data.num_rows; ++j)
+			data(j, i) = gaussian(prng) + lab[i] * j * 0.3;
+		if (i % 17 == 0)
+			data(2, i) = CARTree::MISSING;
+	}
+	SGVector<bool> ft(4);
+	ft.set_const(false);
+	ft[0] = true;
+
+	auto feats = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto labels = std::make_shared<MulticlassLabels>(lab);
+
+	auto num_threads = env()->get_num_threads();
+	env()->set_num_threads(4);
+	SGVector<float64_t> result[2];
+	for (auto parallel : {false, true})
+	{
+		auto c = std::make_shared<CARTree>();
+		c->set_labels(labels);
+		c->set_feature_types(ft);
+		c->set_min_parallel_node_size(parallel ? 10 : 0);
+		c->train(feats);
+		result[parallel] =
+		    c->apply(feats)->as<MulticlassLabels>()->get_labels();
+	}
+	env()->set_num_threads(num_threads);
+
+	for (index_t i = 0; i < num_vecs; ++i)
+		EXPECT_EQ(result[0][i], result[1][i]);
+}
@@ -40,6 +40,7 @@
 #include <stdio.h>
 
 #include <random>
+#include <set>
 
 using namespace shogun;
 
@@ -116,6 +117,41 @@ TEST_F(RandomForestTest, classify_nominal_test)
 	EXPECT_NEAR(0.7142857,c->get<float64_t>(RandomForest::kOobError),1e-6);
 }
 
+TEST_F(RandomForestTest, bags_are_seeded_independent_of_threads)
+{
+	int32_t seed = 2343;
+	auto train = [&](int32_t num_threads) {
+		auto c = std::make_shared<RandomForest>(
+		    weather_features_train, weather_labels_train, 20, 2);
+		c->set_feature_types(weather_ft);
+		c->set_combination_rule(std::make_shared<MajorityVote>());
+		env()->set_num_threads(num_threads);
+		c->put("seed", seed);
+		c->train(weather_features_train);
+		return c;
+	};
+
+	auto reference = train(1);
+	auto bags = reference->get<std::vector<std::shared_ptr<Machine>>>(
+	    RandomForest::kBags);
+	std::set<int32_t> seeds;
+	for (const auto& bag : bags)
+		seeds.insert(bag->get<int32_t>(random::kSeed));
+	EXPECT_EQ(bags.size(), seeds.size());
+
+	auto expected = reference->apply_multiclass(weather_features_test);
+	auto result = train(4)->apply_multiclass(weather_features_test);
+	for (auto i : range(expected->get_num_labels()))
+	{
+		EXPECT_EQ(expected->get_label(i), result->get_label(i));
+		auto expected_confidences = expected->get_multiclass_confidences(i);
+		auto confidences = result->get_multiclass_confidences(i);
+		for (auto j : range(confidences.vlen))
+			EXPECT_EQ(expected_confidences[j], confidences[j]);
+	}
+	env()->set_num_threads(1);
+}
+
 TEST_F(RandomForestTest, classify_non_nominal_test)
 {
 	int32_t seed = 2343;
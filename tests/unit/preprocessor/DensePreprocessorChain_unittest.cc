@@ -0,0 +1,68 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+#include <shogun/lib/exception/NotFittedException.h>
+#include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/preprocessor/DensePreprocessorChain.h>
+#include <shogun/preprocessor/LogPlusOne.h>
+#include <shogun/preprocessor/NormOne.h>
+#include <shogun/preprocessor/PNorm.h>
+#include <shogun/preprocessor/PruneVarSubMean.h>
+#include <shogun/preprocessor/RescaleFeatures.h>
+#include <shogun/preprocessor/SumOne.h>
+
+#include <random>
+
+using namespace shogun;
+
+static std::vector<std::shared_ptr<DensePreprocessor<float64_t>>> create_preprocessors()
+{
+	return {std::make_shared<PruneVarSubMean>(), std::make_shared<RescaleFeatures>(),
+	        std::make_shared<LogPlusOne>(), std::make_shared<SumOne>(),
+	        std::make_shared<PNorm>(3.0), std::make_shared<NormOne>()};
+}
+
+TEST(DensePreprocessorChain, equals_sequential)
+{
+	const index_t num_features = 6;
+	const index_t num_vectors = 101;
+	SGMatrix<float64_t> data(num_features, num_vectors);
+	std::mt19937_64 prng(57);
+	random::fill_array(data, -10.0, 10.0, prng);
+	// constant feature, which is pruned
+	for (auto i : range(num_vectors))
+		data(2, i) = 1.0;
+	auto original = data.clone();
+
+	DensePreprocessorChain<float64_t> chain(create_preprocessors());
+	chain.fit(data);
+	auto fused = chain.transform(data);
+	EXPECT_TRUE(data.equals(original));
+
+	std::shared_ptr<Features> features =
+	    std::make_shared<DenseFeatures<float64_t>>(data.clone());
+	for (const auto& preprocessor : create_preprocessors())
+	{
+		preprocessor->fit(features);
+		features = preprocessor->transform(features);
+	}
+	auto sequential = features->as<DenseFeatures<float64_t>>()->get_feature_matrix();
+
+	ASSERT_EQ(num_features - 1, fused.num_rows);
+	ASSERT_EQ(sequential.num_rows, fused.num_rows);
+	ASSERT_EQ(sequential.num_cols, fused.num_cols);
+	for (auto i : range(sequential.num_cols))
+	{
+		for (auto j : range(sequential.num_rows))
+			EXPECT_NEAR(sequential(j, i), fused(j, i), 1e-12);
+	}
+}
+
+TEST(DensePreprocessorChain, not_fitted)
+{
+	auto preprocessor = std::make_shared<PruneVarSubMean>();
+	DensePreprocessorChain<float64_t> chain({preprocessor});
+	EXPECT_THROW(chain.transform(SGMatrix<float64_t>(2, 2)), NotFittedException);
+}
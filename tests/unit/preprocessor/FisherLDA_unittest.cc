@@ -287,3 +287,68 @@ TEST_F(FLDATest, CANVAR_FLDA_for_D_greater_than_N )
 
 
 }
+
+TEST_F(FLDATest, CLASSIC_FLDA_partial_fit)
+{
+	FisherLDA fisherlda(1, CLASSIC_FLDA);
+	fisherlda.fit(dense_feat, labels);
+	auto y = fisherlda.transform(dense_feat, false)
+	             ->as<DenseFeatures<float64_t>>()
+	             ->get_feature_matrix();
+
+	// the first batch contains a single class only
+	FisherLDA fisherlda_inc(1, CLASSIC_FLDA);
+	auto data = dense_feat->get_feature_matrix();
+	auto label_vector = labels->get_labels();
+	for (index_t i = 0; i < data.num_cols; i += 4)
+		fisherlda_inc.partial_fit(
+		    std::make_shared<DenseFeatures<float64_t>>(data.slice(i, i + 4)),
+		    std::make_shared<MulticlassLabels>(
+		        label_vector.slice(i, i + 4)));
+	auto y_inc = fisherlda_inc.transform(dense_feat, false)
+	                 ->as<DenseFeatures<float64_t>>()
+	                 ->get_feature_matrix();
+
+	ASSERT_EQ(y.num_rows, y_inc.num_rows);
+	for (index_t i = 0; i < y.num_cols; ++i)
+		EXPECT_NEAR(std::abs(y(0, i)), std::abs(y_inc(0, i)), 1e-9);
+}
+
+TEST_F(FLDATest, CLASSIC_FLDA_regularized_partial_fit)
+{
+	// both regularize the within class covariance once, after it has
+	// been summed over all classes
+	const float64_t gamma = 0.1;
+	FisherLDA fisherlda(1, CLASSIC_FLDA, 0.01, gamma);
+	fisherlda.fit(dense_feat, labels);
+	auto y = fisherlda.transform(dense_feat, false)
+	             ->as<DenseFeatures<float64_t>>()
+	             ->get_feature_matrix();
+
+	FisherLDA fisherlda_inc(1, CLASSIC_FLDA, 0.01, gamma);
+	auto data = dense_feat->get_feature_matrix();
+	auto label_vector = labels->get_labels();
+	for (index_t i = 0; i < data.num_cols; i += 4)
+		fisherlda_inc.partial_fit(
+		    std::make_shared<DenseFeatures<float64_t>>(data.slice(i, i + 4)),
+		    std::make_shared<MulticlassLabels>(
+		        label_vector.slice(i, i + 4)));
+	auto y_inc = fisherlda_inc.transform(dense_feat, false)
+	                 ->as<DenseFeatures<float64_t>>()
+	                 ->get_feature_matrix();
+
+	FisherLDA unregularized(1, CLASSIC_FLDA);
+	unregularized.fit(dense_feat, labels);
+	auto y_unregularized = unregularized.transform(dense_feat, false)
+	                           ->as<DenseFeatures<float64_t>>()
+	                           ->get_feature_matrix();
+
+	ASSERT_EQ(y.num_rows, y_inc.num_rows);
+	float64_t difference = 0;
+	for (index_t i = 0; i < y.num_cols; ++i)
+	{
+		EXPECT_NEAR(std::abs(y(0, i)), std::abs(y_inc(0, i)), 1e-9);
+		difference += std::abs(std::abs(y(0, i)) - std::abs(y_unregularized(0, i)));
+	}
+	EXPECT_GT(difference, 1e-6);
+}
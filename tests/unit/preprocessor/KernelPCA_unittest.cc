@@ -8,6 +8,8 @@
 #include <shogun/kernel/GaussianKernel.h>
 #include <shogun/lib/SGMatrix.h>
 
+#include <cmath>
+
 
 using ::testing::Test;
 using namespace shogun;
@@ -101,3 +103,66 @@ TEST(KernelPCA, apply_to_feature_vector)
 
 
 }
+
+TEST(KernelPCA, transform_randomized)
+{
+	// three tight clusters of different sizes, far apart: the centered
+	// kernel matrix has two large eigenvalues and all others close to zero,
+	// so the randomized range finder recovers the leading subspace
+	const index_t cluster_sizes[] = {30, 20, 10};
+	const float64_t centers[][3] = {{0, 0, 0}, {10, 0, 0}, {0, 10, 0}};
+	const index_t num_train_vectors = 60;
+	const index_t num_test_vectors = 4;
+
+	SGMatrix<float64_t> train_matrix(num_features, num_train_vectors);
+	for (index_t c = 0, i = 0; c < 3; ++c)
+	{
+		for (index_t j = 0; j < cluster_sizes[c]; ++j, ++i)
+		{
+			train_matrix(0, i) = centers[c][0] + 0.01 * std::sin(i);
+			train_matrix(1, i) = centers[c][1] + 0.01 * std::cos(i);
+			train_matrix(2, i) = centers[c][2] + 0.01 * std::sin(2 * i);
+		}
+	}
+	SGMatrix<float64_t> test_matrix(num_features, num_test_vectors);
+	const float64_t test_points[] = {0.005, 0,     0,     10, 0.005, 0,
+	                                 0,     9.995, 0.005, 5,  5,     0};
+	for (auto i = 0; i < test_matrix.size(); ++i)
+		test_matrix[i] = test_points[i];
+
+	auto train_feats =
+	    std::make_shared<DenseFeatures<float64_t>>(train_matrix);
+	auto test_feats =
+	    std::make_shared<DenseFeatures<float64_t>>(test_matrix);
+
+	auto kernel = std::make_shared<GaussianKernel>();
+	kernel->set_width(1);
+
+	auto kpca = std::make_shared<KernelPCA>(kernel);
+	kpca->set_target_dim(target_dim);
+	ASSERT_GT(
+	    num_train_vectors,
+	    target_dim + kpca->get<int32_t>("oversampling"));
+	kpca->fit(train_feats);
+	SGMatrix<float64_t> expected = kpca->transform(test_feats)
+	                                   ->as<DenseFeatures<float64_t>>()
+	                                   ->get_feature_matrix();
+
+	kpca->put("method", RANDOMIZED);
+	kpca->put(random::kSeed, 17);
+	kpca->fit(train_feats);
+	SGMatrix<float64_t> embedding = kpca->transform(test_feats)
+	                                    ->as<DenseFeatures<float64_t>>()
+	                                    ->get_feature_matrix();
+
+	// each component may come out with the opposite sign
+	for (index_t d = 0; d < target_dim; ++d)
+	{
+		float64_t dot = 0;
+		for (index_t i = 0; i < num_test_vectors; ++i)
+			dot += embedding(d, i) * expected(d, i);
+		float64_t sign = dot < 0 ? -1 : 1;
+		for (index_t i = 0; i < num_test_vectors; ++i)
+			EXPECT_NEAR(sign * embedding(d, i), expected(d, i), 1E-6);
+	}
+}
@@ -0,0 +1,132 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+#include <gtest/gtest.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/mathematics/NormalDistribution.h>
+#include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/mathematics/linalg/LinalgNamespace.h>
+#include <shogun/preprocessor/NystromPreprocessor.h>
+
+#include <random>
+#include <set>
+
+using namespace shogun;
+
+class NystromPreprocessorTest : public ::testing::TestWithParam<ENystromSampling>
+{
+protected:
+	void SetUp() override
+	{
+		std::mt19937_64 prng(57);
+		SGMatrix<float64_t> data(num_features, num_vectors);
+		random::fill_array(data, NormalDistribution<float64_t>(), prng);
+		features = std::make_shared<DenseFeatures<float64_t>>(data);
+
+		kernel = std::make_shared<GaussianKernel>(2.0);
+		kernel->init(features, features);
+		kernel_matrix = kernel->get_kernel_matrix();
+		kernel->cleanup();
+	}
+
+	const index_t num_features = 3;
+	const index_t num_vectors = 30;
+	std::shared_ptr<DenseFeatures<float64_t>> features;
+	std::shared_ptr<GaussianKernel> kernel;
+	SGMatrix<float64_t> kernel_matrix;
+};
+
+TEST_P(NystromPreprocessorTest, all_landmarks_exact)
+{
+	auto nystrom =
+	    std::make_shared<NystromPreprocessor>(kernel, num_vectors);
+	nystrom->put("sampling", GetParam());
+	nystrom->put(random::kSeed, 3);
+	nystrom->fit(features);
+
+	auto mapped = nystrom->transform(features)
+	                  ->as<DenseFeatures<float64_t>>()
+	                  ->get_feature_matrix();
+	ASSERT_EQ(num_vectors, mapped.num_rows);
+	ASSERT_EQ(num_vectors, mapped.num_cols);
+
+	auto approx = linalg::matrix_prod(mapped, mapped, true, false);
+	for (index_t i = 0; i < kernel_matrix.size(); ++i)
+		EXPECT_NEAR(kernel_matrix[i], approx[i], 1E-8);
+}
+
+TEST_P(NystromPreprocessorTest, landmarks_unique_and_sorted)
+{
+	const index_t num_landmarks = 10;
+	auto nystrom =
+	    std::make_shared<NystromPreprocessor>(kernel, num_landmarks);
+	nystrom->put("sampling", GetParam());
+	nystrom->put("block_size", 7);
+	nystrom->put(random::kSeed, 11);
+	nystrom->fit(features);
+
+	auto landmarks = nystrom->get_landmark_indices();
+	ASSERT_EQ(num_landmarks, landmarks.vlen);
+	std::set<index_t> unique(landmarks.begin(), landmarks.end());
+	EXPECT_EQ(num_landmarks, (index_t)unique.size());
+	EXPECT_TRUE(std::is_sorted(landmarks.begin(), landmarks.end()));
+
+	// landmarks are reproduced exactly by the feature map
+	auto mapped = nystrom->transform(features)
+	                  ->as<DenseFeatures<float64_t>>()
+	                  ->get_feature_matrix();
+	ASSERT_EQ(num_landmarks, mapped.num_rows);
+	for (auto i : landmarks)
+	{
+		for (auto j : landmarks)
+		{
+			auto approx =
+			    linalg::dot(mapped.get_column(i), mapped.get_column(j));
+			EXPECT_NEAR(kernel_matrix(i, j), approx, 1E-8);
+		}
+	}
+}
+
+TEST_P(NystromPreprocessorTest, kernel_state_and_inplace)
+{
+	const index_t num_landmarks = 2;
+	auto other = std::make_shared<DenseFeatures<float64_t>>(
+	    features->get_feature_matrix().clone());
+	kernel->init(features, other);
+
+	auto nystrom =
+	    std::make_shared<NystromPreprocessor>(kernel, num_landmarks);
+	nystrom->put("sampling", GetParam());
+	nystrom->put("block_size", 7);
+	nystrom->put(random::kSeed, 5);
+	nystrom->fit(features);
+
+	auto data = features->get_feature_matrix().clone();
+	auto mapped = nystrom->transform(features, false)
+	                  ->as<DenseFeatures<float64_t>>()
+	                  ->get_feature_matrix();
+	EXPECT_TRUE(data.equals(features->get_feature_matrix()));
+
+	// the kernel keeps the features set by the caller
+	EXPECT_EQ(features, kernel->get_lhs());
+	EXPECT_EQ(other, kernel->get_rhs());
+	EXPECT_EQ(kernel_matrix(3, 4), kernel->kernel(3, 4));
+	kernel->cleanup();
+
+	// in-place mapping overwrites the feature matrix with the same result
+	auto inplace = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto mapped_inplace = nystrom->transform(inplace, true)
+	                          ->as<DenseFeatures<float64_t>>()
+	                          ->get_feature_matrix();
+	EXPECT_EQ(data.matrix, mapped_inplace.matrix);
+	ASSERT_EQ(num_landmarks, mapped_inplace.num_rows);
+	ASSERT_EQ(num_vectors, mapped_inplace.num_cols);
+	for (index_t i = 0; i < num_landmarks * num_vectors; ++i)
+		EXPECT_NEAR(mapped.matrix[i], mapped_inplace.matrix[i], 1E-12);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    NystromSampling, NystromPreprocessorTest,
+    ::testing::Values(NS_UNIFORM, NS_KMEANS_PLUSPLUS, NS_LEVERAGE_SCORE));
@@ -9,6 +9,8 @@
 #include <shogun/features/DenseFeatures.h>
 #include <shogun/lib/SGMatrix.h>
 #include <shogun/lib/SGVector.h>
+#include <shogun/mathematics/NormalDistribution.h>
+#include <shogun/mathematics/RandomNamespace.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 
 #include <shogun/preprocessor/PCA.h>
@@ -603,3 +605,108 @@ TEST(PCA, PCA_WHITEN_EVD)
 	EXPECT_NEAR(0.0,covariance_mat(2,1),epsilon);
 	EXPECT_NEAR(1.0,covariance_mat(2,2),epsilon);
 }
+
+TEST(PCA, PCA_RANDOMIZED_SVD)
+{
+	const index_t num_features = 60;
+	const index_t num_vectors = 200;
+	const index_t target_dim = 3;
+	const index_t oversampling = 10;
+
+	// three dominant directions on top of small isotropic noise, the random
+	// projection of rank target_dim+oversampling is far below num_features
+	std::mt19937_64 prng(12);
+	SGMatrix<float64_t> data(num_features, num_vectors);
+	random::fill_array(data, NormalDistribution<float64_t>(0, 0.1), prng);
+	const float64_t scales[] = {100.0, 60.0, 30.0};
+	for (index_t j = 0; j < num_vectors; ++j)
+		for (index_t i = 0; i < target_dim; ++i)
+			data(i, j) *= scales[i];
+
+	auto features = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto pca_svd = std::make_shared<PCA>(SVD);
+	pca_svd->set_target_dim(target_dim);
+	pca_svd->fit(features);
+
+	auto pca_rnd = std::make_shared<PCA>(RANDOMIZED);
+	pca_rnd->set_target_dim(target_dim);
+	pca_rnd->put("oversampling", oversampling);
+	pca_rnd->put(random::kSeed, 7);
+	pca_rnd->fit(features);
+	ASSERT_LT(target_dim + oversampling, num_features);
+
+	auto eig_svd = pca_svd->get_eigenvalues();
+	auto eig_rnd = pca_rnd->get_eigenvalues();
+	ASSERT_EQ(target_dim, eig_rnd.vlen);
+	for (index_t i = 0; i < target_dim; ++i)
+		EXPECT_NEAR(eig_svd[i], eig_rnd[i], 1E-6 * eig_svd[i]);
+
+	auto trans_svd = pca_svd->get_transformation_matrix();
+	auto trans_rnd = pca_rnd->get_transformation_matrix();
+	for (index_t i = 0; i < target_dim; ++i)
+		check_eigenvector_eq(
+		    trans_svd.get_column(i), trans_rnd.get_column(i), 1E-6);
+}
+
+TEST(PCA, PCA_partial_fit)
+{
+	const index_t num_features = 4;
+	const index_t num_vectors = 40;
+	const index_t batch_size = 10;
+
+	std::mt19937_64 prng(3);
+	SGMatrix<float64_t> data(num_features, num_vectors);
+	random::fill_array(data, NormalDistribution<float64_t>(), prng);
+
+	auto features = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto pca = std::make_shared<PCA>(SVD);
+	pca->set_target_dim(num_features);
+	pca->fit(features);
+
+	auto pca_inc = std::make_shared<PCA>(SVD);
+	pca_inc->set_target_dim(num_features);
+	for (index_t i = 0; i < num_vectors; i += batch_size)
+		pca_inc->partial_fit(std::make_shared<DenseFeatures<float64_t>>(
+		    data.slice(i, i + batch_size)));
+
+	// without truncation the incremental update is exact
+	auto mean = pca->get_mean();
+	auto mean_inc = pca_inc->get_mean();
+	for (index_t i = 0; i < num_features; ++i)
+		EXPECT_NEAR(mean[i], mean_inc[i], 1E-12);
+
+	auto eig = pca->get_eigenvalues();
+	auto eig_inc = pca_inc->get_eigenvalues();
+	for (index_t i = 0; i < num_features; ++i)
+		EXPECT_NEAR(eig[i], eig_inc[i], 1E-10);
+
+	auto trans = pca->get_transformation_matrix();
+	auto trans_inc = pca_inc->get_transformation_matrix();
+	for (index_t i = 0; i < num_features; ++i)
+		check_eigenvector_eq(trans.get_column(i), trans_inc.get_column(i));
+}
+
+TEST(PCA, PCA_fit_streaming)
+{
+	const index_t num_features = 3;
+	const index_t num_vectors = 25;
+
+	std::mt19937_64 prng(5);
+	SGMatrix<float64_t> data(num_features, num_vectors);
+	random::fill_array(data, NormalDistribution<float64_t>(), prng);
+
+	auto features = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto pca = std::make_shared<PCA>(SVD);
+	pca->set_target_dim(num_features);
+	pca->fit(features);
+
+	auto pca_stream = std::make_shared<PCA>(SVD);
+	pca_stream->set_target_dim(num_features);
+	pca_stream->fit_streaming(
+	    std::make_shared<StreamingDenseFeatures<float64_t>>(features), 7);
+
+	auto eig = pca->get_eigenvalues();
+	auto eig_stream = pca_stream->get_eigenvalues();
+	for (index_t i = 0; i < num_features; ++i)
+		EXPECT_NEAR(eig[i], eig_stream[i], 1E-10);
+}
@@ -0,0 +1,81 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+#include <shogun/features/streaming/StreamingDenseFeatures.h>
+#include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/preprocessor/PruneVarSubMean.h>
+
+#include <random>
+
+using namespace shogun;
+
+TEST(PruneVarSubMean, transform)
+{
+	const index_t num_features = 3;
+	const index_t num_vectors = 50;
+	SGMatrix<float64_t> data(num_features, num_vectors);
+	std::mt19937_64 prng(12);
+	random::fill_array(data, -1.0, 1.0, prng);
+	for (auto i : range(num_vectors))
+	{
+		data(1, i) = 5.0;
+		data(2, i) *= 100.0;
+	}
+
+	auto features = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto preprocessor = std::make_shared<PruneVarSubMean>();
+	preprocessor->fit(features);
+	auto result = preprocessor->transform(features)
+	                  ->as<DenseFeatures<float64_t>>()
+	                  ->get_feature_matrix();
+
+	// the constant feature is removed, the others are standardized
+	ASSERT_EQ(2, result.num_rows);
+	for (auto j : range(result.num_rows))
+	{
+		float64_t mean = 0, var = 0;
+		for (auto i : range(num_vectors))
+			mean += result(j, i) / num_vectors;
+		for (auto i : range(num_vectors))
+			var += (result(j, i) - mean) * (result(j, i) - mean) / num_vectors;
+		EXPECT_NEAR(0.0, mean, 1e-12);
+		EXPECT_NEAR(1.0, var, 1e-12);
+	}
+}
+
+TEST(PruneVarSubMean, partial_fit)
+{
+	const index_t num_features = 3;
+	const index_t num_vectors = 50;
+	SGMatrix<float64_t> data(num_features, num_vectors);
+	std::mt19937_64 prng(13);
+	random::fill_array(data, -1.0, 1.0, prng);
+	for (auto i : range(num_vectors))
+	{
+		data(0, i) += 1e6;
+		data(1, i) = 5.0;
+	}
+
+	auto features = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto preprocessor = std::make_shared<PruneVarSubMean>();
+	preprocessor->fit(features);
+	auto result = preprocessor->transform(features, false)
+	                  ->as<DenseFeatures<float64_t>>()
+	                  ->get_feature_matrix();
+
+	auto streaming = std::make_shared<PruneVarSubMean>();
+	streaming->fit_streaming(
+	    std::make_shared<StreamingDenseFeatures<float64_t>>(features), 7);
+	auto streamed = streaming->transform(features, false)
+	                    ->as<DenseFeatures<float64_t>>()
+	                    ->get_feature_matrix();
+
+	ASSERT_EQ(2, streamed.num_rows);
+	for (auto i : range(num_vectors))
+	{
+		for (auto j : range(streamed.num_rows))
+			EXPECT_NEAR(result(j, i), streamed(j, i), 1e-9);
+	}
+}
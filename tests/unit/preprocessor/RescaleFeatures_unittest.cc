@@ -51,3 +51,29 @@ TEST(RescaleFeatures, transform)
 
 
 }
+
+TEST(RescaleFeatures, partial_fit)
+{
+	index_t num_features = 3;
+	index_t num_vectors = 20;
+	SGMatrix<float64_t> m(num_features, num_vectors);
+	std::mt19937_64 prng(5);
+	random::fill_array(m, -1024, 1024, prng);
+	auto feats = std::make_shared<DenseFeatures<float64_t>>(m);
+
+	auto rescaler = std::make_shared<RescaleFeatures>();
+	rescaler->fit(feats);
+	auto result = rescaler->transform(feats, false)
+	                  ->as<DenseFeatures<float64_t>>()
+	                  ->get_feature_matrix();
+
+	auto rescaler_inc = std::make_shared<RescaleFeatures>();
+	for (index_t i = 0; i < num_vectors; i += 5)
+		rescaler_inc->partial_fit(
+		    std::make_shared<DenseFeatures<float64_t>>(m.slice(i, i + 5)));
+	auto result_inc = rescaler_inc->transform(feats, false)
+	                      ->as<DenseFeatures<float64_t>>()
+	                      ->get_feature_matrix();
+
+	EXPECT_TRUE(result.equals(result_inc));
+}
@@ -0,0 +1,53 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+#include <shogun/lib/common.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/statistical_testing/internals/ComputationManager.h>
+
+#include <stdexcept>
+
+using namespace shogun;
+using namespace internal;
+
+TEST(ComputationManager, task_parallel_equals_data_parallel)
+{
+	const index_t num_data=3;
+	const index_t num_jobs=8;
+
+	ComputationManager cm;
+	cm.num_data(num_data);
+	for (index_t i=0; i<num_data; ++i)
+	{
+		cm.data(i)=SGMatrix<float32_t>(2, 2);
+		cm.data(i).set_const(i+1);
+	}
+	for (index_t j=0; j<num_jobs; ++j)
+		cm.enqueue_job([j](SGMatrix<float32_t> m) { return j*m(0, 0)+m(1, 1); });
+
+	cm.use_cpu().compute_task_parallel_jobs();
+	for (index_t j=0; j<num_jobs; ++j)
+	{
+		for (index_t i=0; i<num_data; ++i)
+			EXPECT_EQ((j+1)*(i+1), cm.result(j)[i]);
+	}
+}
+
+TEST(ComputationManager, task_parallel_rethrows)
+{
+	ComputationManager cm;
+	cm.num_data(1);
+	cm.data(0)=SGMatrix<float32_t>(1, 1);
+	for (index_t j=0; j<4; ++j)
+	{
+		cm.enqueue_job([j](SGMatrix<float32_t> m) -> float32_t {
+			if (j==2)
+				throw std::runtime_error("job failed");
+			return j;
+		});
+	}
+
+	EXPECT_THROW(cm.use_cpu().compute_task_parallel_jobs(), std::runtime_error);
+}
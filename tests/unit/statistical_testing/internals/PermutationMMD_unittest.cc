@@ -40,6 +40,7 @@
 #include <shogun/kernel/Kernel.h>
 #include <shogun/kernel/GaussianKernel.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/NormalDistribution.h>
 #include <shogun/mathematics/RandomNamespace.h>
 #include <shogun/mathematics/eigen3.h>
 #include <shogun/statistical_testing/MMD.h>
@@ -546,3 +547,102 @@ TEST(PermutationMMD, unbiased_incomplete_multi_kernel)
 		kernel->remove_lhs_and_rhs();
 	}
 }
+
+TEST(PermutationMMD, block_size)
+{
+	const index_t seed=12345;
+	const index_t dim=2;
+	const index_t n=13;
+	const index_t m=7;
+	const index_t num_null_samples=11;
+	const auto stype=ST_UNBIASED_FULL;
+
+	std::mt19937_64 prng(seed);
+
+	SGMatrix<float64_t> data(dim, n+m);
+	random::fill_array(data, NormalDistribution<float64_t>(), prng);
+	auto feats=std::make_shared<DenseFeatures<float64_t>>(data);
+
+	auto kernel=std::make_shared<GaussianKernel>();
+	kernel->set_width(2.0);
+	kernel->init(feats, feats);
+	auto kernel_matrix=kernel->get_kernel_matrix<float32_t>();
+
+	auto permutation_mmd=internal::mmd::PermutationMMD();
+	permutation_mmd.m_n_x=n;
+	permutation_mmd.m_n_y=m;
+	permutation_mmd.m_stype=stype;
+	permutation_mmd.m_num_null_samples=num_null_samples;
+
+	prng.seed(seed);
+	SGVector<float32_t> result_1=permutation_mmd(kernel_matrix, prng);
+
+	// blocks that do not divide the number of null samples
+	permutation_mmd.m_block_size=4;
+	prng.seed(seed);
+	SGVector<float32_t> result_2=permutation_mmd(kernel_matrix, prng);
+
+	permutation_mmd.m_block_size=1;
+	prng.seed(seed);
+	SGVector<float32_t> result_3=permutation_mmd(kernel_matrix, prng);
+
+	for (auto i=0; i<num_null_samples; ++i)
+	{
+		EXPECT_NEAR(result_1[i], result_2[i], 1E-6);
+		EXPECT_NEAR(result_1[i], result_3[i], 1E-6);
+	}
+}
+
+TEST(PermutationMMD, early_stopping)
+{
+	const index_t seed=12345;
+	const index_t dim=2;
+	const index_t n=10;
+	const index_t num_null_samples=50;
+	const auto stype=ST_UNBIASED_FULL;
+
+	std::mt19937_64 prng(seed);
+
+	SGMatrix<float64_t> data(dim, 2*n);
+	random::fill_array(data, NormalDistribution<float64_t>(), prng);
+	auto feats=std::make_shared<DenseFeatures<float64_t>>(data);
+
+	auto kernel=std::make_shared<GaussianKernel>();
+	kernel->set_width(2.0);
+	kernel->init(feats, feats);
+	auto kernel_matrix=kernel->get_kernel_matrix<float32_t>();
+
+	auto permutation_mmd=internal::mmd::PermutationMMD();
+	permutation_mmd.m_n_x=n;
+	permutation_mmd.m_n_y=n;
+	permutation_mmd.m_stype=stype;
+	permutation_mmd.m_num_null_samples=num_null_samples;
+	permutation_mmd.m_block_size=5;
+
+	prng.seed(seed);
+	SGVector<float32_t> null_samples=permutation_mmd(kernel_matrix, prng);
+
+	// a statistic that most null samples exceed
+	float32_t statistic=*std::min_element(null_samples.begin(), null_samples.end());
+
+	prng.seed(seed);
+	auto p_value=permutation_mmd.p_value(kernel_matrix, statistic, prng);
+	SGVector<float32_t> sorted_null_samples=null_samples.clone();
+	EXPECT_NEAR(permutation_mmd.compute_p_value(sorted_null_samples, statistic), p_value, 1E-10);
+
+	// stop after the block in which the second exceedance occurs
+	index_t end=0;
+	index_t exceedances=0;
+	while (exceedances<2 && end<num_null_samples)
+	{
+		for (auto i=end; i<end+permutation_mmd.m_block_size; ++i)
+			exceedances+=null_samples[i]>statistic;
+		end+=permutation_mmd.m_block_size;
+	}
+
+	permutation_mmd.m_num_exceedances=2;
+	prng.seed(seed);
+	p_value=permutation_mmd.p_value(kernel_matrix, statistic, prng);
+	EXPECT_NEAR(float64_t(exceedances)/end, p_value, 1E-10);
+	EXPECT_LT(end, num_null_samples);
+}